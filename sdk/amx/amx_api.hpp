@@ -60,7 +60,7 @@ namespace Samp_SDK {
             auto func_ptr = reinterpret_cast<Func>(Core::Instance().Get_AMX_Export(Index));
 
             if (!func_ptr)
-                return (Log("[SA-MP SDK] Fatal: Attempted to call AMX export at index %d, but pAMXFunctions was not loaded!", Index), Samp_SDK::amx::Detail::Amx_Call_Error_Handler<Return_Type>());
+                return (SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Fatal: Attempted to call AMX export at index %d, but pAMXFunctions was not loaded!", Index), Samp_SDK::amx::Detail::Amx_Call_Error_Handler<Return_Type>());
 
             return func_ptr(args...);
         }
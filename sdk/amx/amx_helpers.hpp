@@ -49,14 +49,18 @@ namespace Samp_SDK {
         va_list args;
         va_start(args, format);
 
+        char stack_buffer[512];
         va_list args_copy;
         va_copy(args_copy, args);
-        int size = std::vsnprintf(nullptr, 0, format, args_copy);
+        int size = std::vsnprintf(stack_buffer, sizeof(stack_buffer), format, args_copy);
         va_end(args_copy);
 
         if (size < 0)
             return (va_end(args), "");
 
+        if (static_cast<size_t>(size) < sizeof(stack_buffer))
+            return (va_end(args), std::string(stack_buffer, size));
+
         std::string buffer(size, '\0');
 
         std::vsnprintf(&buffer[0], buffer.size() + 1, format, args);
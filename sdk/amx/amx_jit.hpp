@@ -0,0 +1,1703 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+//
+#include "amx_defs.h"
+#include "amx_opcodes.hpp"
+#include "../core/platform.hpp"
+#include "../utils/logger.hpp"
+
+#if defined(SAMP_SDK_WINDOWS)
+    #include <windows.h>
+#elif defined(SAMP_SDK_LINUX)
+    #include <unistd.h>
+    #include <sys/mman.h>
+#endif
+
+namespace Samp_SDK {
+    namespace Detail {
+        constexpr cell JIT_STACK_MARGIN = 16 * sizeof(cell);
+
+        struct Jit_Meter {
+            int64_t remaining;
+            cell cip;
+            cell error;
+        };
+
+        struct Jit_Frame {
+            AMX* amx;
+            unsigned char* data;
+            uint32_t native_esp;
+            cell hea;
+            cell pri;
+            cell alt;
+            cell stk;
+            cell frm;
+            cell cip;
+            cell halted;
+            cell temp;
+            Jit_Meter* meter;
+        };
+
+        using Jit_Entry = int (SAMP_SDK_CDECL*)(Jit_Frame* frame, uint32_t target);
+
+        inline void SAMP_SDK_CDECL Jit_Helper_Movs(unsigned char* dest, const unsigned char* source, cell bytes) {
+            std::memmove(dest, source, static_cast<size_t>(bytes));
+        }
+
+        inline cell SAMP_SDK_CDECL Jit_Helper_Cmps(const unsigned char* first, const unsigned char* second, cell bytes) {
+            return std::memcmp(first, second, static_cast<size_t>(bytes));
+        }
+
+        inline void SAMP_SDK_CDECL Jit_Helper_Fill(unsigned char* dest, cell value, cell bytes) {
+            for (; bytes >= static_cast<cell>(sizeof(cell)); dest += sizeof(cell), bytes -= sizeof(cell))
+                std::memcpy(dest, &value, sizeof(cell));
+        }
+
+        enum class X86_Reg : uint8_t {
+            Eax, Ecx, Edx, Ebx, Esp, Ebp, Esi, Edi
+        };
+
+        enum class X86_Cond : uint8_t {
+            O, No, B, Ae, E, Ne, Be, A, S, Ns, P, Np, L, Ge, Le, G
+        };
+
+        enum class X86_Alu : uint8_t {
+            Add, Or, Adc, Sbb, And, Sub, Xor, Cmp
+        };
+
+        struct X86_Mem {
+            X86_Reg base;
+            int32_t disp = 0;
+            X86_Reg index = X86_Reg::Esp;
+            uint8_t scale = 0;
+        };
+
+        class X86_Emitter {
+            public:
+                [[nodiscard]] size_t Get_Position() const {
+                    return code_.size();
+                }
+
+                [[nodiscard]] const std::vector<uint8_t>& Get_Code() const {
+                    return code_;
+                }
+
+                int New_Label() {
+                    labels_.push_back(SIZE_MAX);
+
+                    return static_cast<int>(labels_.size() - 1);
+                }
+
+                void Bind(int label) {
+                    labels_[static_cast<size_t>(label)] = code_.size();
+                }
+
+                bool Resolve() {
+                    for (const auto& fixup : fixups_) {
+                        size_t target = labels_[static_cast<size_t>(fixup.second)];
+
+                        if (target == SIZE_MAX)
+                            return false;
+
+                        int32_t relative = static_cast<int32_t>(static_cast<int64_t>(target) - static_cast<int64_t>(fixup.first + 4));
+                        std::memcpy(&code_[fixup.first], &relative, sizeof(relative));
+                    }
+
+                    return true;
+                }
+
+                void Byte(uint8_t value) {
+                    code_.push_back(value);
+                }
+
+                void Dword(uint32_t value) {
+                    for (int i = 0; i < 4; ++i)
+                        code_.push_back(static_cast<uint8_t>(value >> (i * 8)));
+                }
+
+                void Op(std::initializer_list<uint8_t> opcode, uint8_t field, X86_Reg rm) {
+                    for (uint8_t byte : opcode)
+                        Byte(byte);
+
+                    Byte(static_cast<uint8_t>(0xC0 | (field << 3) | static_cast<uint8_t>(rm)));
+                }
+
+                void Op(std::initializer_list<uint8_t> opcode, uint8_t field, const X86_Mem& mem) {
+                    for (uint8_t byte : opcode)
+                        Byte(byte);
+
+                    bool sib = mem.index != X86_Reg::Esp || mem.base == X86_Reg::Esp;
+                    uint8_t rm = sib ? 4 : static_cast<uint8_t>(mem.base);
+                    uint8_t mod = (mem.disp == 0 && mem.base != X86_Reg::Ebp) ? 0 : (mem.disp >= -128 && mem.disp <= 127) ? 1 : 2;
+
+                    Byte(static_cast<uint8_t>((mod << 6) | (field << 3) | rm));
+
+                    if (sib)
+                        Byte(static_cast<uint8_t>((mem.scale << 6) | (static_cast<uint8_t>(mem.index) << 3) | static_cast<uint8_t>(mem.base)));
+
+                    if (mod == 1)
+                        Byte(static_cast<uint8_t>(static_cast<int8_t>(mem.disp)));
+                    else if (mod == 2)
+                        Dword(static_cast<uint32_t>(mem.disp));
+                }
+
+                void Mov(X86_Reg dest, X86_Reg source) {
+                    if (dest != source)
+                        Op({0x89}, static_cast<uint8_t>(source), dest);
+                }
+
+                void Mov(X86_Reg dest, cell value) {
+                    if (value == 0)
+                        return Alu(X86_Alu::Xor, dest, dest);
+
+                    Byte(static_cast<uint8_t>(0xB8 + static_cast<uint8_t>(dest)));
+                    Dword(static_cast<uint32_t>(value));
+                }
+
+                void Mov(X86_Reg dest, const X86_Mem& source) {
+                    Op({0x8B}, static_cast<uint8_t>(dest), source);
+                }
+
+                void Mov(const X86_Mem& dest, X86_Reg source) {
+                    Op({0x89}, static_cast<uint8_t>(source), dest);
+                }
+
+                void Mov(const X86_Mem& dest, cell value) {
+                    Op({0xC7}, 0, dest);
+                    Dword(static_cast<uint32_t>(value));
+                }
+
+                void Mov_Byte(const X86_Mem& dest, X86_Reg source) {
+                    Op({0x88}, static_cast<uint8_t>(source), dest);
+                }
+
+                void Mov_Word(const X86_Mem& dest, X86_Reg source) {
+                    Op({0x66, 0x89}, static_cast<uint8_t>(source), dest);
+                }
+
+                void Movzx_Byte(X86_Reg dest, const X86_Mem& source) {
+                    Op({0x0F, 0xB6}, static_cast<uint8_t>(dest), source);
+                }
+
+                void Movzx_Word(X86_Reg dest, const X86_Mem& source) {
+                    Op({0x0F, 0xB7}, static_cast<uint8_t>(dest), source);
+                }
+
+                void Lea(X86_Reg dest, const X86_Mem& source) {
+                    Op({0x8D}, static_cast<uint8_t>(dest), source);
+                }
+
+                void Alu(X86_Alu op, X86_Reg dest, X86_Reg source) {
+                    Op({static_cast<uint8_t>(static_cast<uint8_t>(op) * 8 + 1)}, static_cast<uint8_t>(source), dest);
+                }
+
+                void Alu(X86_Alu op, X86_Reg dest, const X86_Mem& source) {
+                    Op({static_cast<uint8_t>(static_cast<uint8_t>(op) * 8 + 3)}, static_cast<uint8_t>(dest), source);
+                }
+
+                void Alu(X86_Alu op, const X86_Mem& dest, X86_Reg source) {
+                    Op({static_cast<uint8_t>(static_cast<uint8_t>(op) * 8 + 1)}, static_cast<uint8_t>(source), dest);
+                }
+
+                template<typename Operand>
+                void Alu(X86_Alu op, const Operand& dest, cell value) {
+                    if (value >= -128 && value <= 127) {
+                        Op({0x83}, static_cast<uint8_t>(op), dest);
+                        Byte(static_cast<uint8_t>(static_cast<int8_t>(value)));
+                    }
+                    else {
+                        Op({0x81}, static_cast<uint8_t>(op), dest);
+                        Dword(static_cast<uint32_t>(value));
+                    }
+                }
+
+                void Test(X86_Reg first, X86_Reg second) {
+                    Op({0x85}, static_cast<uint8_t>(second), first);
+                }
+
+                void Test_Low_Byte(X86_Reg reg, uint8_t value) {
+                    Op({0xF6}, 0, reg);
+                    Byte(value);
+                }
+
+                void Unary(uint8_t field, X86_Reg reg) {
+                    Op({0xF7}, field, reg);
+                }
+
+                void Imul(X86_Reg dest, X86_Reg source) {
+                    Op({0x0F, 0xAF}, static_cast<uint8_t>(dest), source);
+                }
+
+                void Imul(X86_Reg dest, X86_Reg source, cell value) {
+                    Op({0x69}, static_cast<uint8_t>(dest), source);
+                    Dword(static_cast<uint32_t>(value));
+                }
+
+                void Shift(uint8_t field, X86_Reg reg) {
+                    Op({0xD3}, field, reg);
+                }
+
+                void Shift(uint8_t field, X86_Reg reg, cell count) {
+                    Op({0xC1}, field, reg);
+                    Byte(static_cast<uint8_t>(count & 31));
+                }
+
+                void Setcc(X86_Cond cond, X86_Reg reg) {
+                    Op({0x0F, static_cast<uint8_t>(0x90 + static_cast<uint8_t>(cond))}, 0, reg);
+                }
+
+                void Push(X86_Reg reg) {
+                    Byte(static_cast<uint8_t>(0x50 + static_cast<uint8_t>(reg)));
+                }
+
+                void Push(cell value) {
+                    Byte(0x68);
+                    Dword(static_cast<uint32_t>(value));
+                }
+
+                void Push(const X86_Mem& source) {
+                    Op({0xFF}, 6, source);
+                }
+
+                void Pop(X86_Reg reg) {
+                    Byte(static_cast<uint8_t>(0x58 + static_cast<uint8_t>(reg)));
+                }
+
+                void Pop(const X86_Mem& dest) {
+                    Op({0x8F}, 0, dest);
+                }
+
+                void Call(X86_Reg reg) {
+                    Op({0xFF}, 2, reg);
+                }
+
+                void Call(const X86_Mem& target) {
+                    Op({0xFF}, 2, target);
+                }
+
+                void Jmp(X86_Reg reg) {
+                    Op({0xFF}, 4, reg);
+                }
+
+                void Jmp(const X86_Mem& target) {
+                    Op({0xFF}, 4, target);
+                }
+
+                void Jmp(int label) {
+                    Byte(0xE9);
+                    Fixup(label);
+                }
+
+                void Jcc(X86_Cond cond, int label) {
+                    Byte(0x0F);
+                    Byte(static_cast<uint8_t>(0x80 + static_cast<uint8_t>(cond)));
+                    Fixup(label);
+                }
+
+                void Ret() {
+                    Byte(0xC3);
+                }
+
+            private:
+                void Fixup(int label) {
+                    fixups_.push_back({code_.size(), label});
+                    Dword(0);
+                }
+
+                std::vector<uint8_t> code_;
+                std::vector<size_t> labels_;
+                std::vector<std::pair<size_t, int>> fixups_;
+        };
+
+        class Jit_Program {
+            public:
+                Jit_Program(std::vector<uint32_t> offsets, size_t code_size, bool metered) : map_(std::move(offsets)), code_size_(code_size), metered_(metered) {}
+
+                ~Jit_Program() {
+                    if (!memory_)
+                        return;
+#if defined(SAMP_SDK_WINDOWS)
+                    VirtualFree(memory_, 0, MEM_RELEASE);
+#elif defined(SAMP_SDK_LINUX)
+                    munmap(memory_, code_size_);
+#endif
+                }
+
+                Jit_Program(const Jit_Program&) = delete;
+                Jit_Program& operator=(const Jit_Program&) = delete;
+
+                bool Install(const std::vector<uint8_t>& code) {
+#if defined(SAMP_SDK_WINDOWS)
+                    memory_ = static_cast<unsigned char*>(VirtualAlloc(nullptr, code_size_, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+#elif defined(SAMP_SDK_LINUX)
+                    void* memory = mmap(nullptr, code_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                    memory_ = memory == MAP_FAILED ? nullptr : static_cast<unsigned char*>(memory);
+#endif
+                    if (!memory_)
+                        return false;
+
+                    std::memcpy(memory_, code.data(), code.size());
+
+                    for (uint32_t& entry : map_)
+                        entry = entry ? static_cast<uint32_t>(reinterpret_cast<uintptr_t>(memory_)) + entry : 0;
+#if defined(SAMP_SDK_WINDOWS)
+                    DWORD old_protect;
+
+                    return VirtualProtect(memory_, code_size_, PAGE_EXECUTE_READ, &old_protect) != 0;
+#elif defined(SAMP_SDK_LINUX)
+                    return mprotect(memory_, code_size_, PROT_READ | PROT_EXEC) == 0;
+#endif
+                }
+
+                [[nodiscard]] size_t Get_Code_Size() const {
+                    return code_size_;
+                }
+
+                [[nodiscard]] bool Is_Metered() const {
+                    return metered_;
+                }
+
+                [[nodiscard]] uint32_t Find_Entry(cell offset) const {
+                    if (offset < 0 || (offset & (sizeof(cell) - 1)) != 0 || static_cast<size_t>(offset) / sizeof(cell) >= map_.size())
+                        return 0;
+
+                    return map_[static_cast<size_t>(offset) / sizeof(cell)];
+                }
+
+                int Exec(AMX* amx, cell* retval, int index, Jit_Meter* meter = nullptr) {
+                    AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(amx->base);
+                    Jit_Frame frame{};
+                    Jit_Meter unmetered{INT64_MAX, 0, 0};
+                    cell reset_stk, reset_hea;
+                    uint32_t target;
+
+                    frame.amx = amx;
+                    frame.data = amx->data ? amx->data : amx->base + hdr->dat;
+                    frame.meter = meter ? meter : &unmetered;
+
+                    if (index == AMX_EXEC_CONT) {
+                        target = Find_Entry(amx->cip);
+
+                        if (!target)
+                            return static_cast<int>(Amx_Error::InvState);
+
+                        frame.pri = amx->pri;
+                        frame.alt = amx->alt;
+                        frame.frm = amx->frm;
+                        frame.stk = amx->stk;
+                        frame.hea = amx->hea;
+                        reset_stk = amx->reset_stk;
+                        reset_hea = amx->reset_hea;
+                    }
+                    else {
+                        cell paramcount = amx->paramcount;
+                        cell offset = -1;
+
+                        amx->paramcount = 0;
+
+                        if (index == AMX_EXEC_MAIN)
+                            offset = hdr->cip;
+                        else if (index >= 0 && index < (hdr->natives - hdr->publics) / hdr->defsize)
+                            offset = static_cast<cell>(reinterpret_cast<AMX_FUNCSTUBNT*>(amx->base + hdr->publics)[index].address);
+
+                        target = Find_Entry(offset);
+
+                        if ((amx->flags & AMX_FLAG_NTVREG) == 0 || !target) {
+                            amx->stk += paramcount * static_cast<cell>(sizeof(cell));
+
+                            return static_cast<int>((amx->flags & AMX_FLAG_NTVREG) == 0 ? Amx_Error::NotFound : Amx_Error::Index);
+                        }
+
+                        frame.stk = amx->stk;
+                        frame.hea = amx->hea;
+                        frame.frm = amx->frm;
+                        reset_stk = frame.stk + paramcount * static_cast<cell>(sizeof(cell));
+                        reset_hea = frame.hea;
+
+                        if (frame.hea + JIT_STACK_MARGIN > frame.stk - 2 * static_cast<cell>(sizeof(cell))) {
+                            amx->stk = reset_stk;
+
+                            return static_cast<int>(Amx_Error::StackErr);
+                        }
+
+                        frame.stk -= sizeof(cell);
+                        std::memcpy(frame.data + frame.stk, &(paramcount *= static_cast<cell>(sizeof(cell))), sizeof(cell));
+                        frame.stk -= sizeof(cell);
+                        std::memset(frame.data + frame.stk, 0, sizeof(cell));
+                    }
+
+                    amx->error = static_cast<int>(Amx_Error::None);
+
+                    int error = reinterpret_cast<Jit_Entry>(memory_)(&frame, target);
+
+                    if (frame.halted) {
+                        if (retval)
+                            *retval = frame.pri;
+
+                        amx->cip = frame.cip;
+                        amx->frm = frame.frm;
+                        amx->pri = frame.pri;
+                        amx->alt = frame.alt;
+                    }
+
+                    if (error == static_cast<int>(Amx_Error::Sleep)) {
+                        amx->cip = frame.cip;
+                        amx->frm = frame.frm;
+                        amx->pri = frame.pri;
+                        amx->alt = frame.alt;
+                        amx->stk = frame.stk;
+                        amx->hea = frame.hea;
+                        amx->reset_stk = reset_stk;
+                        amx->reset_hea = reset_hea;
+
+                        return error;
+                    }
+
+                    amx->stk = reset_stk;
+                    amx->hea = reset_hea;
+
+                    return error;
+                }
+
+            private:
+                unsigned char* memory_ = nullptr;
+                std::vector<uint32_t> map_;
+                size_t code_size_;
+                bool metered_;
+        };
+
+        class Jit_Compiler {
+            public:
+                Jit_Compiler(AMX* amx, const cell* opcode_list, bool direct_natives, bool metered) : amx_(amx), reader_(amx, opcode_list), direct_natives_(direct_natives), metered_(metered) {}
+
+                std::unique_ptr<Jit_Program> Compile(int* error) {
+                    auto fail = [error](Amx_Error code) { return (*error = static_cast<int>(code), nullptr); };
+                    AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(amx_->base);
+                    size_t count = reader_.Get_Cell_Count();
+
+                    if (!reader_.Is_Valid() || hdr->defsize != sizeof(AMX_FUNCSTUBNT))
+                        return fail(Amx_Error::InitJit);
+
+                    starts_.assign(count, 0);
+                    targets_.assign(count, 0);
+                    cell_labels_.assign(count, -1);
+
+                    for (size_t cip = 0; cip < count;) {
+                        int size = reader_.Get_Size(cip);
+
+                        if (size <= 0)
+                            return fail(Amx_Error::InvInstr);
+
+                        starts_[cip] = 1;
+                        cip += static_cast<size_t>(size);
+                    }
+
+                    for (size_t cip = 0; cip < count; cip += static_cast<size_t>(reader_.Get_Size(cip)))
+                        Mark_Targets(cip);
+
+                    Mark_Target(hdr->cip);
+
+                    for (int i = 0; i < (hdr->natives - hdr->publics) / hdr->defsize; ++i)
+                        Mark_Target(static_cast<cell>(reinterpret_cast<AMX_FUNCSTUBNT*>(amx_->base + hdr->publics)[i].address));
+
+                    if (metered_)
+                        Measure_Blocks(count);
+
+                    code_size_ = static_cast<cell>(count * sizeof(cell));
+                    static_end_ = hdr->hea - hdr->dat;
+                    offsets_.assign(count, 0);
+                    map_base_ = offsets_.data();
+                    exit_ = as_.New_Label();
+
+                    Emit_Entry();
+
+                    for (size_t cip = 0; cip < count; cip += static_cast<size_t>(reader_.Get_Size(cip))) {
+                        if (targets_[cip])
+                            Reset_State();
+
+                        as_.Bind(Get_Label(cip));
+
+                        if (pri_.kind == Value::Unknown && alt_.kind == Value::Unknown)
+                            offsets_[cip] = static_cast<uint32_t>(as_.Get_Position());
+
+                        if (metered_ && block_lengths_[cip] > 0)
+                            Charge_Meter(cip);
+
+                        Emit_Instruction(cip);
+                    }
+
+                    Emit_Exit();
+                    Emit_Stubs();
+                    Emit_Meter_Stubs();
+
+                    if (!as_.Resolve())
+                        return fail(Amx_Error::InitJit);
+
+                    const std::vector<uint8_t>& code = as_.Get_Code();
+                    auto program = std::make_unique<Jit_Program>(std::move(offsets_), code.size(), metered_);
+
+                    if (!program->Install(code))
+                        return fail(Amx_Error::Memory);
+
+                    *error = static_cast<int>(Amx_Error::None);
+
+                    return program;
+                }
+
+                [[nodiscard]] size_t Get_Folded_Checks() const {
+                    return folded_checks_;
+                }
+
+            private:
+                struct Value {
+                    enum Kind : uint8_t {
+                        Unknown,
+                        Constant,
+                        Bounded,
+                        Safe_Address
+                    };
+
+                    Kind kind = Unknown;
+                    cell value = 0;
+                };
+
+                struct Stub {
+                    int label;
+                    cell cip;
+                    cell error;
+                };
+
+                struct Meter_Stub {
+                    int label;
+                    int resume;
+                    cell cip;
+                };
+
+                static constexpr X86_Reg PRI = X86_Reg::Eax;
+                static constexpr X86_Reg ALT = X86_Reg::Ecx;
+                static constexpr X86_Reg TMP = X86_Reg::Edx;
+                static constexpr X86_Reg DAT = X86_Reg::Ebx;
+                static constexpr X86_Reg STK = X86_Reg::Esi;
+                static constexpr X86_Reg FRM = X86_Reg::Edi;
+                static constexpr X86_Reg CTX = X86_Reg::Ebp;
+
+                static X86_Mem Frame_Field(size_t offset) {
+                    return {CTX, static_cast<int32_t>(offset)};
+                }
+
+                static X86_Mem Amx_Field(size_t offset) {
+                    return {TMP, static_cast<int32_t>(offset)};
+                }
+
+                static X86_Mem Data(cell address) {
+                    return {DAT, address};
+                }
+
+                static X86_Mem Data(X86_Reg address, int32_t disp = 0) {
+                    return {DAT, disp, address, 0};
+                }
+
+                void Mark_Target(cell offset) {
+                    if (offset >= 0 && (offset & (sizeof(cell) - 1)) == 0 && static_cast<size_t>(offset) / sizeof(cell) < targets_.size())
+                        targets_[static_cast<size_t>(offset) / sizeof(cell)] = 1;
+                }
+
+                void Mark_Targets(size_t cip) {
+                    switch (reader_.Get_Opcode(cip)) {
+                        case Amx_Opcode::Call:
+                        case Amx_Opcode::Jump:
+                        case Amx_Opcode::Jzer:
+                        case Amx_Opcode::Jnz:
+                        case Amx_Opcode::Jeq:
+                        case Amx_Opcode::Jneq:
+                        case Amx_Opcode::Jless:
+                        case Amx_Opcode::Jleq:
+                        case Amx_Opcode::Jgrtr:
+                        case Amx_Opcode::Jgeq:
+                        case Amx_Opcode::Jsless:
+                        case Amx_Opcode::Jsleq:
+                        case Amx_Opcode::Jsgrtr:
+                        case Amx_Opcode::Jsgeq:
+                            Mark_Target(reader_.Get_Target(cip));
+                            break;
+                        case Amx_Opcode::Jrel:
+                            Mark_Target(static_cast<cell>((cip + 2) * sizeof(cell)) + reader_.Get_Operand(cip));
+                            break;
+                        case Amx_Opcode::Casetbl:
+                            for (cell i = 0; i <= reader_.Get_Operand(cip); ++i)
+                                Mark_Target(reader_.Get_Target(cip, 1 + 2 * static_cast<int>(i)));
+                            break;
+                        default:
+                            break;
+                    }
+                }
+
+                static bool Ends_Block(Amx_Opcode opcode) {
+                    switch (opcode) {
+                        case Amx_Opcode::Call:
+                        case Amx_Opcode::Call_Pri:
+                        case Amx_Opcode::Jump:
+                        case Amx_Opcode::Jrel:
+                        case Amx_Opcode::Jump_Pri:
+                        case Amx_Opcode::Jzer:
+                        case Amx_Opcode::Jnz:
+                        case Amx_Opcode::Jeq:
+                        case Amx_Opcode::Jneq:
+                        case Amx_Opcode::Jless:
+                        case Amx_Opcode::Jleq:
+                        case Amx_Opcode::Jgrtr:
+                        case Amx_Opcode::Jgeq:
+                        case Amx_Opcode::Jsless:
+                        case Amx_Opcode::Jsleq:
+                        case Amx_Opcode::Jsgrtr:
+                        case Amx_Opcode::Jsgeq:
+                        case Amx_Opcode::Ret:
+                        case Amx_Opcode::Retn:
+                        case Amx_Opcode::Switch:
+                        case Amx_Opcode::Halt:
+                            return true;
+                        default:
+                            return false;
+                    }
+                }
+
+                void Measure_Blocks(size_t count) {
+                    size_t leader = 0;
+                    bool starts_block = true;
+
+                    block_lengths_.assign(count, 0);
+
+                    for (size_t cip = 0; cip < count; cip += static_cast<size_t>(reader_.Get_Size(cip))) {
+                        if (starts_block || targets_[cip])
+                            leader = cip;
+
+                        ++block_lengths_[leader];
+                        starts_block = Ends_Block(reader_.Get_Opcode(cip));
+                    }
+                }
+
+                void Charge_Meter(size_t cip) {
+                    int slow = as_.New_Label();
+                    int resume = as_.New_Label();
+
+                    as_.Mov(TMP, Frame_Field(offsetof(Jit_Frame, meter)));
+                    as_.Alu(X86_Alu::Sub, X86_Mem{TMP}, block_lengths_[cip]);
+                    as_.Jcc(X86_Cond::B, slow);
+                    as_.Bind(resume);
+                    meter_stubs_.push_back({slow, resume, static_cast<cell>(cip * sizeof(cell))});
+                }
+
+                int Get_Label(size_t cip) {
+                    if (cell_labels_[cip] < 0)
+                        cell_labels_[cip] = as_.New_Label();
+
+                    return cell_labels_[cip];
+                }
+
+                int Target_Label(cell offset) {
+                    if (offset < 0 || (offset & (sizeof(cell) - 1)) != 0 || static_cast<size_t>(offset) / sizeof(cell) >= starts_.size() || !starts_[static_cast<size_t>(offset) / sizeof(cell)])
+                        return Abort_Label(Amx_Error::InvInstr);
+
+                    return Get_Label(static_cast<size_t>(offset) / sizeof(cell));
+                }
+
+                int Abort_Label(Amx_Error error) {
+                    for (const Stub& stub : stubs_) {
+                        if (stub.cip < 0 && stub.error == static_cast<cell>(error))
+                            return stub.label;
+                    }
+
+                    stubs_.push_back({as_.New_Label(), -1, static_cast<cell>(error)});
+
+                    return stubs_.back().label;
+                }
+
+                int Fail_Label(cell next_cip) {
+                    stubs_.push_back({as_.New_Label(), next_cip, -1});
+
+                    return stubs_.back().label;
+                }
+
+                void Reset_State() {
+                    pri_ = Value();
+                    alt_ = Value();
+                }
+
+                bool Is_Static_Index(const Value& base, const Value& index, int shift) {
+                    if (base.kind != Value::Constant || (index.kind != Value::Constant && index.kind != Value::Bounded) || index.value < 0 || base.value < 0)
+                        return false;
+
+                    return static_cast<int64_t>(base.value) + (static_cast<int64_t>(index.value) << shift) + static_cast<int64_t>(sizeof(cell)) <= static_end_;
+                }
+
+                bool Is_Safe(const Value& address) {
+                    return address.kind == Value::Safe_Address || (address.kind == Value::Constant && address.value >= 0 && static_cast<int64_t>(address.value) + static_cast<int64_t>(sizeof(cell)) <= static_end_);
+                }
+
+                void Check_Memory(X86_Reg address, const Value& known) {
+                    if (Is_Safe(known)) {
+                        ++folded_checks_;
+
+                        return;
+                    }
+
+                    int ok = as_.New_Label();
+                    int fail = Abort_Label(Amx_Error::MemAccess);
+
+                    as_.Alu(X86_Alu::Cmp, address, static_cast<cell>(amx_->stp));
+                    as_.Jcc(X86_Cond::Ae, fail);
+                    as_.Alu(X86_Alu::Cmp, address, Frame_Field(offsetof(Jit_Frame, hea)));
+                    as_.Jcc(X86_Cond::B, ok);
+
+                    if (address == TMP) {
+                        as_.Alu(X86_Alu::Add, TMP, DAT);
+                        as_.Alu(X86_Alu::Cmp, TMP, STK);
+                        as_.Jcc(X86_Cond::B, fail);
+                        as_.Alu(X86_Alu::Sub, TMP, DAT);
+                    }
+                    else {
+                        as_.Lea(TMP, {DAT, 0, address, 0});
+                        as_.Alu(X86_Alu::Cmp, TMP, STK);
+                        as_.Jcc(X86_Cond::B, fail);
+                    }
+
+                    as_.Bind(ok);
+                }
+
+                void Check_Range(X86_Reg address, cell bytes) {
+                    Check_Memory(address, Value());
+
+                    if (bytes > 1) {
+                        as_.Lea(TMP, {address, bytes - 1});
+                        Check_Memory(TMP, Value());
+                    }
+                }
+
+                void Check_Margin() {
+                    as_.Mov(TMP, Frame_Field(offsetof(Jit_Frame, hea)));
+                    as_.Lea(TMP, {DAT, JIT_STACK_MARGIN, TMP, 0});
+                    as_.Alu(X86_Alu::Cmp, TMP, STK);
+                    as_.Jcc(X86_Cond::A, Abort_Label(Amx_Error::StackErr));
+                }
+
+                void Push_Stack(X86_Reg reg) {
+                    as_.Alu(X86_Alu::Sub, STK, static_cast<cell>(sizeof(cell)));
+                    as_.Mov(X86_Mem{STK}, reg);
+                }
+
+                void Push_Stack(cell value) {
+                    as_.Alu(X86_Alu::Sub, STK, static_cast<cell>(sizeof(cell)));
+                    as_.Mov(X86_Mem{STK}, value);
+                }
+
+                void Jump_Computed() {
+                    int fail = Abort_Label(Amx_Error::MemAccess);
+
+                    as_.Alu(X86_Alu::Cmp, TMP, code_size_);
+                    as_.Jcc(X86_Cond::Ae, fail);
+                    as_.Test_Low_Byte(TMP, 3);
+                    as_.Jcc(X86_Cond::Ne, fail);
+                    as_.Mov(TMP, X86_Mem{TMP, static_cast<int32_t>(reinterpret_cast<uintptr_t>(map_base_))});
+                    as_.Test(TMP, TMP);
+                    as_.Jcc(X86_Cond::E, fail);
+                    as_.Jmp(TMP);
+                }
+
+                void Save_State(cell next_cip) {
+                    as_.Mov(TMP, Frame_Field(offsetof(Jit_Frame, amx)));
+                    as_.Mov(Amx_Field(offsetof(AMX, cip)), next_cip);
+                    as_.Mov(Amx_Field(offsetof(AMX, stk)), STK);
+                    as_.Alu(X86_Alu::Sub, Amx_Field(offsetof(AMX, stk)), DAT);
+                    as_.Mov(Amx_Field(offsetof(AMX, frm)), FRM);
+                    as_.Alu(X86_Alu::Sub, Amx_Field(offsetof(AMX, frm)), DAT);
+                    as_.Push(Frame_Field(offsetof(Jit_Frame, hea)));
+                    as_.Pop(Amx_Field(offsetof(AMX, hea)));
+                }
+
+                void Call_Native(uint32_t address, cell next_cip) {
+                    Save_State(next_cip);
+                    as_.Mov(Amx_Field(offsetof(AMX, error)), 0);
+                    as_.Push(ALT);
+                    as_.Push(STK);
+                    as_.Push(TMP);
+                    as_.Mov(PRI, static_cast<cell>(address));
+                    as_.Call(PRI);
+                    as_.Alu(X86_Alu::Add, X86_Reg::Esp, 8);
+                    as_.Pop(ALT);
+                    as_.Mov(TMP, Frame_Field(offsetof(Jit_Frame, amx)));
+                    as_.Mov(TMP, Amx_Field(offsetof(AMX, error)));
+                    as_.Test(TMP, TMP);
+                    as_.Jcc(X86_Cond::Ne, Fail_Label(next_cip));
+                }
+
+                void Call_Callback(const cell* index, cell next_cip) {
+                    if (!index)
+                        as_.Mov(Frame_Field(offsetof(Jit_Frame, temp)), PRI);
+
+                    Save_State(next_cip);
+                    as_.Push(ALT);
+                    as_.Alu(X86_Alu::Sub, X86_Reg::Esp, 8);
+                    as_.Push(STK);
+                    as_.Lea(PRI, Frame_Field(offsetof(Jit_Frame, pri)));
+                    as_.Push(PRI);
+
+                    if (index)
+                        as_.Push(*index);
+                    else
+                        as_.Push(Frame_Field(offsetof(Jit_Frame, temp)));
+
+                    as_.Push(TMP);
+                    as_.Call(Amx_Field(offsetof(AMX, callback)));
+                    as_.Alu(X86_Alu::Add, X86_Reg::Esp, 24);
+                    as_.Pop(ALT);
+                    as_.Mov(TMP, PRI);
+                    as_.Mov(PRI, Frame_Field(offsetof(Jit_Frame, pri)));
+                    as_.Test(TMP, TMP);
+                    as_.Jcc(X86_Cond::Ne, Fail_Label(next_cip));
+                }
+
+                void Call_Helper(const void* helper, cell bytes, X86_Reg source, bool source_is_address, bool keep_pri) {
+                    as_.Push(ALT);
+
+                    if (keep_pri)
+                        as_.Push(PRI);
+
+                    as_.Alu(X86_Alu::Sub, X86_Reg::Esp, keep_pri ? 8 : 12);
+                    as_.Push(bytes);
+
+                    if (source_is_address) {
+                        as_.Lea(TMP, Data(source));
+                        as_.Push(TMP);
+                    }
+                    else
+                        as_.Push(source);
+
+                    as_.Lea(TMP, Data(ALT));
+                    as_.Push(TMP);
+                    as_.Mov(TMP, static_cast<cell>(reinterpret_cast<uintptr_t>(helper)));
+                    as_.Call(TMP);
+                    as_.Alu(X86_Alu::Add, X86_Reg::Esp, keep_pri ? 20 : 24);
+
+                    if (keep_pri)
+                        as_.Pop(PRI);
+
+                    as_.Pop(ALT);
+                }
+
+                void Compare(X86_Cond cond, X86_Reg first, const cell* value = nullptr) {
+                    as_.Alu(X86_Alu::Xor, TMP, TMP);
+
+                    if (value)
+                        as_.Alu(X86_Alu::Cmp, first, *value);
+                    else
+                        as_.Alu(X86_Alu::Cmp, first, ALT);
+
+                    as_.Setcc(cond, TMP);
+                    as_.Mov(PRI, TMP);
+                }
+
+                void Signed_Divide() {
+                    int not_minus_one = as_.New_Label();
+                    int done = as_.New_Label();
+                    int keep = as_.New_Label();
+
+                    as_.Test(ALT, ALT);
+                    as_.Jcc(X86_Cond::E, Abort_Label(Amx_Error::Divide));
+                    as_.Alu(X86_Alu::Cmp, ALT, -1);
+                    as_.Jcc(X86_Cond::Ne, not_minus_one);
+                    as_.Unary(3, PRI);
+                    as_.Alu(X86_Alu::Xor, ALT, ALT);
+                    as_.Jmp(done);
+                    as_.Bind(not_minus_one);
+                    as_.Byte(0x99);
+                    as_.Unary(7, ALT);
+                    as_.Test(TMP, TMP);
+                    as_.Jcc(X86_Cond::E, keep);
+                    as_.Mov(Frame_Field(offsetof(Jit_Frame, temp)), TMP);
+                    as_.Alu(X86_Alu::Xor, TMP, ALT);
+                    as_.Mov(TMP, Frame_Field(offsetof(Jit_Frame, temp)));
+                    as_.Jcc(X86_Cond::Ns, keep);
+                    as_.Alu(X86_Alu::Sub, PRI, 1);
+                    as_.Alu(X86_Alu::Add, TMP, ALT);
+                    as_.Bind(keep);
+                    as_.Mov(ALT, TMP);
+                    as_.Bind(done);
+                }
+
+                void Unsigned_Divide() {
+                    as_.Test(ALT, ALT);
+                    as_.Jcc(X86_Cond::E, Abort_Label(Amx_Error::Divide));
+                    as_.Alu(X86_Alu::Xor, TMP, TMP);
+                    as_.Unary(6, ALT);
+                    as_.Mov(ALT, TMP);
+                }
+
+                void Emit_Entry() {
+                    as_.Push(X86_Reg::Ebp);
+                    as_.Push(X86_Reg::Ebx);
+                    as_.Push(X86_Reg::Esi);
+                    as_.Push(X86_Reg::Edi);
+                    as_.Mov(CTX, X86_Mem{X86_Reg::Esp, 20});
+                    as_.Mov(Frame_Field(offsetof(Jit_Frame, native_esp)), X86_Reg::Esp);
+                    as_.Mov(DAT, Frame_Field(offsetof(Jit_Frame, data)));
+                    as_.Mov(STK, Frame_Field(offsetof(Jit_Frame, stk)));
+                    as_.Alu(X86_Alu::Add, STK, DAT);
+                    as_.Mov(FRM, Frame_Field(offsetof(Jit_Frame, frm)));
+                    as_.Alu(X86_Alu::Add, FRM, DAT);
+                    as_.Mov(PRI, Frame_Field(offsetof(Jit_Frame, pri)));
+                    as_.Mov(ALT, Frame_Field(offsetof(Jit_Frame, alt)));
+                    as_.Jmp(X86_Mem{X86_Reg::Esp, 24});
+                }
+
+                void Emit_Exit() {
+                    as_.Bind(exit_);
+                    as_.Mov(Frame_Field(offsetof(Jit_Frame, pri)), PRI);
+                    as_.Mov(Frame_Field(offsetof(Jit_Frame, alt)), ALT);
+                    as_.Alu(X86_Alu::Sub, STK, DAT);
+                    as_.Mov(Frame_Field(offsetof(Jit_Frame, stk)), STK);
+                    as_.Alu(X86_Alu::Sub, FRM, DAT);
+                    as_.Mov(Frame_Field(offsetof(Jit_Frame, frm)), FRM);
+                    as_.Mov(X86_Reg::Esp, Frame_Field(offsetof(Jit_Frame, native_esp)));
+                    as_.Mov(PRI, TMP);
+                    as_.Pop(X86_Reg::Edi);
+                    as_.Pop(X86_Reg::Esi);
+                    as_.Pop(X86_Reg::Ebx);
+                    as_.Pop(X86_Reg::Ebp);
+                    as_.Ret();
+                }
+
+                void Emit_Stubs() {
+                    for (const Stub& stub : stubs_) {
+                        as_.Bind(stub.label);
+
+                        if (stub.cip >= 0)
+                            as_.Mov(Frame_Field(offsetof(Jit_Frame, cip)), stub.cip);
+
+                        if (stub.error >= 0)
+                            as_.Mov(TMP, stub.error);
+
+                        as_.Jmp(exit_);
+                    }
+                }
+
+                void Emit_Meter_Stubs() {
+                    for (const Meter_Stub& stub : meter_stubs_) {
+                        as_.Bind(stub.label);
+                        as_.Alu(X86_Alu::Sub, X86_Mem{TMP, static_cast<int32_t>(offsetof(Jit_Meter, remaining) + sizeof(uint32_t))}, 1);
+                        as_.Jcc(X86_Cond::Ns, stub.resume);
+                        as_.Mov(X86_Mem{TMP, static_cast<int32_t>(offsetof(Jit_Meter, remaining))}, 0);
+                        as_.Mov(X86_Mem{TMP, static_cast<int32_t>(offsetof(Jit_Meter, cip))}, stub.cip);
+                        as_.Mov(TMP, X86_Mem{TMP, static_cast<int32_t>(offsetof(Jit_Meter, error))});
+                        as_.Jmp(exit_);
+                    }
+                }
+
+                void Emit_Instruction(size_t cip) {
+                    Amx_Opcode opcode = reader_.Get_Opcode(cip);
+                    cell op = reader_.Get_Size(cip) > 1 ? reader_.Get_Operand(cip) : 0;
+                    cell next_cip = static_cast<cell>((cip + static_cast<size_t>(reader_.Get_Size(cip))) * sizeof(cell));
+                    Value pri = Value(), alt = alt_;
+
+                    switch (opcode) {
+                        case Amx_Opcode::Load_Pri:
+                            as_.Mov(PRI, Data(op));
+                            break;
+                        case Amx_Opcode::Load_Alt:
+                            as_.Mov(ALT, Data(op));
+                            pri = pri_, alt = Value();
+                            break;
+                        case Amx_Opcode::Load_S_Pri:
+                            as_.Mov(PRI, X86_Mem{FRM, op});
+                            break;
+                        case Amx_Opcode::Load_S_Alt:
+                            as_.Mov(ALT, X86_Mem{FRM, op});
+                            pri = pri_, alt = Value();
+                            break;
+                        case Amx_Opcode::Lref_Pri:
+                        case Amx_Opcode::Lref_S_Pri:
+                            as_.Mov(TMP, opcode == Amx_Opcode::Lref_Pri ? Data(op) : X86_Mem{FRM, op});
+                            as_.Mov(PRI, Data(TMP));
+                            break;
+                        case Amx_Opcode::Lref_Alt:
+                        case Amx_Opcode::Lref_S_Alt:
+                            as_.Mov(TMP, opcode == Amx_Opcode::Lref_Alt ? Data(op) : X86_Mem{FRM, op});
+                            as_.Mov(ALT, Data(TMP));
+                            pri = pri_, alt = Value();
+                            break;
+                        case Amx_Opcode::Load_I:
+                            Check_Memory(PRI, pri_);
+                            as_.Mov(PRI, Data(PRI));
+                            break;
+                        case Amx_Opcode::Lodb_I:
+                            Check_Memory(PRI, pri_);
+
+                            if (op == 1)
+                                as_.Movzx_Byte(PRI, Data(PRI));
+                            else if (op == 2)
+                                as_.Movzx_Word(PRI, Data(PRI));
+                            else if (op == 4)
+                                as_.Mov(PRI, Data(PRI));
+
+                            break;
+                        case Amx_Opcode::Const_Pri:
+                            as_.Mov(PRI, op);
+                            pri = {Value::Constant, op};
+                            break;
+                        case Amx_Opcode::Const_Alt:
+                            as_.Mov(ALT, op);
+                            pri = pri_, alt = {Value::Constant, op};
+                            break;
+                        case Amx_Opcode::Addr_Pri:
+                            as_.Lea(PRI, X86_Mem{FRM, op});
+                            as_.Alu(X86_Alu::Sub, PRI, DAT);
+                            break;
+                        case Amx_Opcode::Addr_Alt:
+                            as_.Lea(ALT, X86_Mem{FRM, op});
+                            as_.Alu(X86_Alu::Sub, ALT, DAT);
+                            pri = pri_, alt = Value();
+                            break;
+                        case Amx_Opcode::Stor_Pri:
+                        case Amx_Opcode::Stor_Alt:
+                            as_.Mov(Data(op), opcode == Amx_Opcode::Stor_Pri ? PRI : ALT);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Stor_S_Pri:
+                        case Amx_Opcode::Stor_S_Alt:
+                            as_.Mov(X86_Mem{FRM, op}, opcode == Amx_Opcode::Stor_S_Pri ? PRI : ALT);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Sref_Pri:
+                        case Amx_Opcode::Sref_Alt:
+                            as_.Mov(TMP, Data(op));
+                            as_.Mov(Data(TMP), opcode == Amx_Opcode::Sref_Pri ? PRI : ALT);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Sref_S_Pri:
+                        case Amx_Opcode::Sref_S_Alt:
+                            as_.Mov(TMP, X86_Mem{FRM, op});
+                            as_.Mov(Data(TMP), opcode == Amx_Opcode::Sref_S_Pri ? PRI : ALT);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Stor_I:
+                            Check_Memory(ALT, alt_);
+                            as_.Mov(Data(ALT), PRI);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Strb_I:
+                            Check_Memory(ALT, alt_);
+
+                            if (op == 1)
+                                as_.Mov_Byte(Data(ALT), PRI);
+                            else if (op == 2)
+                                as_.Mov_Word(Data(ALT), PRI);
+                            else if (op == 4)
+                                as_.Mov(Data(ALT), PRI);
+
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Lidx:
+                            if (Is_Static_Index(alt_, pri_, 2)) {
+                                ++folded_checks_;
+                                as_.Mov(PRI, X86_Mem{DAT, alt_.value, PRI, 2});
+                                break;
+                            }
+
+                            as_.Lea(TMP, X86_Mem{ALT, 0, PRI, 2});
+                            Check_Memory(TMP, Value());
+                            as_.Mov(PRI, Data(TMP));
+                            break;
+                        case Amx_Opcode::Lidx_B:
+                            as_.Mov(TMP, PRI);
+                            as_.Shift(4, TMP, op);
+                            as_.Alu(X86_Alu::Add, TMP, ALT);
+                            Check_Memory(TMP, Value());
+                            as_.Mov(PRI, Data(TMP));
+                            break;
+                        case Amx_Opcode::Idxaddr:
+                            if (Is_Static_Index(alt_, pri_, 2))
+                                pri = {Value::Safe_Address, 0};
+
+                            as_.Lea(PRI, X86_Mem{ALT, 0, PRI, 2});
+                            break;
+                        case Amx_Opcode::Idxaddr_B:
+                            if (op >= 0 && op < 31 && Is_Static_Index(alt_, pri_, static_cast<int>(op)))
+                                pri = {Value::Safe_Address, 0};
+
+                            as_.Shift(4, PRI, op);
+                            as_.Alu(X86_Alu::Add, PRI, ALT);
+                            break;
+                        case Amx_Opcode::Align_Pri:
+                            if (op < static_cast<cell>(sizeof(cell)))
+                                as_.Alu(X86_Alu::Xor, PRI, static_cast<cell>(sizeof(cell)) - op);
+
+                            break;
+                        case Amx_Opcode::Align_Alt:
+                            if (op < static_cast<cell>(sizeof(cell)))
+                                as_.Alu(X86_Alu::Xor, ALT, static_cast<cell>(sizeof(cell)) - op);
+
+                            pri = pri_, alt = Value();
+                            break;
+                        case Amx_Opcode::Lctrl:
+                            switch (op) {
+                                case 0: as_.Mov(PRI, static_cast<cell>(reinterpret_cast<AMX_HEADER*>(amx_->base)->cod)); break;
+                                case 1: as_.Mov(PRI, static_cast<cell>(reinterpret_cast<AMX_HEADER*>(amx_->base)->dat)); break;
+                                case 2: as_.Mov(PRI, Frame_Field(offsetof(Jit_Frame, hea))); break;
+                                case 3: as_.Mov(PRI, static_cast<cell>(amx_->stp)); break;
+                                case 4: as_.Mov(PRI, STK); as_.Alu(X86_Alu::Sub, PRI, DAT); break;
+                                case 5: as_.Mov(PRI, FRM); as_.Alu(X86_Alu::Sub, PRI, DAT); break;
+                                case 6: as_.Mov(PRI, next_cip); break;
+                                default: pri = pri_; break;
+                            }
+
+                            break;
+                        case Amx_Opcode::Sctrl:
+                            pri = pri_;
+
+                            switch (op) {
+                                case 2: as_.Mov(Frame_Field(offsetof(Jit_Frame, hea)), PRI); break;
+                                case 4: as_.Lea(STK, Data(PRI)); break;
+                                case 5: as_.Lea(FRM, Data(PRI)); break;
+                                case 6: as_.Mov(TMP, PRI); Jump_Computed(); pri = Value(), alt = Value(); break;
+                                default: break;
+                            }
+
+                            break;
+                        case Amx_Opcode::Move_Pri:
+                            as_.Mov(PRI, ALT);
+                            pri = alt_;
+                            break;
+                        case Amx_Opcode::Move_Alt:
+                            as_.Mov(ALT, PRI);
+                            pri = pri_, alt = pri_;
+                            break;
+                        case Amx_Opcode::Xchg:
+                            as_.Byte(0x91);
+                            pri = alt_, alt = pri_;
+                            break;
+                        case Amx_Opcode::Push_Pri:
+                        case Amx_Opcode::Push_Alt:
+                            Push_Stack(opcode == Amx_Opcode::Push_Pri ? PRI : ALT);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Push_R:
+                            for (cell i = 0; i < op; ++i)
+                                Push_Stack(PRI);
+
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Push_C:
+                            Push_Stack(op);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Push:
+                        case Amx_Opcode::Push_S:
+                            as_.Mov(TMP, opcode == Amx_Opcode::Push ? Data(op) : X86_Mem{FRM, op});
+                            Push_Stack(TMP);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Push_Adr:
+                            as_.Lea(TMP, X86_Mem{FRM, op});
+                            as_.Alu(X86_Alu::Sub, TMP, DAT);
+                            Push_Stack(TMP);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Pop_Pri:
+                            as_.Mov(PRI, X86_Mem{STK});
+                            as_.Alu(X86_Alu::Add, STK, static_cast<cell>(sizeof(cell)));
+                            break;
+                        case Amx_Opcode::Pop_Alt:
+                            as_.Mov(ALT, X86_Mem{STK});
+                            as_.Alu(X86_Alu::Add, STK, static_cast<cell>(sizeof(cell)));
+                            pri = pri_, alt = Value();
+                            break;
+                        case Amx_Opcode::Stack:
+                            as_.Mov(ALT, STK);
+                            as_.Alu(X86_Alu::Sub, ALT, DAT);
+                            as_.Alu(X86_Alu::Add, STK, op);
+                            Check_Margin();
+                            as_.Lea(TMP, Data(static_cast<cell>(amx_->stp)));
+                            as_.Alu(X86_Alu::Cmp, STK, TMP);
+                            as_.Jcc(X86_Cond::A, Abort_Label(Amx_Error::StackLow));
+                            pri = pri_, alt = Value();
+                            break;
+                        case Amx_Opcode::Heap:
+                            as_.Mov(ALT, Frame_Field(offsetof(Jit_Frame, hea)));
+                            as_.Alu(X86_Alu::Add, Frame_Field(offsetof(Jit_Frame, hea)), op);
+                            Check_Margin();
+                            as_.Alu(X86_Alu::Cmp, Frame_Field(offsetof(Jit_Frame, hea)), static_cast<cell>(amx_->hlw));
+                            as_.Jcc(X86_Cond::L, Abort_Label(Amx_Error::HeapLow));
+                            pri = pri_, alt = Value();
+                            break;
+                        case Amx_Opcode::Proc:
+                            as_.Mov(TMP, FRM);
+                            as_.Alu(X86_Alu::Sub, TMP, DAT);
+                            Push_Stack(TMP);
+                            as_.Mov(FRM, STK);
+                            Check_Margin();
+                            break;
+                        case Amx_Opcode::Ret:
+                            as_.Mov(FRM, X86_Mem{STK});
+                            as_.Alu(X86_Alu::Add, FRM, DAT);
+                            as_.Mov(TMP, X86_Mem{STK, 4});
+                            as_.Alu(X86_Alu::Add, STK, 8);
+                            Jump_Computed();
+                            break;
+                        case Amx_Opcode::Retn:
+                            as_.Mov(FRM, X86_Mem{STK});
+                            as_.Alu(X86_Alu::Add, FRM, DAT);
+                            as_.Mov(TMP, X86_Mem{STK, 4});
+                            as_.Mov(Frame_Field(offsetof(Jit_Frame, temp)), TMP);
+                            as_.Mov(TMP, X86_Mem{STK, 8});
+                            as_.Lea(STK, X86_Mem{STK, 12, TMP, 0});
+                            as_.Mov(TMP, Frame_Field(offsetof(Jit_Frame, temp)));
+                            Jump_Computed();
+                            break;
+                        case Amx_Opcode::Call:
+                            Push_Stack(next_cip);
+                            as_.Jmp(Target_Label(reader_.Get_Target(cip)));
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Call_Pri:
+                            Push_Stack(next_cip);
+                            as_.Mov(TMP, PRI);
+                            Jump_Computed();
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Jump:
+                            as_.Jmp(Target_Label(reader_.Get_Target(cip)));
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Jrel:
+                            as_.Jmp(Target_Label(next_cip + op));
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Jump_Pri:
+                            as_.Mov(TMP, PRI);
+                            Jump_Computed();
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Jzer:
+                        case Amx_Opcode::Jnz:
+                            as_.Test(PRI, PRI);
+                            as_.Jcc(opcode == Amx_Opcode::Jzer ? X86_Cond::E : X86_Cond::Ne, Target_Label(reader_.Get_Target(cip)));
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Jeq:
+                        case Amx_Opcode::Jneq:
+                        case Amx_Opcode::Jless:
+                        case Amx_Opcode::Jleq:
+                        case Amx_Opcode::Jgrtr:
+                        case Amx_Opcode::Jgeq:
+                        case Amx_Opcode::Jsless:
+                        case Amx_Opcode::Jsleq:
+                        case Amx_Opcode::Jsgrtr:
+                        case Amx_Opcode::Jsgeq: {
+                            static constexpr X86_Cond conditions[] = {X86_Cond::E, X86_Cond::Ne, X86_Cond::B, X86_Cond::Be, X86_Cond::A, X86_Cond::Ae, X86_Cond::L, X86_Cond::Le, X86_Cond::G, X86_Cond::Ge};
+
+                            as_.Alu(X86_Alu::Cmp, PRI, ALT);
+                            as_.Jcc(conditions[static_cast<cell>(opcode) - static_cast<cell>(Amx_Opcode::Jeq)], Target_Label(reader_.Get_Target(cip)));
+                            pri = pri_;
+                            break;
+                        }
+                        case Amx_Opcode::Shl:
+                            as_.Shift(4, PRI);
+                            break;
+                        case Amx_Opcode::Shr:
+                            as_.Shift(5, PRI);
+                            break;
+                        case Amx_Opcode::Sshr:
+                            as_.Shift(7, PRI);
+                            break;
+                        case Amx_Opcode::Shl_C_Pri:
+                            as_.Shift(4, PRI, op);
+                            break;
+                        case Amx_Opcode::Shl_C_Alt:
+                            as_.Shift(4, ALT, op);
+                            pri = pri_, alt = Value();
+                            break;
+                        case Amx_Opcode::Shr_C_Pri:
+                            as_.Shift(5, PRI, op);
+                            break;
+                        case Amx_Opcode::Shr_C_Alt:
+                            as_.Shift(5, ALT, op);
+                            pri = pri_, alt = Value();
+                            break;
+                        case Amx_Opcode::Smul:
+                        case Amx_Opcode::Umul:
+                            as_.Imul(PRI, ALT);
+                            break;
+                        case Amx_Opcode::Sdiv:
+                            Signed_Divide();
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Sdiv_Alt:
+                            as_.Byte(0x91);
+                            Signed_Divide();
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Udiv:
+                            Unsigned_Divide();
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Udiv_Alt:
+                            as_.Byte(0x91);
+                            Unsigned_Divide();
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Add:
+                            as_.Alu(X86_Alu::Add, PRI, ALT);
+                            break;
+                        case Amx_Opcode::Sub:
+                            as_.Alu(X86_Alu::Sub, PRI, ALT);
+                            break;
+                        case Amx_Opcode::Sub_Alt:
+                            as_.Unary(3, PRI);
+                            as_.Alu(X86_Alu::Add, PRI, ALT);
+                            break;
+                        case Amx_Opcode::And:
+                            as_.Alu(X86_Alu::And, PRI, ALT);
+                            break;
+                        case Amx_Opcode::Or:
+                            as_.Alu(X86_Alu::Or, PRI, ALT);
+                            break;
+                        case Amx_Opcode::Xor:
+                            as_.Alu(X86_Alu::Xor, PRI, ALT);
+                            break;
+                        case Amx_Opcode::Not:
+                            as_.Alu(X86_Alu::Xor, TMP, TMP);
+                            as_.Test(PRI, PRI);
+                            as_.Setcc(X86_Cond::E, TMP);
+                            as_.Mov(PRI, TMP);
+                            break;
+                        case Amx_Opcode::Neg:
+                            as_.Unary(3, PRI);
+                            break;
+                        case Amx_Opcode::Invert:
+                            as_.Unary(2, PRI);
+                            break;
+                        case Amx_Opcode::Add_C:
+                            as_.Alu(X86_Alu::Add, PRI, op);
+                            break;
+                        case Amx_Opcode::Smul_C:
+                            as_.Imul(PRI, PRI, op);
+                            break;
+                        case Amx_Opcode::Zero_Pri:
+                            as_.Mov(PRI, 0);
+                            pri = {Value::Constant, 0};
+                            break;
+                        case Amx_Opcode::Zero_Alt:
+                            as_.Mov(ALT, 0);
+                            pri = pri_, alt = {Value::Constant, 0};
+                            break;
+                        case Amx_Opcode::Zero:
+                            as_.Mov(Data(op), 0);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Zero_S:
+                            as_.Mov(X86_Mem{FRM, op}, 0);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Sign_Pri:
+                        case Amx_Opcode::Sign_Alt: {
+                            X86_Reg reg = opcode == Amx_Opcode::Sign_Pri ? PRI : ALT;
+                            int positive = as_.New_Label();
+
+                            as_.Test_Low_Byte(reg, 0x80);
+                            as_.Jcc(X86_Cond::E, positive);
+                            as_.Alu(X86_Alu::Or, reg, static_cast<cell>(~static_cast<cell>(0xFF)));
+                            as_.Bind(positive);
+
+                            if (reg == ALT)
+                                pri = pri_, alt = Value();
+
+                            break;
+                        }
+                        case Amx_Opcode::Eq: Compare(X86_Cond::E, PRI); break;
+                        case Amx_Opcode::Neq: Compare(X86_Cond::Ne, PRI); break;
+                        case Amx_Opcode::Less: Compare(X86_Cond::B, PRI); break;
+                        case Amx_Opcode::Leq: Compare(X86_Cond::Be, PRI); break;
+                        case Amx_Opcode::Grtr: Compare(X86_Cond::A, PRI); break;
+                        case Amx_Opcode::Geq: Compare(X86_Cond::Ae, PRI); break;
+                        case Amx_Opcode::Sless: Compare(X86_Cond::L, PRI); break;
+                        case Amx_Opcode::Sleq: Compare(X86_Cond::Le, PRI); break;
+                        case Amx_Opcode::Sgrtr: Compare(X86_Cond::G, PRI); break;
+                        case Amx_Opcode::Sgeq: Compare(X86_Cond::Ge, PRI); break;
+                        case Amx_Opcode::Eq_C_Pri: Compare(X86_Cond::E, PRI, &op); break;
+                        case Amx_Opcode::Eq_C_Alt: Compare(X86_Cond::E, ALT, &op); break;
+                        case Amx_Opcode::Inc_Pri:
+                        case Amx_Opcode::Dec_Pri:
+                            as_.Alu(opcode == Amx_Opcode::Inc_Pri ? X86_Alu::Add : X86_Alu::Sub, PRI, 1);
+                            break;
+                        case Amx_Opcode::Inc_Alt:
+                        case Amx_Opcode::Dec_Alt:
+                            as_.Alu(opcode == Amx_Opcode::Inc_Alt ? X86_Alu::Add : X86_Alu::Sub, ALT, 1);
+                            pri = pri_, alt = Value();
+                            break;
+                        case Amx_Opcode::Inc:
+                        case Amx_Opcode::Dec:
+                            as_.Alu(opcode == Amx_Opcode::Inc ? X86_Alu::Add : X86_Alu::Sub, Data(op), 1);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Inc_S:
+                        case Amx_Opcode::Dec_S:
+                            as_.Alu(opcode == Amx_Opcode::Inc_S ? X86_Alu::Add : X86_Alu::Sub, X86_Mem{FRM, op}, 1);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Inc_I:
+                        case Amx_Opcode::Dec_I:
+                            Check_Memory(PRI, pri_);
+                            as_.Alu(opcode == Amx_Opcode::Inc_I ? X86_Alu::Add : X86_Alu::Sub, Data(PRI), 1);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Movs:
+                            Check_Range(PRI, op);
+                            Check_Range(ALT, op);
+                            Call_Helper(reinterpret_cast<const void*>(Jit_Helper_Movs), op, PRI, true, true);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Cmps:
+                            Check_Range(PRI, op);
+                            Check_Range(ALT, op);
+                            Call_Helper(reinterpret_cast<const void*>(Jit_Helper_Cmps), op, PRI, true, false);
+                            break;
+                        case Amx_Opcode::Fill:
+                            Check_Range(ALT, op);
+                            Call_Helper(reinterpret_cast<const void*>(Jit_Helper_Fill), op, PRI, false, true);
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Halt:
+                            as_.Mov(Frame_Field(offsetof(Jit_Frame, halted)), 1);
+                            as_.Mov(Frame_Field(offsetof(Jit_Frame, cip)), next_cip);
+                            as_.Mov(TMP, op);
+                            as_.Jmp(exit_);
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Bounds:
+                            pri = {Value::Bounded, op};
+
+                            if (pri_.kind == Value::Constant && pri_.value >= 0 && pri_.value <= op) {
+                                ++folded_checks_;
+                                pri = pri_;
+                                break;
+                            }
+
+                            as_.Alu(X86_Alu::Cmp, PRI, op);
+                            as_.Jcc(X86_Cond::A, Abort_Label(Amx_Error::Bounds));
+                            break;
+                        case Amx_Opcode::Sysreq_Pri:
+                            Call_Callback(nullptr, next_cip);
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Sysreq_C: {
+                            AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(amx_->base);
+                            AMX_FUNCSTUBNT* natives = reinterpret_cast<AMX_FUNCSTUBNT*>(amx_->base + hdr->natives);
+                            int native_count = (hdr->libraries - hdr->natives) / hdr->defsize;
+
+                            if (direct_natives_ && op >= 0 && op < native_count && natives[op].address != 0)
+                                Call_Native(static_cast<uint32_t>(natives[op].address), next_cip);
+                            else
+                                Call_Callback(&op, next_cip);
+
+                            alt = Value();
+                            break;
+                        }
+                        case Amx_Opcode::Sysreq_D:
+                            Call_Native(static_cast<uint32_t>(op), next_cip);
+                            alt = Value();
+                            break;
+                        case Amx_Opcode::Switch: {
+                            cell table = reader_.Get_Target(cip);
+                            size_t table_cip = static_cast<size_t>(table) / sizeof(cell);
+
+                            if (table < 0 || (table & (sizeof(cell) - 1)) != 0 || table_cip >= starts_.size() || !starts_[table_cip] || reader_.Get_Opcode(table_cip) != Amx_Opcode::Casetbl) {
+                                as_.Jmp(Abort_Label(Amx_Error::InvInstr));
+                                alt = Value();
+                                break;
+                            }
+
+                            for (cell i = 0; i < reader_.Get_Operand(table_cip); ++i) {
+                                as_.Alu(X86_Alu::Cmp, PRI, reader_.Get_Operand(table_cip, 2 + 2 * static_cast<int>(i)));
+                                as_.Jcc(X86_Cond::E, Target_Label(reader_.Get_Target(table_cip, 3 + 2 * static_cast<int>(i))));
+                            }
+
+                            as_.Jmp(Target_Label(reader_.Get_Target(table_cip, 1)));
+                            alt = Value();
+                            break;
+                        }
+                        case Amx_Opcode::Swap_Pri:
+                        case Amx_Opcode::Swap_Alt: {
+                            X86_Reg reg = opcode == Amx_Opcode::Swap_Pri ? PRI : ALT;
+
+                            as_.Mov(TMP, X86_Mem{STK});
+                            as_.Mov(X86_Mem{STK}, reg);
+                            as_.Mov(reg, TMP);
+
+                            if (reg == ALT)
+                                pri = pri_, alt = Value();
+
+                            break;
+                        }
+                        case Amx_Opcode::Nop:
+                        case Amx_Opcode::Symtag:
+                        case Amx_Opcode::Srange:
+                            pri = pri_;
+                            break;
+                        case Amx_Opcode::Break: {
+                            int skip = as_.New_Label();
+
+                            as_.Mov(TMP, Frame_Field(offsetof(Jit_Frame, amx)));
+                            as_.Alu(X86_Alu::Cmp, Amx_Field(offsetof(AMX, debug)), 0);
+                            as_.Jcc(X86_Cond::E, skip);
+                            Save_State(next_cip);
+                            as_.Push(ALT);
+                            as_.Push(PRI);
+                            as_.Push(TMP);
+                            as_.Call(Amx_Field(offsetof(AMX, debug)));
+                            as_.Alu(X86_Alu::Add, X86_Reg::Esp, 4);
+                            as_.Mov(TMP, PRI);
+                            as_.Pop(PRI);
+                            as_.Pop(ALT);
+                            as_.Test(TMP, TMP);
+                            as_.Jcc(X86_Cond::Ne, Fail_Label(next_cip));
+                            as_.Bind(skip);
+                            alt = Value();
+                            break;
+                        }
+                        default:
+                            as_.Jmp(Abort_Label(Amx_Error::InvInstr));
+                            alt = Value();
+                            break;
+                    }
+
+                    pri_ = pri;
+                    alt_ = alt;
+                }
+
+                AMX* amx_;
+                Amx_Code_Reader reader_;
+                bool direct_natives_;
+                bool metered_;
+                X86_Emitter as_;
+                std::vector<uint8_t> starts_;
+                std::vector<uint8_t> targets_;
+                std::vector<int> cell_labels_;
+                std::vector<uint32_t> offsets_;
+                std::vector<Stub> stubs_;
+                std::vector<Meter_Stub> meter_stubs_;
+                std::vector<cell> block_lengths_;
+                const uint32_t* map_base_ = nullptr;
+                Value pri_, alt_;
+                cell code_size_ = 0;
+                cell static_end_ = 0;
+                int exit_ = -1;
+                size_t folded_checks_ = 0;
+        };
+    }
+
+    class Amx_Jit {
+        public:
+            static Amx_Jit& Instance() {
+                static Amx_Jit instance;
+
+                return instance;
+            }
+
+            void Enable() {
+                if (!enabled_.exchange(true, std::memory_order_acq_rel) && !announced_.exchange(true))
+                    Log("[SA-MP SDK] JIT: Enabled. Compiled scripts no longer run through amx_Exec, so amx_Exec hooks installed by other plugins will not see their calls.");
+            }
+
+            void Disable() {
+                enabled_.store(false, std::memory_order_release);
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE bool Is_Enabled() const {
+                return enabled_.load(std::memory_order_relaxed);
+            }
+
+            bool Compile(AMX* amx, const cell* opcode_list, bool direct_natives, bool metered = false) {
+                if (sizeof(void*) != sizeof(cell))
+                    return (Log("[SA-MP SDK] Warning: The AMX JIT requires a 32-bit host, scripts will stay interpreted."), false);
+
+                Detail::Jit_Compiler compiler(amx, opcode_list, direct_natives, metered);
+                int error;
+                std::unique_ptr<Detail::Jit_Program> program = compiler.Compile(&error);
+
+                if (!program)
+                    return (Log("[SA-MP SDK] Warning: Could not compile script at %p (error %d), it will stay interpreted.", static_cast<void*>(amx), error), false);
+
+                std::lock_guard<std::shared_mutex> lock(mtx_);
+                programs_[amx] = std::move(program);
+
+                return true;
+            }
+
+            [[nodiscard]] Detail::Jit_Program* Find(AMX* amx) {
+                if (SAMP_SDK_LIKELY(!Is_Enabled()))
+                    return nullptr;
+
+                std::shared_lock<std::shared_mutex> lock(mtx_);
+                auto it = programs_.find(amx);
+
+                return it != programs_.end() ? it->second.get() : nullptr;
+            }
+
+            void Release(AMX* amx) {
+                std::lock_guard<std::shared_mutex> lock(mtx_);
+                programs_.erase(amx);
+            }
+
+        private:
+            Amx_Jit() = default;
+            ~Amx_Jit() = default;
+
+            std::unordered_map<AMX*, std::unique_ptr<Detail::Jit_Program>> programs_;
+            std::shared_mutex mtx_;
+            std::atomic<bool> enabled_{false};
+            std::atomic<bool> announced_{false};
+    };
+}
\ No newline at end of file
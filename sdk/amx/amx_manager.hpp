@@ -50,22 +50,38 @@ namespace Samp_SDK {
                 return instance;
             }
 
+            using Observer_Func = void (*)(AMX* amx, bool loaded);
+
             void Add_Amx(AMX* amx) {
-                std::lock_guard<Mutex_Type> lock(mtx_);
+                {
+                    std::lock_guard<Mutex_Type> lock(mtx_);
 
-                loaded_amx_.push_back(amx);
-                generation_.fetch_add(1, std::memory_order_relaxed);
+                    loaded_amx_.push_back(amx);
+                    generation_.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                if (auto observer = observer_.load(std::memory_order_acquire))
+                    observer(amx, true);
             }
 
             void Remove_Amx(AMX* amx) {
-                std::lock_guard<Mutex_Type> lock(mtx_);
+                {
+                    std::lock_guard<Mutex_Type> lock(mtx_);
 
-                auto it = std::find(loaded_amx_.begin(), loaded_amx_.end(), amx);
+                    auto it = std::find(loaded_amx_.begin(), loaded_amx_.end(), amx);
 
-                if (it != loaded_amx_.end())
-                    loaded_amx_.erase(it);
-                
-                generation_.fetch_add(1, std::memory_order_relaxed);
+                    if (it != loaded_amx_.end())
+                        loaded_amx_.erase(it);
+
+                    generation_.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                if (auto observer = observer_.load(std::memory_order_acquire))
+                    observer(amx, false);
+            }
+
+            void Set_Observer(Observer_Func observer) {
+                observer_.store(observer, std::memory_order_release);
             }
 
             std::vector<AMX*> Get_Amx_Instances() {
@@ -94,6 +110,10 @@ namespace Samp_SDK {
                 return loaded_amx_.back();
             }
 
+            void Invalidate() {
+                generation_.fetch_add(1, std::memory_order_relaxed);
+            }
+
             uint32_t Get_Generation() const {
                 return generation_.load(std::memory_order_relaxed);
             }
@@ -109,5 +129,6 @@ namespace Samp_SDK {
             std::vector<AMX*> loaded_amx_;
             Mutex_Type mtx_;
             std::atomic<uint32_t> generation_{0};
+            std::atomic<Observer_Func> observer_{nullptr};
     };
 }
\ No newline at end of file
@@ -0,0 +1,218 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+//
+#include "amx_defs.h"
+
+namespace Samp_SDK {
+    enum class Amx_Opcode : cell {
+        None, Load_Pri, Load_Alt, Load_S_Pri, Load_S_Alt, Lref_Pri, Lref_Alt, Lref_S_Pri,
+        Lref_S_Alt, Load_I, Lodb_I, Const_Pri, Const_Alt, Addr_Pri, Addr_Alt, Stor_Pri,
+        Stor_Alt, Stor_S_Pri, Stor_S_Alt, Sref_Pri, Sref_Alt, Sref_S_Pri, Sref_S_Alt, Stor_I,
+        Strb_I, Lidx, Lidx_B, Idxaddr, Idxaddr_B, Align_Pri, Align_Alt, Lctrl,
+        Sctrl, Move_Pri, Move_Alt, Xchg, Push_Pri, Push_Alt, Push_R, Push_C,
+        Push, Push_S, Pop_Pri, Pop_Alt, Stack, Heap, Proc, Ret,
+        Retn, Call, Call_Pri, Jump, Jrel, Jzer, Jnz, Jeq,
+        Jneq, Jless, Jleq, Jgrtr, Jgeq, Jsless, Jsleq, Jsgrtr,
+        Jsgeq, Shl, Shr, Sshr, Shl_C_Pri, Shl_C_Alt, Shr_C_Pri, Shr_C_Alt,
+        Smul, Sdiv, Sdiv_Alt, Umul, Udiv, Udiv_Alt, Add, Sub,
+        Sub_Alt, And, Or, Xor, Not, Neg, Invert, Add_C,
+        Smul_C, Zero_Pri, Zero_Alt, Zero, Zero_S, Sign_Pri, Sign_Alt, Eq,
+        Neq, Less, Leq, Grtr, Geq, Sless, Sleq, Sgrtr,
+        Sgeq, Eq_C_Pri, Eq_C_Alt, Inc_Pri, Inc_Alt, Inc, Inc_S, Inc_I,
+        Dec_Pri, Dec_Alt, Dec, Dec_S, Dec_I, Movs, Cmps, Fill,
+        Halt, Bounds, Sysreq_Pri, Sysreq_C, File, Line, Symbol, Srange,
+        Jump_Pri, Switch, Casetbl, Swap_Pri, Swap_Alt, Push_Adr, Nop, Sysreq_D,
+        Symtag, Break,
+        Count
+    };
+
+    constexpr int AMX_OPCODE_COUNT = static_cast<int>(Amx_Opcode::Count);
+
+    namespace Detail {
+        constexpr int8_t AMX_VARIABLE_OPERANDS = -1;
+
+        constexpr int8_t AMX_OPCODE_OPERANDS[AMX_OPCODE_COUNT] = {
+            0, 1, 1, 1, 1, 1, 1, 1,
+            1, 0, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 0,
+            1, 0, 1, 0, 1, 1, 1, 1,
+            1, 0, 0, 0, 0, 0, 1, 1,
+            1, 1, 0, 0, 1, 1, 0, 0,
+            0, 1, 0, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1,
+            1, 0, 0, 0, 1, 1, 1, 1,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 1,
+            1, 0, 0, 1, 1, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 1, 1, 0, 0, 1, 1, 0,
+            0, 0, 1, 1, 0, 1, 1, 1,
+            1, 1, 0, 1, AMX_VARIABLE_OPERANDS, 2, AMX_VARIABLE_OPERANDS, 2,
+            0, 1, AMX_VARIABLE_OPERANDS, 0, 0, 1, 0, 1,
+            1, 0
+        };
+    }
+
+    inline int Get_Amx_Instruction_Cells(Amx_Opcode opcode, const cell* operands, size_t remaining_cells) {
+        if (static_cast<cell>(opcode) < 0 || static_cast<cell>(opcode) >= AMX_OPCODE_COUNT)
+            return 0;
+
+        int8_t count = Detail::AMX_OPCODE_OPERANDS[static_cast<cell>(opcode)];
+
+        if (count != Detail::AMX_VARIABLE_OPERANDS)
+            return 1 + count;
+
+        if (remaining_cells < 2 || operands[0] < 0 || static_cast<size_t>(operands[0]) > remaining_cells)
+            return 0;
+
+        if (opcode == Amx_Opcode::Casetbl)
+            return 2 + 2 * static_cast<int>(operands[0]) + 1;
+
+        return 2 + static_cast<int>(operands[0] / static_cast<cell>(sizeof(cell)));
+    }
+
+    inline int Get_Amx_Instruction_Cells(const cell* code, size_t code_cells, size_t cip) {
+        if (cip >= code_cells)
+            return 0;
+
+        return Get_Amx_Instruction_Cells(static_cast<Amx_Opcode>(code[cip]), code + cip + 1, code_cells - cip);
+    }
+
+    class Amx_Code_Reader {
+        public:
+            Amx_Code_Reader(AMX* amx, const cell* opcode_list = nullptr) {
+                AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(amx->base);
+
+                code_ = reinterpret_cast<cell*>(amx->base + hdr->cod);
+                cell_count_ = static_cast<size_t>(hdr->dat - hdr->cod) / sizeof(cell);
+                relocated_ = (amx->flags & AMX_FLAG_RELOC) != 0;
+
+                if (!relocated_)
+                    return;
+
+                if (!opcode_list) {
+                    cell_count_ = 0;
+
+                    return;
+                }
+
+                opcode_list_ = opcode_list;
+
+                for (int pass = 0; pass < 2; ++pass) {
+                    for (cell op = 0; op < AMX_OPCODE_COUNT; ++op) {
+                        auto opcode = static_cast<Amx_Opcode>(op);
+                        bool obsolete = opcode == Amx_Opcode::None || opcode == Amx_Opcode::File || opcode == Amx_Opcode::Line || opcode == Amx_Opcode::Symbol;
+
+                        if (obsolete != (pass == 1))
+                            continue;
+
+                        auto it = std::lower_bound(handlers_.begin(), handlers_.end(), std::make_pair(opcode_list[op], Amx_Opcode::None));
+
+                        if (it == handlers_.end() || it->first != opcode_list[op])
+                            handlers_.insert(it, {opcode_list[op], opcode});
+                    }
+                }
+            }
+
+            [[nodiscard]] bool Is_Valid() const {
+                return cell_count_ > 0;
+            }
+
+            [[nodiscard]] bool Is_Relocated() const {
+                return relocated_;
+            }
+
+            [[nodiscard]] size_t Get_Cell_Count() const {
+                return cell_count_;
+            }
+
+            [[nodiscard]] cell* Get_Code() const {
+                return code_;
+            }
+
+            [[nodiscard]] Amx_Opcode Get_Opcode(size_t cip) const {
+                if (cip >= cell_count_)
+                    return Amx_Opcode::Count;
+
+                if (!relocated_)
+                    return code_[cip] >= 0 && code_[cip] < AMX_OPCODE_COUNT ? static_cast<Amx_Opcode>(code_[cip]) : Amx_Opcode::Count;
+
+                auto it = std::lower_bound(handlers_.begin(), handlers_.end(), std::make_pair(code_[cip], Amx_Opcode::None));
+
+                return it != handlers_.end() && it->first == code_[cip] ? it->second : Amx_Opcode::Count;
+            }
+
+            [[nodiscard]] int Get_Size(size_t cip) const {
+                Amx_Opcode opcode = Get_Opcode(cip);
+
+                if (opcode == Amx_Opcode::Count)
+                    return 0;
+
+                int size = Get_Amx_Instruction_Cells(opcode, code_ + cip + 1, cell_count_ - cip);
+
+                return cip + static_cast<size_t>(size) <= cell_count_ ? size : 0;
+            }
+
+            [[nodiscard]] cell Get_Operand(size_t cip, int index = 0) const {
+                return code_[cip + 1 + static_cast<size_t>(index)];
+            }
+
+            [[nodiscard]] cell Get_Target(size_t cip, int index = 0) const {
+                cell target = Get_Operand(cip, index);
+
+                return relocated_ ? static_cast<cell>(static_cast<ucell>(target) - static_cast<ucell>(reinterpret_cast<uintptr_t>(code_))) : target;
+            }
+
+            [[nodiscard]] cell Encode_Opcode(Amx_Opcode opcode) const {
+                return relocated_ ? opcode_list_[static_cast<cell>(opcode)] : static_cast<cell>(opcode);
+            }
+
+            [[nodiscard]] cell Encode_Target(cell offset) const {
+                return relocated_ ? static_cast<cell>(static_cast<ucell>(offset) + static_cast<ucell>(reinterpret_cast<uintptr_t>(code_))) : offset;
+            }
+
+        private:
+            cell* code_ = nullptr;
+            size_t cell_count_ = 0;
+            bool relocated_ = false;
+            const cell* opcode_list_ = nullptr;
+            std::vector<std::pair<cell, Amx_Opcode>> handlers_;
+    };
+}
\ No newline at end of file
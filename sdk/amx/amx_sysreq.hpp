@@ -0,0 +1,143 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+//
+#include "amx_defs.h"
+#include "amx_opcodes.hpp"
+#include "../core/platform.hpp"
+#include "../utils/logger.hpp"
+
+namespace Samp_SDK {
+    class Amx_Sysreq_Rewriter {
+        public:
+            static Amx_Sysreq_Rewriter& Instance() {
+                static Amx_Sysreq_Rewriter instance;
+
+                return instance;
+            }
+
+            void Enable() {
+                enabled_.store(true, std::memory_order_release);
+            }
+
+            void Disable() {
+                enabled_.store(false, std::memory_order_release);
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE bool Is_Enabled() const {
+                return enabled_.load(std::memory_order_relaxed);
+            }
+
+            int Rewrite(AMX* amx, const cell* opcode_list) {
+                Amx_Code_Reader reader(amx, opcode_list);
+
+                if (!reader.Is_Valid())
+                    return (Log("[SA-MP SDK] Warning: Could not decode script at %p, native calls were not rewritten.", static_cast<void*>(amx)), 0);
+
+                AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(amx->base);
+                AMX_FUNCSTUBNT* natives = reinterpret_cast<AMX_FUNCSTUBNT*>(amx->base + hdr->natives);
+                cell native_count = (hdr->libraries - hdr->natives) / hdr->defsize;
+                cell sysreq_d = reader.Encode_Opcode(Amx_Opcode::Sysreq_D);
+                cell* code = reader.Get_Code();
+                int rewritten = 0;
+
+                for (size_t cip = 0; cip < reader.Get_Cell_Count();) {
+                    int size = reader.Get_Size(cip);
+
+                    if (size <= 0)
+                        break;
+
+                    if (reader.Get_Opcode(cip) == Amx_Opcode::Sysreq_C) {
+                        cell index = reader.Get_Operand(cip);
+
+                        if (index >= 0 && index < native_count && natives[index].address != 0) {
+                            code[cip] = sysreq_d;
+                            code[cip + 1] = static_cast<cell>(natives[index].address);
+                            ++rewritten;
+                        }
+                    }
+
+                    cip += static_cast<size_t>(size);
+                }
+
+                amx->sysreq_d = sysreq_d;
+
+                return rewritten;
+            }
+
+            int Repoint(AMX* amx, const cell* opcode_list, const std::unordered_map<ucell, ucell>& moved) {
+                if (!amx->sysreq_d || moved.empty())
+                    return 0;
+
+                Amx_Code_Reader reader(amx, opcode_list);
+
+                if (!reader.Is_Valid())
+                    return 0;
+
+                cell* code = reader.Get_Code();
+                int repointed = 0;
+
+                for (size_t cip = 0; cip < reader.Get_Cell_Count();) {
+                    int size = reader.Get_Size(cip);
+
+                    if (size <= 0)
+                        break;
+
+                    if (reader.Get_Opcode(cip) == Amx_Opcode::Sysreq_D) {
+                        auto it = moved.find(static_cast<ucell>(reader.Get_Operand(cip)));
+
+                        if (it != moved.end()) {
+                            code[cip + 1] = static_cast<cell>(it->second);
+                            ++repointed;
+                        }
+                    }
+
+                    cip += static_cast<size_t>(size);
+                }
+
+                return repointed;
+            }
+
+        private:
+            Amx_Sysreq_Rewriter() = default;
+            ~Amx_Sysreq_Rewriter() = default;
+
+            std::atomic<bool> enabled_{false};
+    };
+}
\ No newline at end of file
@@ -60,11 +60,11 @@ namespace Samp_SDK {
                 return pPluginData;
             }
 
-            void Log(const char* format) const {
+            void Log(const char* message) const {
                 if (!logprintf_ptr)
                     return;
                 
-                logprintf_ptr(format);
+                logprintf_ptr("%s", message);
             }
             
         private:
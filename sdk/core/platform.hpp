@@ -96,4 +96,12 @@
     #define SAMP_SDK_FORCE_INLINE __forceinline
 #elif defined(SAMP_SDK_COMPILER_GCC_OR_CLANG)
     #define SAMP_SDK_FORCE_INLINE __attribute__((always_inline)) inline
+#endif
+
+#if defined(SAMP_SDK_COMPILER_GCC_OR_CLANG)
+    #define SAMP_SDK_LIKELY(x) __builtin_expect(!!(x), 1)
+    #define SAMP_SDK_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+    #define SAMP_SDK_LIKELY(x) (x)
+    #define SAMP_SDK_UNLIKELY(x) (x)
 #endif
\ No newline at end of file
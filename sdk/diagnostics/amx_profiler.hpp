@@ -0,0 +1,453 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+//
+#include "../amx/amx_api.hpp"
+#include "../amx/amx_defs.h"
+#include "../amx/amx_opcodes.hpp"
+#include "../core/platform.hpp"
+#include "../hooks/interceptor_manager.hpp"
+#include "../utils/logger.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        constexpr uint16_t AMX_DBG_MAGIC = 0xF1EF;
+        constexpr size_t AMX_DBG_HEADER_SIZE = 22;
+        constexpr char AMX_DBG_IDENT_FUNCTION = 9;
+        constexpr int PROFILER_MAX_DEPTH = 64;
+
+        struct Profiler_Symbol {
+            ucell start;
+            ucell end;
+            std::string name;
+        };
+
+        struct Profiler_Line {
+            ucell address;
+            int32_t line;
+            int32_t file;
+        };
+
+        class Profiler_Symbols {
+            public:
+                bool Load_Debug_Info(const std::string& path) {
+                    std::ifstream file(path, std::ios::binary);
+
+                    if (!file)
+                        return false;
+
+                    std::vector<unsigned char> image((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+                    int32_t amx_size;
+
+                    if (image.size() < sizeof(AMX_HEADER) || (std::memcpy(&amx_size, image.data(), sizeof(amx_size)), amx_size <= 0) || image.size() < static_cast<size_t>(amx_size) + AMX_DBG_HEADER_SIZE)
+                        return false;
+
+                    cursor_ = image.data() + amx_size;
+                    end_ = image.data() + image.size();
+
+                    if (Read<uint16_t>(cursor_ + 4) != AMX_DBG_MAGIC)
+                        return false;
+
+                    int16_t file_count = Read<int16_t>(cursor_ + 10);
+                    int16_t line_count = Read<int16_t>(cursor_ + 12);
+                    int16_t symbol_count = Read<int16_t>(cursor_ + 14);
+                    std::vector<std::pair<ucell, int32_t>> file_starts;
+
+                    cursor_ += AMX_DBG_HEADER_SIZE;
+
+                    for (int16_t i = 0; i < file_count; ++i) {
+                        if (!Has(sizeof(ucell)))
+                            return false;
+
+                        file_starts.push_back({Read<ucell>(cursor_), static_cast<int32_t>(files_.size())});
+                        cursor_ += sizeof(ucell);
+                        files_.push_back(Read_String());
+                    }
+
+                    for (int16_t i = 0; i < line_count; ++i) {
+                        if (!Has(sizeof(ucell) + sizeof(int32_t)))
+                            return false;
+
+                        ucell address = Read<ucell>(cursor_);
+                        auto file_it = std::upper_bound(file_starts.begin(), file_starts.end(), std::make_pair(address, INT32_MAX));
+
+                        lines_.push_back({address, Read<int32_t>(cursor_ + sizeof(ucell)) + 1, file_it == file_starts.begin() ? -1 : std::prev(file_it)->second});
+                        cursor_ += sizeof(ucell) + sizeof(int32_t);
+                    }
+
+                    for (int16_t i = 0; i < symbol_count; ++i) {
+                        if (!Has(3 * sizeof(ucell) + 6))
+                            return false;
+
+                        ucell code_start = Read<ucell>(cursor_ + sizeof(ucell) + 2);
+                        ucell code_end = Read<ucell>(cursor_ + 2 * sizeof(ucell) + 2);
+                        char ident = static_cast<char>(cursor_[3 * sizeof(ucell) + 2]);
+                        int16_t dim = Read<int16_t>(cursor_ + 3 * sizeof(ucell) + 4);
+
+                        cursor_ += 3 * sizeof(ucell) + 6;
+
+                        std::string name = Read_String();
+
+                        if (dim < 0 || !Has(static_cast<size_t>(dim) * (2 + sizeof(ucell))))
+                            return false;
+
+                        cursor_ += static_cast<size_t>(dim) * (2 + sizeof(ucell));
+
+                        if (ident == AMX_DBG_IDENT_FUNCTION)
+                            symbols_.push_back({code_start, code_end, std::move(name)});
+                    }
+
+                    std::sort(symbols_.begin(), symbols_.end(), [](const Profiler_Symbol& a, const Profiler_Symbol& b) { return a.start < b.start; });
+                    std::stable_sort(lines_.begin(), lines_.end(), [](const Profiler_Line& a, const Profiler_Line& b) { return a.address < b.address; });
+
+                    return !symbols_.empty();
+                }
+
+                void Scan_Code(AMX* amx, const cell* opcode_list) {
+                    Amx_Code_Reader reader(amx, opcode_list);
+                    AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(amx->base);
+                    AMX_FUNCSTUBNT* publics = reinterpret_cast<AMX_FUNCSTUBNT*>(amx->base + hdr->publics);
+                    int public_count = (hdr->natives - hdr->publics) / hdr->defsize;
+
+                    for (size_t cip = 0; reader.Is_Valid() && cip < reader.Get_Cell_Count();) {
+                        int size = reader.Get_Size(cip);
+
+                        if (size <= 0)
+                            break;
+
+                        if (reader.Get_Opcode(cip) == Amx_Opcode::Proc) {
+                            ucell address = static_cast<ucell>(cip * sizeof(cell));
+                            std::string name;
+
+                            for (int i = 0; i < public_count && name.empty(); ++i) {
+                                if (publics[i].address == address)
+                                    name = reinterpret_cast<const char*>(amx->base + publics[i].nameofs);
+                            }
+
+                            if (name.empty()) {
+                                char buffer[32];
+
+                                std::snprintf(buffer, sizeof(buffer), address == static_cast<ucell>(hdr->cip) ? "main" : "func@0x%X", static_cast<unsigned int>(address));
+                                name = buffer;
+                            }
+
+                            if (!symbols_.empty())
+                                symbols_.back().end = address;
+
+                            symbols_.push_back({address, address, std::move(name)});
+                        }
+
+                        cip += static_cast<size_t>(size);
+                    }
+
+                    if (!symbols_.empty())
+                        symbols_.back().end = static_cast<ucell>(reader.Get_Cell_Count() * sizeof(cell));
+                }
+
+                [[nodiscard]] int32_t Find_Symbol(cell address) const {
+                    auto it = std::upper_bound(symbols_.begin(), symbols_.end(), static_cast<ucell>(address), [](ucell value, const Profiler_Symbol& symbol) { return value < symbol.start; });
+
+                    return it == symbols_.begin() ? -1 : static_cast<int32_t>(std::distance(symbols_.begin(), it) - 1);
+                }
+
+                [[nodiscard]] int32_t Find_Line(cell address) const {
+                    auto it = std::upper_bound(lines_.begin(), lines_.end(), static_cast<ucell>(address), [](ucell value, const Profiler_Line& line) { return value < line.address; });
+
+                    return it == lines_.begin() ? -1 : static_cast<int32_t>(std::distance(lines_.begin(), it) - 1);
+                }
+
+                [[nodiscard]] std::string Get_Symbol_Name(int32_t index) const {
+                    return index >= 0 ? symbols_[static_cast<size_t>(index)].name : std::string("??");
+                }
+
+                [[nodiscard]] std::string Get_Line_Name(int32_t index) const {
+                    const Profiler_Line& line = lines_[static_cast<size_t>(index)];
+
+                    return (line.file >= 0 ? files_[static_cast<size_t>(line.file)] : std::string("??")) + ':' + std::to_string(line.line);
+                }
+
+            private:
+                template<typename T>
+                static T Read(const unsigned char* p) {
+                    T value;
+                    std::memcpy(&value, p, sizeof(T));
+
+                    return value;
+                }
+
+                bool Has(size_t bytes) const {
+                    return static_cast<size_t>(end_ - cursor_) >= bytes;
+                }
+
+                std::string Read_String() {
+                    const unsigned char* start = cursor_;
+
+                    while (cursor_ < end_ && *cursor_)
+                        ++cursor_;
+
+                    std::string text(reinterpret_cast<const char*>(start), static_cast<size_t>(cursor_ - start));
+
+                    if (cursor_ < end_)
+                        ++cursor_;
+
+                    return text;
+                }
+
+                std::vector<Profiler_Symbol> symbols_;
+                std::vector<Profiler_Line> lines_;
+                std::vector<std::string> files_;
+                const unsigned char* cursor_ = nullptr;
+                const unsigned char* end_ = nullptr;
+        };
+
+        struct Profiler_Target {
+            AMX* amx;
+            AMX_DEBUG previous;
+            std::string label;
+            Profiler_Symbols symbols;
+            uint64_t next_sample_ns = 0;
+            std::map<std::vector<int32_t>, uint64_t> stacks;
+        };
+    }
+
+    class Amx_Profiler {
+        public:
+            static constexpr std::chrono::microseconds DEFAULT_INTERVAL{1000};
+
+            static Amx_Profiler& Instance() {
+                static Amx_Profiler instance;
+
+                return instance;
+            }
+
+            bool Attach(AMX* amx, const std::string& amx_path = "") {
+                auto target = std::make_unique<Detail::Profiler_Target>();
+
+                target->amx = amx;
+                target->previous = amx->debug;
+                target->label = amx_path.empty() ? "amx" : amx_path.substr(amx_path.find_last_of("/\\") + 1);
+
+                if (amx_path.empty() || !target->symbols.Load_Debug_Info(amx_path)) {
+                    target->symbols = Detail::Profiler_Symbols();
+                    target->symbols.Scan_Code(amx, Detail::Get_Amx_Opcode_List(amx));
+                }
+
+                std::lock_guard<std::shared_mutex> lock(mtx_);
+
+                if (Find(amx))
+                    return (Log("[SA-MP SDK] Warning: The profiler is already attached to script '%s'.", target->label.c_str()), false);
+
+                if (amx::Set_Debug_Hook(amx, Debug_Hook) != static_cast<int>(Amx_Error::None))
+                    return (Log("[SA-MP SDK] Error: Could not install the profiler debug hook on script '%s'.", target->label.c_str()), false);
+
+                forwards_.erase(amx);
+                targets_.push_back(std::move(target));
+
+                return true;
+            }
+
+            void Detach(AMX* amx) {
+                std::lock_guard<std::shared_mutex> lock(mtx_);
+
+                for (auto it = targets_.begin(); it != targets_.end(); ++it) {
+                    if ((*it)->amx == amx) {
+                        Unlink(amx, (*it)->previous);
+                        targets_.erase(it);
+
+                        return;
+                    }
+                }
+            }
+
+            void Detach_All() {
+                std::lock_guard<std::shared_mutex> lock(mtx_);
+
+                for (const auto& target : targets_)
+                    Unlink(target->amx, target->previous);
+
+                targets_.clear();
+            }
+
+            void Start(std::chrono::microseconds interval = DEFAULT_INTERVAL) {
+                std::lock_guard<std::shared_mutex> lock(mtx_);
+
+                interval_ns_ = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count());
+
+                for (const auto& target : targets_)
+                    target->stacks.clear();
+
+                enabled_.store(true, std::memory_order_release);
+            }
+
+            void Stop() {
+                enabled_.store(false, std::memory_order_release);
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE bool Is_Enabled() const {
+                return enabled_.load(std::memory_order_relaxed);
+            }
+
+            bool Write(const std::string& path) {
+                std::FILE* file = std::fopen(path.c_str(), "wb");
+
+                if (!file)
+                    return (Log("[SA-MP SDK] Error: Could not open profile file '%s' for writing.", path.c_str()), false);
+
+                std::shared_lock<std::shared_mutex> lock(mtx_);
+
+                for (const auto& target : targets_) {
+                    for (const auto& stack : target->stacks) {
+                        std::fputs(target->label.c_str(), file);
+
+                        for (size_t i = 0; i + 1 < stack.first.size(); ++i)
+                            std::fprintf(file, ";%s", target->symbols.Get_Symbol_Name(stack.first[i]).c_str());
+
+                        if (stack.first.back() >= 0)
+                            std::fprintf(file, ";%s", target->symbols.Get_Line_Name(stack.first.back()).c_str());
+
+                        std::fprintf(file, " %llu\n", static_cast<unsigned long long>(stack.second));
+                    }
+                }
+
+                return std::fclose(file) == 0;
+            }
+
+        private:
+            Amx_Profiler() = default;
+            ~Amx_Profiler() = default;
+            Amx_Profiler(const Amx_Profiler&) = delete;
+            Amx_Profiler& operator=(const Amx_Profiler&) = delete;
+
+            void Unlink(AMX* amx, AMX_DEBUG previous) {
+                if (amx->debug == Debug_Hook)
+                    amx::Set_Debug_Hook(amx, previous);
+                else if (!Exec_Budget::Instance().Unlink_Debug_Hook(amx, Debug_Hook, previous))
+                    forwards_[amx] = previous;
+            }
+
+            AMX_DEBUG Find_Previous(AMX* amx) {
+                if (Detail::Profiler_Target* target = Find(amx))
+                    return target->previous;
+
+                auto it = forwards_.find(amx);
+
+                return it != forwards_.end() ? it->second : nullptr;
+            }
+
+            static int SAMP_SDK_CDECL Debug_Hook(AMX* amx) {
+                Amx_Profiler& profiler = Instance();
+                AMX_DEBUG previous = nullptr;
+
+                if (!profiler.Is_Enabled()) {
+                    std::shared_lock<std::shared_mutex> lock(profiler.mtx_);
+                    previous = profiler.Find_Previous(amx);
+                }
+                else {
+                    std::lock_guard<std::shared_mutex> lock(profiler.mtx_);
+                    Detail::Profiler_Target* target = profiler.Find(amx);
+
+                    if (target) {
+                        uint64_t now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+
+                        if (now >= target->next_sample_ns) {
+                            target->next_sample_ns = now + profiler.interval_ns_;
+                            Sample(*target);
+                        }
+                    }
+
+                    previous = profiler.Find_Previous(amx);
+                }
+
+                return previous ? previous(amx) : static_cast<int>(Amx_Error::None);
+            }
+
+            static void Sample(Detail::Profiler_Target& target) {
+                AMX* amx = target.amx;
+                AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(amx->base);
+                unsigned char* data = amx->data ? amx->data : amx->base + hdr->dat;
+                cell code_size = hdr->dat - hdr->cod;
+                std::vector<int32_t> stack;
+
+                stack.push_back(target.symbols.Find_Line(amx->cip));
+                stack.push_back(target.symbols.Find_Symbol(amx->cip));
+
+                for (cell frm = amx->frm; static_cast<int>(stack.size()) <= Detail::PROFILER_MAX_DEPTH && frm >= amx->stk && frm <= amx->stp - 2 * static_cast<cell>(sizeof(cell)) && (frm & (sizeof(cell) - 1)) == 0;) {
+                    cell return_address, previous_frm;
+
+                    std::memcpy(&previous_frm, data + frm, sizeof(cell));
+                    std::memcpy(&return_address, data + frm + sizeof(cell), sizeof(cell));
+
+                    if (return_address <= 0 || return_address >= code_size || previous_frm <= frm)
+                        break;
+
+                    stack.push_back(target.symbols.Find_Symbol(return_address));
+                    frm = previous_frm;
+                }
+
+                std::reverse(stack.begin(), stack.end());
+                ++target.stacks[stack];
+            }
+
+            Detail::Profiler_Target* Find(AMX* amx) {
+                for (const auto& target : targets_) {
+                    if (target->amx == amx)
+                        return target.get();
+                }
+
+                return nullptr;
+            }
+
+            std::vector<std::unique_ptr<Detail::Profiler_Target>> targets_;
+            uint64_t interval_ns_ = 1000000;
+            std::unordered_map<AMX*, AMX_DEBUG> forwards_;
+            std::atomic<bool> enabled_{false};
+            std::shared_mutex mtx_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+//
+#include "../amx/amx_defs.h"
+#include "../core/platform.hpp"
+#include "tracer.hpp"
+#include "watchdog.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        class Call_Scope {
+            public:
+                SAMP_SDK_FORCE_INLINE Call_Scope(Trace_Category category, const char* name, AMX* amx = nullptr) {
+                    if (SAMP_SDK_UNLIKELY(Tracer::Instance().Is_Enabled() || Watchdog::Instance().Is_Enabled()))
+                        Begin(category, name ? name : "?", amx);
+                }
+
+                SAMP_SDK_FORCE_INLINE Call_Scope(Trace_Category category, uint32_t hash, const std::string* name, AMX* amx = nullptr) {
+                    if (SAMP_SDK_UNLIKELY(Tracer::Instance().Is_Enabled() || Watchdog::Instance().Is_Enabled()) && name)
+                        Begin(category, Tracer::Instance().Intern(hash, *name), amx);
+                }
+
+                SAMP_SDK_FORCE_INLINE ~Call_Scope() {
+                    if (SAMP_SDK_LIKELY(!active_))
+                        return;
+
+                    if (traced_)
+                        Tracer::Instance().Record(frame_.category, frame_.name, frame_.start_ns);
+
+                    if (watched_)
+                        Watchdog::Instance().Get_Slot().Store(previous_frame_);
+                }
+
+                Call_Scope(const Call_Scope&) = delete;
+                Call_Scope& operator=(const Call_Scope&) = delete;
+
+            private:
+                void Begin(Trace_Category category, const char* name, AMX* amx) {
+                    frame_ = {name, amx, category, Tracer::Instance().Now(), (category == Trace_Category::Native && amx) ? amx->cip : 0};
+                    traced_ = Tracer::Instance().Is_Enabled();
+                    watched_ = Watchdog::Instance().Is_Enabled() && Watchdog::Is_Server_Thread();
+                    active_ = traced_ || watched_;
+
+                    if (watched_) {
+                        auto& slot = Watchdog::Instance().Get_Slot();
+
+                        previous_frame_ = slot.Load_Local();
+                        slot.Store(frame_);
+                    }
+                }
+
+                Watchdog_Frame frame_;
+                Watchdog_Frame previous_frame_;
+                bool active_ = false;
+                bool traced_ = false;
+                bool watched_ = false;
+        };
+    }
+}
\ No newline at end of file
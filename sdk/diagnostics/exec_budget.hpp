@@ -0,0 +1,249 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+//
+#include "../amx/amx_api.hpp"
+#include "../amx/amx_defs.h"
+#include "../amx/amx_jit.hpp"
+#include "../core/platform.hpp"
+#include "../utils/logger.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        struct Budget_Target {
+            AMX_DEBUG previous = nullptr;
+            Jit_Meter meter{};
+            uint64_t limit = 0;
+            int depth = 0;
+            bool hooked = false;
+            bool counting_breaks = false;
+            bool reported = false;
+        };
+    }
+
+    class Exec_Budget {
+        public:
+            static constexpr uint64_t UNLIMITED = UINT64_MAX;
+
+            static Exec_Budget& Instance() {
+                static Exec_Budget instance;
+
+                return instance;
+            }
+
+            void Enable(uint64_t default_limit, Amx_Error error = Amx_Error::Exit) {
+                if (error == Amx_Error::None || error == Amx_Error::Sleep) {
+                    Log("[SA-MP SDK] Warning: Error code %d cannot abort a script, the instruction budget will use %d instead.", static_cast<int>(error), static_cast<int>(Amx_Error::Exit));
+                    error = Amx_Error::Exit;
+                }
+
+                default_limit_.store(default_limit, std::memory_order_relaxed);
+                error_.store(static_cast<cell>(error), std::memory_order_relaxed);
+                enabled_.store(true, std::memory_order_release);
+            }
+
+            void Disable() {
+                enabled_.store(false, std::memory_order_release);
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE bool Is_Enabled() const {
+                return enabled_.load(std::memory_order_relaxed);
+            }
+
+            void Set_Limit(AMX* amx, uint64_t limit) {
+                std::lock_guard<std::shared_mutex> lock(mtx_);
+                auto& target = targets_[amx];
+
+                if (!target)
+                    target = std::make_unique<Detail::Budget_Target>();
+
+                target->limit = limit;
+            }
+
+            Detail::Budget_Target* Begin(AMX* amx, bool interpreted) {
+                Detail::Budget_Target* target = Find(amx);
+
+                if (!target || (interpreted && !target->hooked))
+                    target = Install(amx, interpreted);
+
+                if (target->depth++ == 0) {
+                    uint64_t limit = target->limit ? target->limit : default_limit_.load(std::memory_order_relaxed);
+
+                    target->meter.remaining = limit > static_cast<uint64_t>(INT64_MAX) ? INT64_MAX : static_cast<int64_t>(limit);
+                    target->meter.cip = 0;
+                    target->meter.error = error_.load(std::memory_order_relaxed);
+                    target->counting_breaks = interpreted;
+                    target->reported = false;
+                }
+
+                return target;
+            }
+
+            void End(Detail::Budget_Target* target) {
+                if (--target->depth == 0)
+                    target->counting_breaks = false;
+            }
+
+            void Release(AMX* amx) {
+                std::lock_guard<std::shared_mutex> lock(mtx_);
+                auto it = targets_.find(amx);
+
+                if (it == targets_.end())
+                    return;
+
+                if (it->second->hooked && amx->debug == Debug_Hook)
+                    amx::Set_Debug_Hook(amx, it->second->previous);
+
+                targets_.erase(it);
+            }
+
+            bool Unlink_Debug_Hook(AMX* amx, AMX_DEBUG hook, AMX_DEBUG replacement) {
+                std::lock_guard<std::shared_mutex> lock(mtx_);
+                auto it = targets_.find(amx);
+
+                if (it == targets_.end() || !it->second->hooked || it->second->previous != hook)
+                    return false;
+
+                it->second->previous = replacement;
+
+                return true;
+            }
+
+            void Release_All() {
+                std::lock_guard<std::shared_mutex> lock(mtx_);
+
+                for (auto& [amx, target] : targets_) {
+                    if (target->hooked && amx->debug == Debug_Hook)
+                        amx::Set_Debug_Hook(amx, target->previous);
+                }
+
+                targets_.clear();
+            }
+
+        private:
+            Exec_Budget() = default;
+            ~Exec_Budget() = default;
+
+            Detail::Budget_Target* Find(AMX* amx) {
+                std::shared_lock<std::shared_mutex> lock(mtx_);
+                auto it = targets_.find(amx);
+
+                return it != targets_.end() ? it->second.get() : nullptr;
+            }
+
+            Detail::Budget_Target* Install(AMX* amx, bool interpreted) {
+                std::lock_guard<std::shared_mutex> lock(mtx_);
+                auto& target = targets_[amx];
+
+                if (!target)
+                    target = std::make_unique<Detail::Budget_Target>();
+
+                if (interpreted && !target->hooked) {
+                    target->previous = amx->debug;
+
+                    if (amx::Set_Debug_Hook(amx, Debug_Hook) == static_cast<int>(Amx_Error::None))
+                        target->hooked = true;
+                    else
+                        Log("[SA-MP SDK] Error: Could not install the instruction budget hook on script %p.", static_cast<void*>(amx));
+                }
+
+                return target.get();
+            }
+
+            static int SAMP_SDK_CDECL Debug_Hook(AMX* amx) {
+                Detail::Budget_Target* target = Instance().Find(amx);
+
+                if (!target)
+                    return static_cast<int>(Amx_Error::None);
+
+                if (target->counting_breaks && --target->meter.remaining < 0) {
+                    target->meter.cip = amx->cip;
+
+                    return target->meter.error;
+                }
+
+                return target->previous ? target->previous(amx) : static_cast<int>(Amx_Error::None);
+            }
+
+            std::unordered_map<AMX*, std::unique_ptr<Detail::Budget_Target>> targets_;
+            std::shared_mutex mtx_;
+            std::atomic<uint64_t> default_limit_{UNLIMITED};
+            std::atomic<cell> error_{static_cast<cell>(Amx_Error::Exit)};
+            std::atomic<bool> enabled_{false};
+    };
+
+    namespace Detail {
+        class Budget_Scope {
+            public:
+                SAMP_SDK_FORCE_INLINE Budget_Scope(AMX* amx, bool interpreted) {
+                    if (SAMP_SDK_UNLIKELY(Exec_Budget::Instance().Is_Enabled()))
+                        target_ = Exec_Budget::Instance().Begin(amx, interpreted);
+                }
+
+                SAMP_SDK_FORCE_INLINE ~Budget_Scope() {
+                    if (SAMP_SDK_UNLIKELY(target_ != nullptr))
+                        Exec_Budget::Instance().End(target_);
+                }
+
+                Budget_Scope(const Budget_Scope&) = delete;
+                Budget_Scope& operator=(const Budget_Scope&) = delete;
+
+                [[nodiscard]] SAMP_SDK_FORCE_INLINE Jit_Meter* Get_Meter() const {
+                    return target_ ? &target_->meter : nullptr;
+                }
+
+                SAMP_SDK_FORCE_INLINE void Check(AMX* amx, int result, const char* name, int index) {
+                    if (SAMP_SDK_LIKELY(!target_ || result != target_->meter.error || target_->meter.remaining >= 0 || target_->reported))
+                        return;
+
+                    target_->reported = true;
+
+                    if (name)
+                        SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Warning: Script %p exceeded its instruction budget in public '%s' at cip 0x%X, execution was aborted.", static_cast<void*>(amx), name, static_cast<unsigned>(target_->meter.cip));
+                    else
+                        SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Warning: Script %p exceeded its instruction budget in public index %d at cip 0x%X, execution was aborted.", static_cast<void*>(amx), index, static_cast<unsigned>(target_->meter.cip));
+                }
+
+            private:
+                Budget_Target* target_ = nullptr;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,301 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+//
+#include "../amx/amx_defs.h"
+#include "../core/platform.hpp"
+#include "../utils/logger.hpp"
+#include "tracer.hpp"
+
+namespace Samp_SDK {
+    struct Amx_Memory_Stats {
+        AMX* amx = nullptr;
+        cell data_size = 0;
+        cell stack_heap_size = 0;
+        cell stack_peak = 0;
+        cell heap_peak = 0;
+        uint64_t calls = 0;
+        uint64_t heap_leaks = 0;
+        cell leaked_bytes = 0;
+        std::string last_leak;
+    };
+
+    namespace Detail {
+        constexpr cell MEMORY_CANARY = static_cast<cell>(0xCDCDCDCD);
+
+        struct Memory_Target {
+            Amx_Memory_Stats stats;
+            std::string last_public;
+            cell painted_low = 0;
+            cell painted_high = 0;
+            cell resident = 0;
+            int depth = 0;
+            bool sleeping = false;
+        };
+    }
+
+    class Memory_Telemetry {
+        public:
+            static Memory_Telemetry& Instance() {
+                static Memory_Telemetry instance;
+
+                return instance;
+            }
+
+            void Start(std::chrono::seconds summary_interval = std::chrono::seconds(0)) {
+                interval_ns_.store(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(summary_interval).count()), std::memory_order_relaxed);
+                next_summary_ns_ = 0;
+                enabled_.store(true, std::memory_order_release);
+            }
+
+            void Stop() {
+                enabled_.store(false, std::memory_order_release);
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE bool Is_Enabled() const {
+                return enabled_.load(std::memory_order_relaxed);
+            }
+
+            SAMP_SDK_FORCE_INLINE void Tick() {
+                if (SAMP_SDK_LIKELY(!Is_Enabled()))
+                    return;
+
+                Check_Leaks();
+
+                uint64_t interval_ns = interval_ns_.load(std::memory_order_relaxed);
+
+                if (interval_ns == 0)
+                    return;
+
+                uint64_t now_ns = Tracer::Instance().Now();
+
+                if (next_summary_ns_ == 0)
+                    next_summary_ns_ = now_ns + interval_ns;
+                else if (now_ns >= next_summary_ns_) {
+                    next_summary_ns_ = now_ns + interval_ns;
+                    Log_Summary();
+                }
+            }
+
+            Detail::Memory_Target* Begin(AMX* amx, int index) {
+                std::lock_guard<std::mutex> lock(mtx_);
+                auto& target = targets_[amx];
+
+                if (!target)
+                    target = Track(amx);
+
+                Amx_Memory_Stats& stats = target->stats;
+
+                if (index != AMX_EXEC_CONT)
+                    ++stats.calls;
+
+                ++target->depth;
+                stats.stack_peak = std::max(stats.stack_peak, amx->stp - amx->stk);
+                stats.heap_peak = std::max(stats.heap_peak, amx->hea - amx->hlw);
+
+                return target.get();
+            }
+
+            void End(Detail::Memory_Target* target, AMX* amx, int result, const char* name) {
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                target->stats.heap_peak = std::max(target->stats.heap_peak, amx->hea - amx->hlw);
+
+                if (--target->depth > 0)
+                    return;
+
+                target->sleeping = result == static_cast<int>(Amx_Error::Sleep);
+
+                if (name)
+                    target->last_public = name;
+            }
+
+            void Check_Leaks() {
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                for (auto& [amx, target] : targets_) {
+                    cell resident = amx->hea - amx->hlw;
+
+                    if (target->depth > 0 || target->sleeping || resident <= target->resident)
+                        continue;
+
+                    Amx_Memory_Stats& stats = target->stats;
+
+                    ++stats.heap_leaks;
+                    stats.leaked_bytes += resident - target->resident;
+                    stats.last_leak = target->last_public.empty() ? "?" : target->last_public;
+                    target->resident = resident;
+
+                    SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Warning: Script %p still holds %d heap bytes outside of any public, last public was '%s'.", static_cast<void*>(amx), resident, stats.last_leak.c_str());
+                }
+            }
+
+            [[nodiscard]] bool Get_Stats(AMX* amx, Amx_Memory_Stats& stats) {
+                std::lock_guard<std::mutex> lock(mtx_);
+                auto it = targets_.find(amx);
+
+                if (it == targets_.end())
+                    return false;
+
+                Scan(*it->second);
+                stats = it->second->stats;
+
+                return true;
+            }
+
+            [[nodiscard]] std::vector<Amx_Memory_Stats> Get_Stats() {
+                std::lock_guard<std::mutex> lock(mtx_);
+                std::vector<Amx_Memory_Stats> result;
+
+                result.reserve(targets_.size());
+
+                for (auto& [amx, target] : targets_) {
+                    Scan(*target);
+                    result.push_back(target->stats);
+                }
+
+                return result;
+            }
+
+            void Log_Summary() {
+                for (const Amx_Memory_Stats& stats : Get_Stats()) {
+                    cell used = stats.stack_peak + stats.heap_peak;
+
+                    SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Memory: Script %p used %d of %d stack/heap bytes at peak (stack %d, heap %d, data %d), suggested #pragma dynamic %d.",
+                        static_cast<void*>(stats.amx), used, stats.stack_heap_size, stats.stack_peak, stats.heap_peak, stats.data_size, static_cast<cell>((used + used / 4) / sizeof(cell)));
+
+                    if (stats.heap_leaks)
+                        SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Memory: Script %p leaked heap %llu time(s) over %llu calls (%d bytes in total), last after public '%s'.",
+                            static_cast<void*>(stats.amx), static_cast<unsigned long long>(stats.heap_leaks), static_cast<unsigned long long>(stats.calls), stats.leaked_bytes, stats.last_leak.c_str());
+                }
+            }
+
+            void Release(AMX* amx) {
+                std::lock_guard<std::mutex> lock(mtx_);
+                targets_.erase(amx);
+            }
+
+            void Reset() {
+                std::lock_guard<std::mutex> lock(mtx_);
+                targets_.clear();
+            }
+
+        private:
+            Memory_Telemetry() = default;
+            ~Memory_Telemetry() = default;
+
+            static unsigned char* Get_Data(AMX* amx) {
+                return amx->data ? amx->data : amx->base + reinterpret_cast<AMX_HEADER*>(amx->base)->dat;
+            }
+
+            static std::unique_ptr<Detail::Memory_Target> Track(AMX* amx) {
+                auto target = std::make_unique<Detail::Memory_Target>();
+                AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(amx->base);
+                unsigned char* data = Get_Data(amx);
+
+                target->stats.amx = amx;
+                target->stats.data_size = hdr->hea - hdr->dat;
+                target->stats.stack_heap_size = amx->stp - amx->hlw;
+                target->resident = amx->hea - amx->hlw;
+                target->painted_low = (amx->hea + static_cast<cell>(sizeof(cell)) - 1) & ~static_cast<cell>(sizeof(cell) - 1);
+                target->painted_high = amx->stk & ~static_cast<cell>(sizeof(cell) - 1);
+
+                for (cell offset = target->painted_low; offset < target->painted_high; offset += sizeof(cell))
+                    std::memcpy(data + offset, &Detail::MEMORY_CANARY, sizeof(cell));
+
+                return target;
+            }
+
+            static void Scan(Detail::Memory_Target& target) {
+                AMX* amx = target.stats.amx;
+                unsigned char* data = Get_Data(amx);
+                cell value, low = target.painted_low, high = target.painted_high;
+
+                for (; high > low; high -= sizeof(cell)) {
+                    std::memcpy(&value, data + high - sizeof(cell), sizeof(cell));
+
+                    if (value == Detail::MEMORY_CANARY)
+                        break;
+                }
+
+                for (; low < high; low += sizeof(cell)) {
+                    std::memcpy(&value, data + low, sizeof(cell));
+
+                    if (value == Detail::MEMORY_CANARY)
+                        break;
+                }
+
+                target.stats.stack_peak = std::max(target.stats.stack_peak, amx->stp - high);
+                target.stats.heap_peak = std::max(target.stats.heap_peak, low - amx->hlw);
+            }
+
+            std::unordered_map<AMX*, std::unique_ptr<Detail::Memory_Target>> targets_;
+            std::mutex mtx_;
+            std::atomic<bool> enabled_{false};
+            std::atomic<uint64_t> interval_ns_{0};
+            uint64_t next_summary_ns_ = 0;
+    };
+
+    namespace Detail {
+        class Memory_Scope {
+            public:
+                SAMP_SDK_FORCE_INLINE Memory_Scope(AMX* amx, int index) {
+                    if (SAMP_SDK_UNLIKELY(Memory_Telemetry::Instance().Is_Enabled()))
+                        target_ = Memory_Telemetry::Instance().Begin(amx, index);
+                }
+
+                Memory_Scope(const Memory_Scope&) = delete;
+                Memory_Scope& operator=(const Memory_Scope&) = delete;
+
+                SAMP_SDK_FORCE_INLINE void Check(AMX* amx, int result, const char* name) {
+                    if (SAMP_SDK_UNLIKELY(target_ != nullptr))
+                        Memory_Telemetry::Instance().End(target_, amx, result, name);
+                }
+
+            private:
+                Memory_Target* target_ = nullptr;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,302 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+//
+#include "../core/platform.hpp"
+#include "../utils/logger.hpp"
+
+namespace Samp_SDK {
+    enum class Trace_Category : uint8_t {
+        Public,
+        Native,
+        Pawn_Call
+    };
+
+    namespace Detail {
+        struct Trace_Event {
+            uint64_t start_ns;
+            uint64_t duration_ns;
+            const char* name;
+            Trace_Category category;
+        };
+
+        class Trace_Slot {
+            public:
+                SAMP_SDK_FORCE_INLINE void Store(uint64_t position, const Trace_Event& event) {
+                    sequence_.store(position * 2 + 1, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_release);
+
+                    start_ns_.store(event.start_ns, std::memory_order_relaxed);
+                    duration_ns_.store(event.duration_ns, std::memory_order_relaxed);
+                    name_.store(event.name, std::memory_order_relaxed);
+                    category_.store(event.category, std::memory_order_relaxed);
+
+                    sequence_.store(position * 2 + 2, std::memory_order_release);
+                }
+
+                bool Load(uint64_t position, Trace_Event& event) const {
+                    uint64_t before = sequence_.load(std::memory_order_acquire);
+
+                    if (before != position * 2 + 2)
+                        return false;
+
+                    event = {start_ns_.load(std::memory_order_relaxed), duration_ns_.load(std::memory_order_relaxed), name_.load(std::memory_order_relaxed), category_.load(std::memory_order_relaxed)};
+                    std::atomic_thread_fence(std::memory_order_acquire);
+
+                    return sequence_.load(std::memory_order_relaxed) == before;
+                }
+
+            private:
+                std::atomic<uint64_t> sequence_{0};
+                std::atomic<uint64_t> start_ns_{0};
+                std::atomic<uint64_t> duration_ns_{0};
+                std::atomic<const char*> name_{nullptr};
+                std::atomic<Trace_Category> category_{Trace_Category::Public};
+        };
+
+        class Trace_Buffer {
+            public:
+                Trace_Buffer(uint32_t thread_id, size_t capacity, uint64_t generation) : thread_id_(thread_id) {
+                    Reset(capacity, generation);
+                }
+
+                SAMP_SDK_FORCE_INLINE void Push(const Trace_Event& event) {
+                    uint64_t head = head_.load(std::memory_order_relaxed);
+                    slots_[static_cast<size_t>(head) & mask_].Store(head, event);
+                    head_.store(head + 1, std::memory_order_release);
+                }
+
+                void Reset(size_t capacity, uint64_t generation) {
+                    size_t size = 1;
+
+                    while (size < capacity)
+                        size <<= 1;
+
+                    if (!slots_ || size != mask_ + 1) {
+                        slots_.reset(new Trace_Slot[size]);
+                        mask_ = size - 1;
+                    }
+
+                    head_.store(0, std::memory_order_release);
+                    generation_ = generation;
+                }
+
+                void Snapshot(std::vector<Trace_Event>& out) const {
+                    uint64_t head = head_.load(std::memory_order_acquire);
+                    uint64_t count = (head > mask_ + 1) ? mask_ + 1 : head;
+
+                    Trace_Event event;
+
+                    for (uint64_t i = head - count; i < head; ++i) {
+                        if (slots_[static_cast<size_t>(i) & mask_].Load(i, event))
+                            out.push_back(event);
+                    }
+                }
+
+                [[nodiscard]] uint32_t Get_Thread_Id() const {
+                    return thread_id_;
+                }
+
+                [[nodiscard]] SAMP_SDK_FORCE_INLINE uint64_t Get_Generation() const {
+                    return generation_;
+                }
+
+            private:
+                uint32_t thread_id_;
+                uint64_t generation_ = 0;
+                std::unique_ptr<Trace_Slot[]> slots_;
+                size_t mask_ = 0;
+                std::atomic<uint64_t> head_{0};
+        };
+    }
+
+    class Tracer {
+        public:
+            static constexpr size_t DEFAULT_EVENTS_PER_THREAD = 64 * 1024;
+
+            static Tracer& Instance() {
+                static Tracer instance;
+
+                return instance;
+            }
+
+            bool Start(size_t events_per_thread = DEFAULT_EVENTS_PER_THREAD) {
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                if (Is_Enabled())
+                    return false;
+
+                events_per_thread_ = events_per_thread;
+                generation_.fetch_add(1, std::memory_order_release);
+                enabled_.store(true, std::memory_order_release);
+
+                return true;
+            }
+
+            void Stop() {
+                enabled_.store(false, std::memory_order_release);
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE bool Is_Enabled() const {
+                return enabled_.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE uint64_t Now() const {
+                return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch_).count());
+            }
+
+            SAMP_SDK_FORCE_INLINE void Record(Trace_Category category, const char* name, uint64_t start_ns) {
+                uint64_t end_ns = Now();
+
+                Get_Thread_Buffer().Push({start_ns, end_ns - start_ns, name, category});
+            }
+
+            const char* Intern(uint32_t hash, const std::string& name) {
+                static thread_local std::unordered_map<uint32_t, const char*> local_names;
+                auto it = local_names.find(hash);
+
+                if (it != local_names.end())
+                    return it->second;
+
+                std::lock_guard<std::mutex> lock(mtx_);
+                auto& interned = names_[hash];
+
+                if (!interned)
+                    interned = std::make_unique<std::string>(name);
+
+                return local_names.emplace(hash, interned->c_str()).first->second;
+            }
+
+            bool Write(const std::string& path) {
+                std::vector<Detail::Trace_Event> events;
+                std::FILE* file = std::fopen(path.c_str(), "wb");
+
+                if (!file)
+                    return (Log("[SA-MP SDK] Error: Could not open trace file '%s' for writing.", path.c_str()), false);
+
+                std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+
+                bool first = true;
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                uint64_t generation = generation_.load(std::memory_order_relaxed);
+
+                for (const auto& buffer : buffers_) {
+                    if (buffer->Get_Generation() != generation)
+                        continue;
+
+                    events.clear();
+                    buffer->Snapshot(events);
+
+                    for (const auto& event : events) {
+                        std::fprintf(file, "%s\n{\"name\":\"", first ? "" : ",");
+                        Write_Escaped(file, event.name);
+                        std::fprintf(file, "\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                            Get_Category_Name(event.category), static_cast<double>(event.start_ns) / 1000.0, static_cast<double>(event.duration_ns) / 1000.0, buffer->Get_Thread_Id());
+
+                        first = false;
+                    }
+                }
+
+                std::fputs("\n]}\n", file);
+
+                return std::fclose(file) == 0;
+            }
+
+        private:
+            Tracer() : epoch_(std::chrono::steady_clock::now()) {}
+            ~Tracer() = default;
+            Tracer(const Tracer&) = delete;
+            Tracer& operator=(const Tracer&) = delete;
+
+            Detail::Trace_Buffer& Get_Thread_Buffer() {
+                static thread_local Detail::Trace_Buffer* buffer = nullptr;
+
+                if (SAMP_SDK_UNLIKELY(buffer == nullptr || buffer->Get_Generation() != generation_.load(std::memory_order_acquire))) {
+                    std::lock_guard<std::mutex> lock(mtx_);
+                    uint64_t generation = generation_.load(std::memory_order_relaxed);
+
+                    if (buffer)
+                        buffer->Reset(events_per_thread_, generation);
+                    else {
+                        buffers_.push_back(std::make_unique<Detail::Trace_Buffer>(static_cast<uint32_t>(buffers_.size() + 1), events_per_thread_, generation));
+                        buffer = buffers_.back().get();
+                    }
+                }
+
+                return *buffer;
+            }
+
+            static const char* Get_Category_Name(Trace_Category category) {
+                switch (category) {
+                    case Trace_Category::Public:
+                        return "public";
+                    case Trace_Category::Native:
+                        return "native";
+                    case Trace_Category::Pawn_Call:
+                        return "pawn_call";
+                }
+
+                return "unknown";
+            }
+
+            static void Write_Escaped(std::FILE* file, const char* text) {
+                for (const char* p = text ? text : "?"; *p; ++p) {
+                    if (*p == '"' || *p == '\\')
+                        std::fputc('\\', file);
+
+                    if (static_cast<unsigned char>(*p) >= 0x20)
+                        std::fputc(*p, file);
+                }
+            }
+
+            std::atomic<bool> enabled_{false};
+            std::chrono::steady_clock::time_point epoch_;
+            size_t events_per_thread_ = DEFAULT_EVENTS_PER_THREAD;
+            std::atomic<uint64_t> generation_{0};
+            std::vector<std::unique_ptr<Detail::Trace_Buffer>> buffers_;
+            std::unordered_map<uint32_t, std::unique_ptr<std::string>> names_;
+            std::mutex mtx_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,458 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+//
+#include "../amx/amx_defs.h"
+#include "../core/platform.hpp"
+#include "../utils/hash.hpp"
+#include "../utils/logger.hpp"
+
+#if defined(SAMP_SDK_WINDOWS)
+    #include <windows.h>
+#elif defined(SAMP_SDK_LINUX)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace Samp_SDK {
+    namespace Detail {
+        constexpr char TRAFFIC_LOG_MAGIC[8] = {'S', 'D', 'K', 'T', 'R', 'A', 'F', '1'};
+        constexpr uint32_t TRAFFIC_LOG_VERSION = 1;
+        constexpr uint32_t TRAFFIC_MAX_ARGS = 256;
+        constexpr uint32_t TRAFFIC_MAX_STRING_CELLS = 128;
+        constexpr uint32_t TRAFFIC_MAX_HEAP_CELLS = 4096;
+
+        enum class Traffic_Record_Type : uint8_t {
+            Name = 1,
+            Amx = 2,
+            Public = 3,
+            Native = 4,
+            Tick = 5
+        };
+
+        constexpr uint8_t TRAFFIC_FLAG_MAIN = 1;
+
+        struct Traffic_File_Header {
+            char magic[8];
+            uint32_t version;
+            uint32_t header_size;
+            uint64_t reserved[2];
+        };
+
+        struct Traffic_Record_Header {
+            uint8_t type;
+            uint8_t flags;
+            uint16_t depth;
+            uint32_t size;
+            uint64_t time_ns;
+        };
+
+        struct Traffic_Amx_Record {
+            uint32_t amx_id;
+            cell stp;
+        };
+
+        struct Traffic_Call_Record {
+            uint32_t hash;
+            uint32_t amx_id;
+            cell result;
+            uint32_t arg_count;
+            uint32_t region_count;
+        };
+
+        struct Traffic_Region {
+            cell address;
+            uint32_t cell_count;
+        };
+    }
+
+    class Traffic_Recorder {
+        public:
+            static constexpr size_t DEFAULT_CAPACITY = 64 * 1024 * 1024;
+
+            static Traffic_Recorder& Instance() {
+                static Traffic_Recorder instance;
+
+                return instance;
+            }
+
+            bool Start(const std::string& path, size_t capacity = DEFAULT_CAPACITY) {
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                if (mapping_)
+                    return false;
+
+                if (!Map(path, capacity))
+                    return (Log("[SA-MP SDK] Error: Could not map traffic log '%s'.", path.c_str()), false);
+
+                Detail::Traffic_File_Header header{};
+                std::memcpy(header.magic, Detail::TRAFFIC_LOG_MAGIC, sizeof(header.magic));
+                header.version = Detail::TRAFFIC_LOG_VERSION;
+                header.header_size = sizeof(header);
+                std::memcpy(mapping_, &header, sizeof(header));
+
+                capacity_ = capacity;
+                cursor_.store(sizeof(header), std::memory_order_relaxed);
+                dropped_.store(0, std::memory_order_relaxed);
+                names_.clear();
+                amx_ids_.clear();
+                next_amx_id_ = 0;
+                epoch_ = std::chrono::steady_clock::now();
+                ++session_;
+                enabled_.store(true, std::memory_order_release);
+
+                return true;
+            }
+
+            void Stop() {
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                if (!mapping_)
+                    return;
+
+                enabled_.store(false, std::memory_order_release);
+                ++session_;
+                Unmap(cursor_.load(std::memory_order_acquire));
+
+                if (uint64_t dropped = dropped_.load(std::memory_order_relaxed))
+                    SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Warning: Traffic log was full, %llu record(s) were not recorded.", static_cast<unsigned long long>(dropped));
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE bool Is_Enabled() const {
+                return enabled_.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] size_t Get_Used_Bytes() const {
+                return cursor_.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] uint64_t Get_Dropped_Count() const {
+                return dropped_.load(std::memory_order_relaxed);
+            }
+
+            void Record_Tick() {
+                if (!Is_Enabled())
+                    return;
+
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                if (mapping_)
+                    Append(Detail::Traffic_Record_Type::Tick, 0, 0, nullptr, 0);
+            }
+
+            void Release(AMX* amx) {
+                std::lock_guard<std::mutex> lock(mtx_);
+                amx_ids_.erase(amx);
+            }
+
+            void Declare_References(const char* native, std::initializer_list<uint32_t> arguments) {
+                std::lock_guard<std::mutex> lock(mtx_);
+                uint64_t& mask = reference_args_[Detail::FNV1a_Hash(native)];
+
+                for (uint32_t argument : arguments) {
+                    if (argument >= 1 && argument <= 64)
+                        mask |= static_cast<uint64_t>(1) << (argument - 1);
+                }
+            }
+
+            size_t Record_Call(Detail::Traffic_Record_Type type, uint8_t flags, uint16_t depth, AMX* amx, uint32_t hash, const char* name, const cell* args, uint32_t arg_count) {
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                if (!mapping_)
+                    return 0;
+
+                if (name && names_.find(hash) == names_.end()) {
+                    size_t length = std::strlen(name);
+                    scratch_.resize(sizeof(uint32_t) + length);
+                    std::memcpy(scratch_.data(), &hash, sizeof(hash));
+                    std::memcpy(scratch_.data() + sizeof(hash), name, length);
+
+                    if (!Append(Detail::Traffic_Record_Type::Name, 0, 0, scratch_.data(), scratch_.size()))
+                        return 0;
+
+                    names_.insert(hash);
+                }
+
+                auto amx_it = amx_ids_.find(amx);
+
+                if (amx_it == amx_ids_.end()) {
+                    Detail::Traffic_Amx_Record amx_record{next_amx_id_, amx->stp};
+
+                    if (!Append(Detail::Traffic_Record_Type::Amx, 0, 0, &amx_record, sizeof(amx_record)))
+                        return 0;
+
+                    amx_it = amx_ids_.emplace(amx, next_amx_id_++).first;
+                }
+
+                arg_count = arg_count > Detail::TRAFFIC_MAX_ARGS ? Detail::TRAFFIC_MAX_ARGS : arg_count;
+
+                Detail::Traffic_Call_Record call{hash, amx_it->second, 0, arg_count, 0};
+                scratch_.resize(sizeof(call));
+                Write_Scratch(args, arg_count * sizeof(cell));
+
+                unsigned char* data = amx->data ? amx->data : amx->base + reinterpret_cast<AMX_HEADER*>(amx->base)->dat;
+
+                if (type == Detail::Traffic_Record_Type::Public && amx->hea > amx->hlw) {
+                    cell cells = (amx->hea - amx->hlw) / static_cast<cell>(sizeof(cell));
+                    Write_Region(data, amx->hlw, static_cast<uint32_t>(cells > static_cast<cell>(Detail::TRAFFIC_MAX_HEAP_CELLS) ? Detail::TRAFFIC_MAX_HEAP_CELLS : cells));
+                    ++call.region_count;
+                }
+                else if (type == Detail::Traffic_Record_Type::Native) {
+                    auto mask_it = reference_args_.find(hash);
+                    uint64_t mask = mask_it != reference_args_.end() ? mask_it->second : 0;
+
+                    for (uint32_t i = 0; i < arg_count && i < 64; ++i) {
+                        if (!(mask & (static_cast<uint64_t>(1) << i)))
+                            continue;
+
+                        cell address = args[i];
+                        cell limit = address < amx->hea ? amx->hea : amx->stp;
+
+                        if (address < 0 || (address % static_cast<cell>(sizeof(cell))) != 0 || address >= amx->stp || (address >= amx->hea && address < amx->stk))
+                            continue;
+
+                        uint32_t cells = 0;
+                        const cell* source = reinterpret_cast<const cell*>(data + address);
+
+                        while (cells < Detail::TRAFFIC_MAX_STRING_CELLS && address + static_cast<cell>(cells * sizeof(cell)) < limit && source[cells++] != 0) {}
+
+                        Write_Region(data, address, cells);
+                        ++call.region_count;
+                    }
+                }
+
+                std::memcpy(scratch_.data(), &call, sizeof(call));
+
+                size_t offset = Append(type, flags, depth, scratch_.data(), scratch_.size());
+
+                return offset ? offset + sizeof(Detail::Traffic_Record_Header) + offsetof(Detail::Traffic_Call_Record, result) : 0;
+            }
+
+            void Patch_Result(size_t offset, uint64_t session, cell result) {
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                if (mapping_ && session == session_.load(std::memory_order_relaxed))
+                    std::memcpy(mapping_ + offset, &result, sizeof(result));
+            }
+
+            [[nodiscard]] uint64_t Get_Session() const {
+                return session_.load(std::memory_order_acquire);
+            }
+
+        private:
+            Traffic_Recorder() = default;
+            ~Traffic_Recorder() = default;
+            Traffic_Recorder(const Traffic_Recorder&) = delete;
+            Traffic_Recorder& operator=(const Traffic_Recorder&) = delete;
+
+            void Write_Scratch(const void* source, size_t size) {
+                size_t offset = scratch_.size();
+                scratch_.resize(offset + size);
+
+                if (size)
+                    std::memcpy(scratch_.data() + offset, source, size);
+            }
+
+            void Write_Region(const unsigned char* data, cell address, uint32_t cells) {
+                Detail::Traffic_Region region{address, cells};
+                Write_Scratch(&region, sizeof(region));
+                Write_Scratch(data + address, cells * sizeof(cell));
+            }
+
+            size_t Append(Detail::Traffic_Record_Type type, uint8_t flags, uint16_t depth, const void* body, size_t body_size) {
+                size_t size = (sizeof(Detail::Traffic_Record_Header) + body_size + 7) & ~static_cast<size_t>(7);
+                size_t offset = cursor_.load(std::memory_order_relaxed);
+
+                if (offset + size > capacity_)
+                    return (dropped_.fetch_add(1, std::memory_order_relaxed), 0);
+
+                Detail::Traffic_Record_Header header{static_cast<uint8_t>(type), flags, depth, static_cast<uint32_t>(size),
+                    static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch_).count())};
+
+                std::memcpy(mapping_ + offset, &header, sizeof(header));
+
+                if (body_size)
+                    std::memcpy(mapping_ + offset + sizeof(header), body, body_size);
+
+                cursor_.store(offset + size, std::memory_order_release);
+
+                return offset;
+            }
+
+            bool Map(const std::string& path, size_t capacity) {
+#if defined(SAMP_SDK_WINDOWS)
+                file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+                if (file_ == INVALID_HANDLE_VALUE)
+                    return false;
+
+                map_handle_ = CreateFileMappingA(file_, nullptr, PAGE_READWRITE, 0, static_cast<DWORD>(capacity), nullptr);
+                void* view = map_handle_ ? MapViewOfFile(map_handle_, FILE_MAP_WRITE, 0, 0, capacity) : nullptr;
+
+                if (!view) {
+                    if (map_handle_)
+                        CloseHandle(map_handle_);
+
+                    CloseHandle(file_);
+
+                    return false;
+                }
+
+                mapping_ = static_cast<unsigned char*>(view);
+#elif defined(SAMP_SDK_LINUX)
+                file_ = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+                if (file_ < 0)
+                    return false;
+
+                void* view = ftruncate(file_, static_cast<off_t>(capacity)) == 0 ? mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, file_, 0) : MAP_FAILED;
+
+                if (view == MAP_FAILED)
+                    return (close(file_), false);
+
+                mapping_ = static_cast<unsigned char*>(view);
+#endif
+                return mapping_ != nullptr;
+            }
+
+            void Unmap(size_t used) {
+#if defined(SAMP_SDK_WINDOWS)
+                FlushViewOfFile(mapping_, used);
+                UnmapViewOfFile(mapping_);
+                CloseHandle(map_handle_);
+
+                LARGE_INTEGER size;
+                size.QuadPart = static_cast<LONGLONG>(used);
+                SetFilePointerEx(file_, size, nullptr, FILE_BEGIN);
+                SetEndOfFile(file_);
+                CloseHandle(file_);
+#elif defined(SAMP_SDK_LINUX)
+                msync(mapping_, used, MS_SYNC);
+                munmap(mapping_, capacity_);
+
+                if (ftruncate(file_, static_cast<off_t>(used)) != 0)
+                    Log("[SA-MP SDK] Warning: Could not trim traffic log to %zu bytes.", used);
+
+                close(file_);
+#endif
+                mapping_ = nullptr;
+            }
+
+            std::mutex mtx_;
+            std::atomic<bool> enabled_{false};
+            std::atomic<size_t> cursor_{0};
+            std::atomic<uint64_t> dropped_{0};
+            unsigned char* mapping_ = nullptr;
+            size_t capacity_ = 0;
+            std::atomic<uint64_t> session_{0};
+            std::chrono::steady_clock::time_point epoch_;
+            std::unordered_set<uint32_t> names_;
+            std::unordered_map<AMX*, uint32_t> amx_ids_;
+            std::unordered_map<uint32_t, uint64_t> reference_args_;
+            uint32_t next_amx_id_ = 0;
+            std::vector<unsigned char> scratch_;
+#if defined(SAMP_SDK_WINDOWS)
+            HANDLE file_ = INVALID_HANDLE_VALUE;
+            HANDLE map_handle_ = nullptr;
+#elif defined(SAMP_SDK_LINUX)
+            int file_ = -1;
+#endif
+    };
+
+    namespace Detail {
+        inline thread_local uint16_t tl_traffic_depth = 0;
+
+        class Traffic_Scope {
+            public:
+                SAMP_SDK_FORCE_INLINE Traffic_Scope(AMX* amx, uint32_t hash, const char* name, cell* retval, bool is_main) : retval_(retval) {
+                    if (SAMP_SDK_UNLIKELY(Traffic_Recorder::Instance().Is_Enabled()) && amx)
+                        Begin(Traffic_Record_Type::Public, is_main ? TRAFFIC_FLAG_MAIN : 0, amx, hash, name,
+                            reinterpret_cast<const cell*>((amx->data ? amx->data : amx->base + reinterpret_cast<AMX_HEADER*>(amx->base)->dat) + amx->stk), static_cast<uint32_t>(amx->paramcount));
+                }
+
+                SAMP_SDK_FORCE_INLINE Traffic_Scope(AMX* amx, uint32_t hash, const char* name, const cell* params) {
+                    if (SAMP_SDK_UNLIKELY(Traffic_Recorder::Instance().Is_Enabled()) && amx && params)
+                        Begin(Traffic_Record_Type::Native, 0, amx, hash, name, params + 1, static_cast<uint32_t>(params[0] / static_cast<cell>(sizeof(cell))));
+                }
+
+                SAMP_SDK_FORCE_INLINE ~Traffic_Scope() {
+                    if (SAMP_SDK_UNLIKELY(active_))
+                        End(retval_ ? *retval_ : result_);
+                }
+
+                SAMP_SDK_FORCE_INLINE cell Finish(cell result) {
+                    result_ = result;
+
+                    return result;
+                }
+
+                Traffic_Scope(const Traffic_Scope&) = delete;
+                Traffic_Scope& operator=(const Traffic_Scope&) = delete;
+
+            private:
+                void Begin(Traffic_Record_Type type, uint8_t flags, AMX* amx, uint32_t hash, const char* name, const cell* args, uint32_t arg_count) {
+                    Traffic_Recorder& recorder = Traffic_Recorder::Instance();
+                    session_ = recorder.Get_Session();
+                    offset_ = recorder.Record_Call(type, flags, tl_traffic_depth++, amx, hash, name, args, arg_count);
+                    active_ = true;
+                }
+
+                void End(cell result) {
+                    --tl_traffic_depth;
+
+                    if (offset_)
+                        Traffic_Recorder::Instance().Patch_Result(offset_, session_, result);
+                }
+
+                cell* retval_ = nullptr;
+                cell result_ = 0;
+                size_t offset_ = 0;
+                uint64_t session_ = 0;
+                bool active_ = false;
+        };
+    }
+}
\ No newline at end of file
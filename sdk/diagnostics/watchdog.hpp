@@ -0,0 +1,253 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+//
+#include "../amx/amx_defs.h"
+#include "../core/platform.hpp"
+#include "../utils/logger.hpp"
+#include "tracer.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        struct Watchdog_Frame {
+            const char* name = nullptr;
+            AMX* amx = nullptr;
+            Trace_Category category = Trace_Category::Public;
+            uint64_t start_ns = 0;
+            cell cip = 0;
+        };
+
+        class Watchdog_Slot {
+            public:
+                SAMP_SDK_FORCE_INLINE void Store(const Watchdog_Frame& frame) {
+                    uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+                    sequence_.store(sequence + 1, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_release);
+
+                    name_.store(frame.name, std::memory_order_relaxed);
+                    amx_.store(frame.amx, std::memory_order_relaxed);
+                    category_.store(frame.category, std::memory_order_relaxed);
+                    start_ns_.store(frame.start_ns, std::memory_order_relaxed);
+                    cip_.store(frame.cip, std::memory_order_relaxed);
+
+                    sequence_.store(sequence + 2, std::memory_order_release);
+                }
+
+                SAMP_SDK_FORCE_INLINE Watchdog_Frame Load_Local() const {
+                    return {name_.load(std::memory_order_relaxed), amx_.load(std::memory_order_relaxed), category_.load(std::memory_order_relaxed), start_ns_.load(std::memory_order_relaxed), cip_.load(std::memory_order_relaxed)};
+                }
+
+                Watchdog_Frame Snapshot() const {
+                    Watchdog_Frame frame;
+                    uint32_t before, after;
+
+                    do {
+                        before = sequence_.load(std::memory_order_acquire);
+                        frame = Load_Local();
+                        std::atomic_thread_fence(std::memory_order_acquire);
+                        after = sequence_.load(std::memory_order_relaxed);
+                    } while ((before & 1) != 0 || before != after);
+
+                    return frame;
+                }
+
+            private:
+                std::atomic<uint32_t> sequence_{0};
+                std::atomic<const char*> name_{nullptr};
+                std::atomic<AMX*> amx_{nullptr};
+                std::atomic<Trace_Category> category_{Trace_Category::Public};
+                std::atomic<uint64_t> start_ns_{0};
+                std::atomic<cell> cip_{0};
+        };
+    }
+
+    class Watchdog {
+        public:
+            static Watchdog& Instance() {
+                static Watchdog instance;
+
+                return instance;
+            }
+
+            void Start(std::chrono::milliseconds threshold) {
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                threshold_ns_.store(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(threshold).count()), std::memory_order_relaxed);
+
+                if (thread_.joinable())
+                    return;
+
+                stop_requested_ = false;
+                last_tick_ns_.store(0, std::memory_order_relaxed);
+                enabled_.store(true, std::memory_order_release);
+                thread_ = std::thread(&Watchdog::Run, this);
+            }
+
+            void Stop() {
+                {
+                    std::lock_guard<std::mutex> lock(mtx_);
+
+                    if (!thread_.joinable())
+                        return;
+
+                    enabled_.store(false, std::memory_order_release);
+                    stop_requested_ = true;
+                }
+
+                cv_.notify_all();
+                thread_.join();
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE bool Is_Enabled() const {
+                return enabled_.load(std::memory_order_relaxed);
+            }
+
+            SAMP_SDK_FORCE_INLINE void Tick() {
+                if (SAMP_SDK_LIKELY(!Is_Enabled()))
+                    return;
+
+                Is_Server_Thread() = true;
+                last_tick_ns_.store(Tracer::Instance().Now(), std::memory_order_release);
+                tick_count_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE static bool& Is_Server_Thread() {
+                static thread_local bool is_server_thread = false;
+
+                return is_server_thread;
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE Detail::Watchdog_Slot& Get_Slot() {
+                return slot_;
+            }
+
+        private:
+            Watchdog() = default;
+            ~Watchdog() {
+                Stop();
+            }
+            Watchdog(const Watchdog&) = delete;
+            Watchdog& operator=(const Watchdog&) = delete;
+
+            void Run() {
+                uint64_t reported_tick = static_cast<uint64_t>(-1);
+                uint64_t stall_start_ns = 0;
+                uint64_t reported_call_ns = 0;
+                std::unique_lock<std::mutex> lock(mtx_);
+
+                while (!stop_requested_) {
+                    uint64_t threshold_ns = threshold_ns_.load(std::memory_order_relaxed);
+                    uint64_t poll_ns = threshold_ns / 4;
+
+                    if (poll_ns < 1000000)
+                        poll_ns = 1000000;
+
+                    cv_.wait_for(lock, std::chrono::nanoseconds(poll_ns));
+
+                    if (stop_requested_)
+                        break;
+
+                    uint64_t last_tick_ns = last_tick_ns_.load(std::memory_order_acquire);
+                    uint64_t tick = tick_count_.load(std::memory_order_relaxed);
+
+                    if (last_tick_ns == 0) {
+                        Detail::Watchdog_Frame frame = slot_.Snapshot();
+                        uint64_t now_ns = Tracer::Instance().Now();
+
+                        if (frame.name && frame.start_ns != reported_call_ns && now_ns - frame.start_ns >= threshold_ns) {
+                            reported_call_ns = frame.start_ns;
+                            Report(now_ns, now_ns - frame.start_ns);
+                        }
+
+                        continue;
+                    }
+
+                    if (reported_tick != static_cast<uint64_t>(-1) && tick != reported_tick) {
+                        SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Watchdog: Server tick resumed after %llu ms.", static_cast<unsigned long long>((last_tick_ns - stall_start_ns) / 1000000));
+                        reported_tick = static_cast<uint64_t>(-1);
+                    }
+
+                    uint64_t now_ns = Tracer::Instance().Now();
+
+                    if (reported_tick == tick || now_ns - last_tick_ns < threshold_ns)
+                        continue;
+
+                    reported_tick = tick;
+                    stall_start_ns = last_tick_ns;
+                    Report(now_ns, now_ns - last_tick_ns);
+                }
+            }
+
+            void Report(uint64_t now_ns, uint64_t stalled_ns) {
+                Detail::Watchdog_Frame frame = slot_.Snapshot();
+
+                if (!frame.name) {
+                    SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Watchdog: Server tick stalled for %llu ms outside of any public or native call.", static_cast<unsigned long long>(stalled_ns / 1000000));
+
+                    return;
+                }
+
+                const char* kind = (frame.category == Trace_Category::Public) ? "public" : (frame.category == Trace_Category::Native) ? "native" : "Pawn call";
+
+                if (frame.category == Trace_Category::Native) {
+                    SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Watchdog: Server tick stalled for %llu ms in %s '%s' (AMX %p, cip 0x%08X, running for %llu ms).",
+                        static_cast<unsigned long long>(stalled_ns / 1000000), kind, frame.name, static_cast<void*>(frame.amx),
+                        static_cast<unsigned int>(frame.cip), static_cast<unsigned long long>((now_ns - frame.start_ns) / 1000000));
+
+                    return;
+                }
+
+                SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Watchdog: Server tick stalled for %llu ms in %s '%s' (AMX %p, running for %llu ms).",
+                    static_cast<unsigned long long>(stalled_ns / 1000000), kind, frame.name, static_cast<void*>(frame.amx),
+                    static_cast<unsigned long long>((now_ns - frame.start_ns) / 1000000));
+            }
+
+            Detail::Watchdog_Slot slot_;
+            std::atomic<bool> enabled_{false};
+            std::atomic<uint64_t> threshold_ns_{0};
+            std::atomic<uint64_t> last_tick_ns_{0};
+            std::atomic<uint64_t> tick_count_{0};
+            bool stop_requested_ = false;
+            std::thread thread_;
+            std::mutex mtx_;
+            std::condition_variable cv_;
+    };
+}
\ No newline at end of file
@@ -49,6 +49,7 @@
 #include "../utils/hash.hpp"
 #include "../hooks/interceptor_manager.hpp"
 #include "../hooks/native_hook_manager.hpp"
+#include "../diagnostics/call_scope.hpp"
 #include "../core/platform.hpp"
 
 namespace Samp_SDK {
@@ -262,8 +263,7 @@ namespace Samp_SDK {
                 return Callback_Result();
             }
 
-            template<typename... Args>
-            inline Callback_Result Call_Public(uint32_t func_hash, const char* func_name_for_log, Args&&... args) {
+            inline AMX* Resolve_Public(uint32_t func_hash, const char* func_name_for_log, int& pub_index) {
 #if defined(__cpp_threadsafe_static_init) && __cpp_threadsafe_static_init >= 200806L
                 static thread_local Caller_Cache cache;
 #else
@@ -279,11 +279,10 @@ namespace Samp_SDK {
                 }
 
                 if (cache.failure_cache.count(func_hash))
-                    return Callback_Result();
+                    return nullptr;
 
                 auto it = cache.public_cache.find(func_hash);
                 AMX* amx = nullptr;
-                int pub_index = -1;
 
                 if (it != cache.public_cache.end()) {
                     amx = it->second.first;
@@ -294,6 +293,17 @@ namespace Samp_SDK {
                     cache.public_cache.emplace(func_hash, std::make_pair(amx, pub_index));
                 }
 
+                if (!amx)
+                    cache.failure_cache.insert(func_hash);
+
+                return amx;
+            }
+
+            template<typename... Args>
+            inline Callback_Result Call_Public(uint32_t func_hash, const char* func_name_for_log, Args&&... args) {
+                int pub_index = -1;
+                AMX* amx = Resolve_Public(func_hash, func_name_for_log, pub_index);
+
                 if (amx) {
                     cell hea_before = amx->hea, stk_before = amx->stk;
                     std::vector<std::unique_ptr<Amx_Scoped_Memory>> param_buffers;
@@ -323,8 +333,6 @@ namespace Samp_SDK {
 
                     return Callback_Result(false, 0, error);
                 }
-                
-                cache.failure_cache.insert(func_hash);
 
                 return Callback_Result();
             }
@@ -334,7 +342,7 @@ namespace Samp_SDK {
         struct Caller<Pawn_Call_Type::Native> {
             template<typename... Args>
             static inline Callback_Result Call(uint32_t func_hash, const char* func_name_for_log, Args&&... args) {
-                (void)func_name_for_log;
+                Call_Scope call_scope(Trace_Category::Pawn_Call, func_name_for_log);
 
                 return Shared_Caller_Logic::Call_Native(func_hash, std::forward<Args>(args)...);
             }
@@ -344,6 +352,8 @@ namespace Samp_SDK {
         struct Caller<Pawn_Call_Type::Public> {
             template<typename... Args>
             static inline Callback_Result Call(uint32_t func_hash, const char* func_name_for_log, Args&&... args) {
+                Call_Scope call_scope(Trace_Category::Pawn_Call, func_name_for_log);
+
                 return Shared_Caller_Logic::Call_Public(func_hash, func_name_for_log, std::forward<Args>(args)...);
             }
         };
@@ -352,6 +362,8 @@ namespace Samp_SDK {
         struct Caller<Pawn_Call_Type::Automatic> {
             template<typename... Args>
             static inline Callback_Result Call(uint32_t func_hash, const char* func_name_for_log, Args&&... args) {
+                Call_Scope call_scope(Trace_Category::Pawn_Call, func_name_for_log);
+
                 if (Find_Native_Func(func_hash) != nullptr)
                     return Shared_Caller_Logic::Call_Native(func_hash, std::forward<Args>(args)...);
 
@@ -32,9 +32,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <functional>
+#include <iterator>
 #include <unordered_map>
 #include <tuple>
 #include <utility>
@@ -103,14 +105,48 @@ namespace Samp_SDK {
                     return instance;
                 }
 
-                void Register(uint32_t hash, Amx_Handler_Func handler) {
-                    handlers_[hash].push_back(handler);
+                void Register(uint32_t hash, Amx_Handler_Func handler, const void* owner = nullptr) {
+                    handlers_[hash].push_back({std::move(handler), owner});
+                }
+
+                void Unregister(const void* owner) {
+                    for (auto it = handlers_.begin(); it != handlers_.end();) {
+                        auto& list = it->second;
+
+                        list.erase(std::remove_if(list.begin(), list.end(), [owner](const Handler_Entry& entry) { return entry.owner == owner; }), list.end());
+                        it = list.empty() ? handlers_.erase(it) : std::next(it);
+                    }
+                }
+
+                void Unregister(uint32_t hash, const void* owner) {
+                    auto it = handlers_.find(hash);
+
+                    if (it == handlers_.end())
+                        return;
+
+                    auto& list = it->second;
+
+                    list.erase(std::remove_if(list.begin(), list.end(), [owner](const Handler_Entry& entry) { return entry.owner == owner; }), list.end());
+
+                    if (list.empty())
+                        handlers_.erase(it);
                 }
 
                 bool Has_Handler(uint32_t hash) const {
                     return handlers_.count(hash) > 0;
                 }
 
+                std::vector<uint32_t> Get_Hashes() const {
+                    std::vector<uint32_t> hashes;
+
+                    hashes.reserve(handlers_.size());
+
+                    for (const auto& [hash, list] : handlers_)
+                        hashes.push_back(hash);
+
+                    return hashes;
+                }
+
                 bool Dispatch(uint32_t hash, AMX* amx, cell& result) {
                     auto it = handlers_.find(hash);
 
@@ -118,8 +154,7 @@ namespace Samp_SDK {
                         return true;
 
                     for (auto rit = it->second.rbegin(); rit != it->second.rend(); ++rit) {
-                        const auto& handler = *rit;
-                        result = handler(amx);
+                        result = rit->func(amx);
 
                         if (result == PUBLIC_STOP)
                             return false;
@@ -129,8 +164,13 @@ namespace Samp_SDK {
                 }
 
             private:
+                struct Handler_Entry {
+                    Amx_Handler_Func func;
+                    const void* owner;
+                };
+
                 Public_Dispatcher() = default;
-                std::unordered_map<uint32_t, std::vector<Amx_Handler_Func>> handlers_;
+                std::unordered_map<uint32_t, std::vector<Handler_Entry>> handlers_;
         };
 
         template<typename T_Func, T_Func func_ptr>
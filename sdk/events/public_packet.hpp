@@ -0,0 +1,139 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+//
+#include "../amx/amx_api.hpp"
+#include "../amx/amx_defs.h"
+#include "callbacks.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        class Public_Packet {
+            public:
+                void Clear() {
+                    args_.clear();
+                    strings_.clear();
+                }
+
+                void Push_Cell(cell value) {
+                    args_.push_back({value, 0, false});
+                }
+
+                void Push_Float(float value) {
+                    args_.push_back({amx::AMX_FTOC(value), 0, false});
+                }
+
+                void Push_String(std::string_view value) {
+                    args_.push_back({0, static_cast<uint32_t>(strings_.size()), true});
+                    strings_.append(value.data(), value.size());
+                    strings_.push_back('\0');
+                }
+
+                template<typename T>
+                void Push(T&& value) {
+                    using Param_Type = decay_t<T>;
+
+                    if constexpr (std::is_floating_point_v<Param_Type>)
+                        Push_Float(static_cast<float>(value));
+                    else if constexpr (std::is_same_v<Param_Type, std::string> || std::is_same_v<Param_Type, std::string_view>)
+                        Push_String(value);
+                    else if constexpr (std::is_array_v<std::remove_reference_t<T>> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<std::remove_reference_t<T>>>, char>)
+                        Push_String(std::string_view(value));
+                    else if constexpr (std::is_pointer_v<Param_Type> && std::is_same_v<typename std::remove_cv<typename std::remove_pointer<Param_Type>::type>::type, char>)
+                        Push_String(value ? std::string_view(value) : std::string_view());
+                    else
+                        Push_Cell(static_cast<cell>(value));
+                }
+
+                template<typename... Args>
+                void Push_All(Args&&... args) {
+                    (void)std::initializer_list<int>{(Push(std::forward<Args>(args)), 0)...};
+                }
+
+                [[nodiscard]] size_t Count() const {
+                    return args_.size();
+                }
+
+                Callback_Result Execute(AMX* amx, const char* public_name) const {
+                    int index = 0;
+
+                    if (!amx || amx::Find_Public(amx, public_name, &index) != 0)
+                        return Callback_Result();
+
+                    return Execute(amx, index);
+                }
+
+                Callback_Result Execute(AMX* amx, int index) const {
+                    if (!amx)
+                        return Callback_Result();
+
+                    cell hea_before = amx->hea, stk_before = amx->stk;
+
+                    for (auto rit = args_.rbegin(); rit != args_.rend(); ++rit) {
+                        if (rit->is_string) {
+                            cell amx_addr = 0;
+                            amx::Push_String(amx, &amx_addr, nullptr, strings_.c_str() + rit->string_offset);
+                        }
+                        else
+                            amx::Push(amx, rit->value);
+                    }
+
+                    cell retval = 0;
+                    int error = amx::Exec(amx, &retval, index);
+                    amx->hea = hea_before;
+                    amx->stk = stk_before;
+
+                    if (error == 0 || error == static_cast<int>(Amx_Error::Sleep))
+                        return Callback_Result(true, retval);
+
+                    return Callback_Result(false, 0, error);
+                }
+
+            private:
+                struct Argument {
+                    cell value;
+                    uint32_t string_offset;
+                    bool is_string;
+                };
+
+                std::vector<Argument> args_;
+                std::string strings_;
+        };
+    }
+}
\ No newline at end of file
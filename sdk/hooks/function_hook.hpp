@@ -110,6 +110,10 @@ namespace Samp_SDK {
                     return installed_;
                 }
 
+                [[nodiscard]] bool Was_Target_Detoured() const {
+                    return original_bytes_[0] == 0xE9 || original_bytes_[0] == 0xEB || original_bytes_[0] == 0x68 || (original_bytes_[0] == 0xFF && original_bytes_[1] == 0x25);
+                }
+
             private:
                 static void Unprotect_Memory(void* address, size_t size) {
 #if defined(SAMP_SDK_WINDOWS)
@@ -161,6 +165,10 @@ namespace Samp_SDK {
                 [[nodiscard]] FuncPtr Get_Original() const {
                     return original_func_ptr_;
                 }
+
+                [[nodiscard]] bool Is_Target_Hooked() const {
+                    return detour_.Was_Target_Detoured();
+                }
                 
                 template<typename... Args>
                 auto Call_Original(Args... args) -> decltype(Get_Original()(args...)) {
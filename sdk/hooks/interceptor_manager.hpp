@@ -40,9 +40,12 @@
 #include <vector>
 #include <functional>
 #include <shared_mutex>
+#include <atomic>
 //
 #include "../amx/amx_api.hpp"
 #include "../amx/amx_defs.h"
+#include "../amx/amx_jit.hpp"
+#include "../amx/amx_sysreq.hpp"
 #include "../amx/amx_manager.hpp"
 #include "../core/core.hpp"
 #include "function_hook.hpp"
@@ -50,6 +53,10 @@
 #include "../utils/logger.hpp"
 #include "native_hook_manager.hpp"
 #include "../events/public_dispatcher.hpp"
+#include "../diagnostics/call_scope.hpp"
+#include "../diagnostics/exec_budget.hpp"
+#include "../diagnostics/memory_telemetry.hpp"
+#include "../diagnostics/traffic_recorder.hpp"
 
 constexpr int PLUGIN_EXEC_GHOST_PUBLIC = -10;
 
@@ -155,11 +162,20 @@ namespace Samp_SDK {
 
                 AMX_NATIVE Find_Cached_Native(uint32_t hash) {
                     auto& cache_data = Get_Cache_Data();
-                    std::shared_lock<Shared_Mutex_Type> lock(cache_data.mtx);
 
-                    auto it = cache_data.native_cache.find(hash);
+                    {
+                        std::shared_lock<Shared_Mutex_Type> lock(cache_data.mtx);
+                        auto it = cache_data.native_cache.find(hash);
 
-                    return (it != cache_data.native_cache.end()) ? it->second : nullptr;
+                        if (it != cache_data.native_cache.end())
+                            return it->second;
+                    }
+
+                    return native_resolver_ ? native_resolver_(hash) : nullptr;
+                }
+
+                void Set_Native_Resolver(AMX_NATIVE (SAMP_SDK_CDECL* resolver)(uint32_t hash)) {
+                    native_resolver_ = resolver;
                 }
 
                 const std::unordered_map<uint32_t, std::string>& Get_Native_Name_Cache() {
@@ -201,8 +217,40 @@ namespace Samp_SDK {
 
                 std::unordered_set<AMX*> patched_amx_set_;
                 Shared_Mutex_Type patched_amx_mutex_;
+                AMX_NATIVE (SAMP_SDK_CDECL* native_resolver_)(uint32_t hash) = nullptr;
         };
 
+        inline const cell* Get_Amx_Opcode_List(AMX* amx) {
+            static std::atomic<const cell*> opcode_list{nullptr};
+
+            if ((amx->flags & AMX_FLAG_RELOC) == 0)
+                return nullptr;
+
+            if (const cell* cached = opcode_list.load(std::memory_order_acquire))
+                return cached;
+
+            cell list = 0;
+
+            amx->flags |= AMX_FLAG_BROWSE;
+            amx::Exec(amx, &list, 0);
+            amx->flags &= ~AMX_FLAG_BROWSE;
+
+            opcode_list.store(reinterpret_cast<const cell*>(list), std::memory_order_release);
+
+            return reinterpret_cast<const cell*>(list);
+        }
+
+        inline bool Can_Jit_Bypass_Exec() {
+            static std::atomic<bool> reported{false};
+            auto& hook = Get_Amx_Exec_Hook();
+            bool exclusive = !hook.Is_Target_Hooked() && Core::Instance().Get_AMX_Export(PLUGIN_AMX_EXPORT_Exec) == reinterpret_cast<void*>(hook.Get_Original());
+
+            if (!exclusive && !reported.exchange(true))
+                Log("[SA-MP SDK] Warning: Another plugin hooks amx_Exec, the AMX JIT stays off so that hook keeps seeing every call.");
+
+            return exclusive;
+        }
+
         inline int SAMP_SDK_CDECL Amx_Init_Detour(AMX *amx, void *program) {
             int result = Get_Amx_Init_Hook().Call_Original(amx, program);
 
@@ -215,6 +263,10 @@ namespace Samp_SDK {
         inline int SAMP_SDK_CDECL Amx_Cleanup_Detour(AMX *amx) {
             Amx_Manager::Instance().Remove_Amx(amx);
             Interceptor_Manager::Instance().On_Amx_Cleanup(amx);
+            Amx_Jit::Instance().Release(amx);
+            Exec_Budget::Instance().Release(amx);
+            Memory_Telemetry::Instance().Release(amx);
+            Traffic_Recorder::Instance().Release(amx);
 
             return Get_Amx_Cleanup_Hook().Call_Original(amx);
         }
@@ -231,6 +283,8 @@ namespace Samp_SDK {
                 uint32_t hash = FNV1a_Hash(modified_list[i].name);
 
                 if (hook_manager.Find_Hook(hash)) {
+                    hook_manager.Relink_Next_In_Chain(hash, modified_list[i].func);
+
                     if (auto trampoline = hook_manager.Get_Trampoline(hash))
                         modified_list[i].func = trampoline;
                 }
@@ -263,6 +317,9 @@ namespace Samp_SDK {
         }
         
         inline int SAMP_SDK_CDECL Amx_Exec_Detour(AMX* amx, cell* retval, int index) {
+            if (SAMP_SDK_UNLIKELY(amx->flags & AMX_FLAG_BROWSE))
+                return Get_Amx_Exec_Hook().Call_Original(amx, retval, index);
+
             auto& manager = Interceptor_Manager::Instance();
             
             std::unique_ptr<std::string> public_name_ptr;
@@ -272,6 +329,10 @@ namespace Samp_SDK {
             else if (index != AMX_EXEC_CONT && tl_public_name)
                 public_name_ptr = std::move(tl_public_name);
 
+            uint32_t public_hash = public_name_ptr ? FNV1a_Hash(public_name_ptr->c_str()) : 0;
+            Call_Scope call_scope(Trace_Category::Public, public_hash, public_name_ptr.get(), amx);
+            Traffic_Scope traffic_scope(public_name_ptr ? amx : nullptr, public_hash, public_name_ptr ? public_name_ptr->c_str() : nullptr, retval, index == AMX_EXEC_MAIN);
+
             if (public_name_ptr) {
                 if (Get_Public_Handler()) {
                     cell result = 1;
@@ -289,7 +350,7 @@ namespace Samp_SDK {
                 }
 
                 cell result = 1;
-                bool should_continue = Public_Dispatcher::Instance().Dispatch(FNV1a_Hash(public_name_ptr->c_str()), amx, result);
+                bool should_continue = Public_Dispatcher::Instance().Dispatch(public_hash, amx, result);
 
                 if (!should_continue) {
                     if (retval)
@@ -307,7 +368,18 @@ namespace Samp_SDK {
                 }
             }
             
-            int exec_result = Get_Amx_Exec_Hook().Call_Original(amx, retval, index);
+            int exec_result;
+            Jit_Program* program = (index >= 0 || index == AMX_EXEC_MAIN || index == AMX_EXEC_CONT) ? Amx_Jit::Instance().Find(amx) : nullptr;
+            Budget_Scope budget_scope(amx, !program || !program->Is_Metered());
+            Memory_Scope memory_scope(amx, index);
+
+            if (program)
+                exec_result = program->Exec(amx, retval, index, budget_scope.Get_Meter());
+            else
+                exec_result = Get_Amx_Exec_Hook().Call_Original(amx, retval, index);
+
+            budget_scope.Check(amx, exec_result, public_name_ptr ? public_name_ptr->c_str() : nullptr, index);
+            memory_scope.Check(amx, exec_result, public_name_ptr ? public_name_ptr->c_str() : nullptr);
 
             if (!manager.Is_Amx_Patched(amx)) {
                 auto& hook_manager = Native_Hook_Manager::Instance();
@@ -328,11 +400,17 @@ namespace Samp_SDK {
 
                             if (FNV1a_Hash(native_name) == hook_hash) {
                                 AMX_NATIVE current_func = reinterpret_cast<AMX_NATIVE>(natives[i].address);
-                                
-                                hook_to_apply.Set_Next_In_Chain(current_func);
-
                                 AMX_NATIVE trampoline = hook_manager.Get_Trampoline(hook_hash);
 
+                                if (current_func == trampoline) {
+                                    if (Native_Hook* front = hook_manager.Find_Hook(hook_hash))
+                                        hook_to_apply.Set_Next_In_Chain(front->Get_Next_In_Chain());
+
+                                    break;
+                                }
+
+                                hook_to_apply.Set_Next_In_Chain(current_func);
+
                                 if (trampoline)
                                     natives[i].address = reinterpret_cast<ucell>(trampoline);
                                 
@@ -341,6 +419,14 @@ namespace Samp_SDK {
                         }
                     }
                 }
+
+                bool default_callback = amx->callback == reinterpret_cast<AMX_CALLBACK>(Core::Instance().Get_AMX_Export(PLUGIN_AMX_EXPORT_Callback));
+
+                if (default_callback && Amx_Sysreq_Rewriter::Instance().Is_Enabled())
+                    Amx_Sysreq_Rewriter::Instance().Rewrite(amx, Get_Amx_Opcode_List(amx));
+
+                if (Amx_Jit::Instance().Is_Enabled() && Can_Jit_Bypass_Exec())
+                    Amx_Jit::Instance().Compile(amx, Get_Amx_Opcode_List(amx), default_callback, Exec_Budget::Instance().Is_Enabled());
                 
                 manager.On_Amx_Patched(amx);
             }
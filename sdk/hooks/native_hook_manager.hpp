@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <utility>
 #include <vector>
@@ -46,6 +47,8 @@
 #include "assembly.hpp"
 #include "../utils/hash.hpp"
 #include "../utils/logger.hpp"
+#include "../diagnostics/call_scope.hpp"
+#include "../diagnostics/traffic_recorder.hpp"
 
 #if defined(SAMP_SDK_WINDOWS)
     #include <windows.h>
@@ -65,9 +68,16 @@ namespace Samp_SDK {
         class Native_Hook {
             public:
                 using Handler_Func = std::function<cell(AMX*, cell*)>;
-                Native_Hook(uint32_t hash, Handler_Func handler) : hash_(hash), user_handler_(std::move(handler)), next_in_chain_(nullptr) {}
+                Native_Hook(uint32_t hash, Handler_Func handler, const char* name = nullptr, const void* owner = nullptr) : hash_(hash), name_(name), owner_(owner), user_handler_(std::move(handler)), next_in_chain_(nullptr) {}
 
                 cell Dispatch(AMX* amx, cell* params) {
+                    Call_Scope call_scope(Trace_Category::Native, name_, amx);
+                    Traffic_Scope traffic_scope(amx, hash_, name_, params);
+
+                    return traffic_scope.Finish(Invoke(amx, params));
+                }
+
+                cell Invoke(AMX* amx, cell* params) {
                     if (!user_handler_)
                         return Call_Original(amx, params);
 
@@ -75,12 +85,15 @@ namespace Samp_SDK {
                 }
 
                 cell Call_Original(AMX* amx, cell* params) {
+                    if (shadowed_)
+                        return shadowed_->Invoke(amx, params);
+
                     AMX_NATIVE next = next_in_chain_.load(std::memory_order_relaxed);
 
                     if (next != nullptr)
                         return next(amx, params);
 
-                    Log("[SA-MP SDK] Error: Next function in chain for hook hash %u is null. The hook chain is broken.", hash_);
+                    SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Error: Next function in chain for hook hash %u is null. The hook chain is broken.", hash_);
 
                     return 0;
                 }
@@ -89,12 +102,44 @@ namespace Samp_SDK {
                     next_in_chain_.store(next_func, std::memory_order_relaxed);
                 }
 
+                [[nodiscard]] AMX_NATIVE Get_Next_In_Chain() const {
+                    return next_in_chain_.load(std::memory_order_relaxed);
+                }
+
+                [[nodiscard]] const void* Get_Owner() const {
+                    return owner_;
+                }
+
+                void Release() {
+                    user_handler_ = nullptr;
+                    owner_ = nullptr;
+                }
+
+                void Set_Handler(Handler_Func handler) {
+                    user_handler_ = std::move(handler);
+                }
+
+                void Set_Shadowed(Native_Hook* shadowed) {
+                    shadowed_ = shadowed;
+                }
+
+                [[nodiscard]] Native_Hook* Get_Shadowed() const {
+                    return shadowed_;
+                }
+
                 uint32_t Get_Hash() const {
                     return hash_;
                 }
 
+                const char* Get_Name() const {
+                    return name_;
+                }
+
             private:
                 uint32_t hash_;
+                const char* name_;
+                const void* owner_;
+                Native_Hook* shadowed_ = nullptr;
                 Handler_Func user_handler_;
                 std::atomic<AMX_NATIVE> next_in_chain_;
         };
@@ -175,9 +220,23 @@ namespace Samp_SDK {
                     return instance;
                 }
 
-                void Register_Hook(uint32_t hash, Native_Hook::Handler_Func handler) {
+                Native_Hook& Register_Hook(uint32_t hash, Native_Hook::Handler_Func handler, const char* name = nullptr, const void* owner = nullptr) {
                     Unique_Lock<Shared_Mutex_Type> lock(mtx_);
-                    hooks_.emplace_front(hash, handler);
+                    auto it = std::find_if(hooks_.begin(), hooks_.end(), [hash](const Native_Hook& hook) { return hook.Get_Hash() == hash; });
+
+                    hooks_.emplace_front(hash, handler, name, owner);
+                    hooks_.front().Set_Shadowed(it != hooks_.end() ? &*it : nullptr);
+
+                    return hooks_.front();
+                }
+
+                void Release_Owner(const void* owner) {
+                    Unique_Lock<Shared_Mutex_Type> lock(mtx_);
+
+                    for (auto& hook : hooks_) {
+                        if (hook.Get_Owner() == owner)
+                            hook.Release();
+                    }
                 }
          
                 [[nodiscard]] Native_Hook* Find_Hook(uint32_t hash) {
@@ -191,6 +250,32 @@ namespace Samp_SDK {
                     return nullptr;
                 }
            
+                template <typename Predicate>
+                std::vector<Native_Hook*> Unlink_Next_In_Chain(Predicate predicate) {
+                    Unique_Lock<Shared_Mutex_Type> lock(mtx_);
+                    std::vector<Native_Hook*> unlinked;
+
+                    for (auto& hook : hooks_) {
+                        AMX_NATIVE next = hook.Get_Next_In_Chain();
+
+                        if (next && predicate(next)) {
+                            hook.Set_Next_In_Chain(nullptr);
+                            unlinked.push_back(&hook);
+                        }
+                    }
+
+                    return unlinked;
+                }
+
+                void Relink_Next_In_Chain(uint32_t hash, AMX_NATIVE next_func) {
+                    Unique_Lock<Shared_Mutex_Type> lock(mtx_);
+
+                    for (auto& hook : hooks_) {
+                        if (hook.Get_Hash() == hash && !hook.Get_Next_In_Chain())
+                            hook.Set_Next_In_Chain(next_func);
+                    }
+                }
+
                 [[nodiscard]] std::list<Native_Hook>& Get_All_Hooks() {
                     return hooks_;
                 }
@@ -222,9 +307,56 @@ namespace Samp_SDK {
                     Trampoline_Func trampoline = reinterpret_cast<Trampoline_Func>(trampoline_addr);
                     hash_to_trampoline_[hash] = trampoline;
                     hook_id_to_hash_.push_back(hash);
+                    hook_id_to_hook_.push_back(nullptr);
+
+                    return trampoline;
+                }
+
+                [[nodiscard]] Trampoline_Func Get_Hook_Trampoline(Native_Hook& hook) {
+                    {
+                        Shared_Lock<Shared_Mutex_Type> lock(mtx_);
+                        auto it = hook_to_trampoline_.find(&hook);
+
+                        if (it != hook_to_trampoline_.end())
+                            return it->second;
+                    }
+
+                    Unique_Lock<Shared_Mutex_Type> lock(mtx_);
+
+                    auto it = hook_to_trampoline_.find(&hook);
+
+                    if (it != hook_to_trampoline_.end())
+                        return it->second;
+
+                    int new_hook_id = static_cast<int>(hook_id_to_hash_.size());
+                    void* trampoline_addr = trampoline_allocator_.Allocate(new_hook_id);
+
+                    if (!trampoline_addr)
+                        return nullptr;
+
+                    Trampoline_Func trampoline = reinterpret_cast<Trampoline_Func>(trampoline_addr);
+                    hook_to_trampoline_[&hook] = trampoline;
+                    hook_id_to_hash_.push_back(hook.Get_Hash());
+                    hook_id_to_hook_.push_back(&hook);
 
                     return trampoline;
                 }
+
+                [[nodiscard]] AMX_NATIVE Get_Continuation(Native_Hook& hook) {
+                    if (Native_Hook* shadowed = hook.Get_Shadowed())
+                        return Get_Hook_Trampoline(*shadowed);
+
+                    return hook.Get_Next_In_Chain();
+                }
+
+                [[nodiscard]] Native_Hook* Get_Hook_From_Id(int hook_id) {
+                    Shared_Lock<Shared_Mutex_Type> lock(mtx_);
+
+                    if (hook_id >= 0 && static_cast<size_t>(hook_id) < hook_id_to_hook_.size())
+                        return hook_id_to_hook_[hook_id];
+
+                    return nullptr;
+                }
                
                 [[nodiscard]] uint32_t Get_Hash_From_Id(int hook_id) {
                     Shared_Lock<Shared_Mutex_Type> lock(mtx_);
@@ -243,7 +375,9 @@ namespace Samp_SDK {
                 
                 Trampoline_Allocator trampoline_allocator_;
                 std::unordered_map<uint32_t, Trampoline_Func> hash_to_trampoline_;
+                std::unordered_map<Native_Hook*, Trampoline_Func> hook_to_trampoline_;
                 std::vector<uint32_t> hook_id_to_hash_;
+                std::vector<Native_Hook*> hook_id_to_hook_;
         };
         
     }
@@ -252,17 +386,21 @@ namespace Samp_SDK {
 extern "C" {
     inline cell SAMP_SDK_CDECL SAMP_SDK_USED_BY_ASM Dispatch_Hook(int hook_id, AMX* amx, cell* params) {
         auto& instance = Samp_SDK::Detail::Native_Hook_Manager::Instance();
+
+        if (Samp_SDK::Detail::Native_Hook* direct = instance.Get_Hook_From_Id(hook_id))
+            return direct->Invoke(amx, params);
+
         uint32_t hash = instance.Get_Hash_From_Id(hook_id);
         
         if (hash == 0)
-            return (Samp_SDK::Log("[SA-MP SDK] Fatal: Trampoline called with invalid hook_id %d.", hook_id), 0);
+            return (SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Fatal: Trampoline called with invalid hook_id %d.", hook_id), 0);
 
         Samp_SDK::Detail::Native_Hook* hook = instance.Find_Hook(hash);
 
         if (hook)
             return hook->Dispatch(amx, params);
 
-        Samp_SDK::Log("[SA-MP SDK] Fatal: Trampoline for hash %u (id %d) called but no hook found.", hash, hook_id);
+        SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Fatal: Trampoline for hash %u (id %d) called but no hook found.", hash, hook_id);
 
         return 0;
     }
@@ -276,7 +414,7 @@ extern "C" {
         if (hook) \
             return hook->Call_Original(amx, params); \
         \
-        Samp_SDK::Log("[SA-MP SDK] Error: Could not call original native '%s', no hook found.", #name); \
+        SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Error: Could not call original native '%s', no hook found.", #name); \
         \
         return 0; \
     })(amx, params)
@@ -286,7 +424,7 @@ extern "C" {
         public: \
             Native_Hook_Register_##name() { \
                 constexpr uint32_t hash = Samp_SDK::Detail::FNV1a_Hash_Const(#name); \
-                Samp_SDK::Detail::Native_Hook_Manager::Instance().Register_Hook(hash, &Hook_##name); \
+                Samp_SDK::Detail::Native_Hook_Manager::Instance().Register_Hook(hash, &Hook_##name, #name); \
             } \
     }; \
     static Native_Hook_Register_##name register_hook_##name;
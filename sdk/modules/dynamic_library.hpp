@@ -96,6 +96,48 @@ namespace Samp_SDK {
                 [[nodiscard]] bool Is_Loaded() const {
                     return handle_ != nullptr;
                 }
+
+                [[nodiscard]] static bool Is_Resident(const std::string& path) {
+#if defined(SAMP_SDK_WINDOWS)
+                    return GetModuleHandleA(path.c_str()) != nullptr;
+#elif defined(SAMP_SDK_LINUX)
+                    void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_NOLOAD);
+
+                    if (!handle)
+                        return false;
+
+                    dlclose(handle);
+
+                    return true;
+#endif
+                }
+
+                [[nodiscard]] bool Contains(const void* address) const {
+                    if (!handle_ || !address)
+                        return false;
+#if defined(SAMP_SDK_WINDOWS)
+                    HMODULE owner = nullptr;
+
+                    if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, reinterpret_cast<LPCSTR>(address), &owner))
+                        return false;
+
+                    return reinterpret_cast<void*>(owner) == handle_;
+#elif defined(SAMP_SDK_LINUX)
+                    Dl_info info;
+
+                    if (!dladdr(address, &info) || !info.dli_fname)
+                        return false;
+
+                    void* owner = dlopen(info.dli_fname, RTLD_NOW | RTLD_NOLOAD);
+
+                    if (!owner)
+                        return false;
+
+                    dlclose(owner);
+
+                    return owner == handle_;
+#endif
+                }
                 
             private:
                 void* handle_ = nullptr;
@@ -0,0 +1,198 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+//
+#include "../amx/amx_defs.h"
+#include "../amx/amx_manager.hpp"
+#include "../core/platform.hpp"
+#include "../events/public_dispatcher.hpp"
+#include "../hooks/native_hook_manager.hpp"
+#include "../hooks/interceptor_manager.hpp"
+#include "../utils/logger.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        constexpr uint32_t MODULE_LINK_VERSION = 1;
+
+        using Module_Public_Func = cell (SAMP_SDK_CDECL*)(uint32_t hash, AMX* amx);
+        using Module_Native_Func = cell (SAMP_SDK_CDECL*)(uint32_t hash, AMX* amx, cell* params, AMX_NATIVE next);
+        using Module_Amx_Func = void (SAMP_SDK_CDECL*)(AMX* amx, int loaded);
+
+        struct Module_Host_Api {
+            uint32_t version;
+            uint32_t size;
+            void* context;
+            void (SAMP_SDK_CDECL* register_public)(void* context, uint32_t hash, Module_Public_Func func);
+            void (SAMP_SDK_CDECL* register_native_hook)(void* context, uint32_t hash, const char* name, Module_Native_Func func);
+            void (SAMP_SDK_CDECL* set_amx_listener)(void* context, Module_Amx_Func func);
+            AMX_NATIVE (SAMP_SDK_CDECL* find_native)(uint32_t hash);
+        };
+
+        class Module_Link {
+            public:
+                static Module_Link& Instance() {
+                    static Module_Link instance;
+
+                    return instance;
+                }
+
+                int Bind(const Module_Host_Api* host) {
+                    if (!host || host->version != MODULE_LINK_VERSION || host->size < sizeof(Module_Host_Api))
+                        return (Log("[SA-MP SDK] Warning: Parent plugin offered an incompatible module link, running standalone."), 0);
+
+                    host_ = host;
+
+                    return 1;
+                }
+
+                bool Attach() {
+                    if (!host_)
+                        return false;
+
+                    for (uint32_t hash : Public_Dispatcher::Instance().Get_Hashes())
+                        host_->register_public(host_->context, hash, &Module_Link::Dispatch_Public);
+
+                    for (const auto& hook : Native_Hook_Manager::Instance().Get_All_Hooks())
+                        host_->register_native_hook(host_->context, hook.Get_Hash(), hook.Get_Name(), &Module_Link::Dispatch_Native);
+
+                    Interceptor_Manager::Instance().Set_Native_Resolver(host_->find_native);
+                    host_->set_amx_listener(host_->context, &Module_Link::On_Host_Amx);
+
+                    return true;
+                }
+
+                [[nodiscard]] bool Is_Linked() const {
+                    return host_ != nullptr;
+                }
+
+                void Init_Host_Api(Module_Host_Api& api, void* context) {
+                    api.version = MODULE_LINK_VERSION;
+                    api.size = sizeof(Module_Host_Api);
+                    api.context = context;
+                    api.register_public = &Module_Link::Host_Register_Public;
+                    api.register_native_hook = &Module_Link::Host_Register_Native_Hook;
+                    api.set_amx_listener = &Module_Link::Host_Set_Amx_Listener;
+                    api.find_native = &Module_Link::Host_Find_Native;
+                }
+
+                void Release(void* context) {
+                    Public_Dispatcher::Instance().Unregister(context);
+                    Native_Hook_Manager::Instance().Release_Owner(context);
+
+                    listeners_.erase(context);
+
+                    if (listeners_.empty())
+                        Amx_Manager::Instance().Set_Observer(nullptr);
+                }
+
+            private:
+                Module_Link() = default;
+
+                static cell SAMP_SDK_CDECL Dispatch_Public(uint32_t hash, AMX* amx) {
+                    cell result = 1;
+
+                    Public_Dispatcher::Instance().Dispatch(hash, amx, result);
+
+                    return result;
+                }
+
+                static cell SAMP_SDK_CDECL Dispatch_Native(uint32_t hash, AMX* amx, cell* params, AMX_NATIVE next) {
+                    Native_Hook* hook = Native_Hook_Manager::Instance().Find_Hook(hash);
+
+                    if (!hook)
+                        return next ? next(amx, params) : 0;
+
+                    Native_Hook* tail = hook;
+
+                    while (tail->Get_Shadowed())
+                        tail = tail->Get_Shadowed();
+
+                    tail->Set_Next_In_Chain(next);
+
+                    return hook->Invoke(amx, params);
+                }
+
+                static void SAMP_SDK_CDECL On_Host_Amx(AMX* amx, int loaded) {
+                    if (loaded)
+                        Amx_Manager::Instance().Add_Amx(amx);
+                    else
+                        Amx_Manager::Instance().Remove_Amx(amx);
+                }
+
+                static void SAMP_SDK_CDECL Host_Register_Public(void* context, uint32_t hash, Module_Public_Func func) {
+                    Public_Dispatcher::Instance().Register(hash, [func, hash](AMX* amx) { return func(hash, amx); }, context);
+                }
+
+                static void SAMP_SDK_CDECL Host_Register_Native_Hook(void* context, uint32_t hash, const char* name, Module_Native_Func func) {
+                    auto& manager = Native_Hook_Manager::Instance();
+                    auto& names = Instance().names_;
+                    auto it = names.find(hash);
+
+                    if (it == names.end())
+                        it = names.emplace(hash, name ? name : "").first;
+
+                    Native_Hook& hook = manager.Register_Hook(hash, nullptr, it->second.c_str(), context);
+
+                    hook.Set_Handler([func, hash, &hook](AMX* amx, cell* params) {
+                        return func(hash, amx, params, Native_Hook_Manager::Instance().Get_Continuation(hook));
+                    });
+                }
+
+                static void SAMP_SDK_CDECL Host_Set_Amx_Listener(void* context, Module_Amx_Func func) {
+                    Instance().listeners_[context] = func;
+                    Amx_Manager::Instance().Set_Observer(&Module_Link::Notify_Listeners);
+
+                    for (AMX* amx : Amx_Manager::Instance().Get_Amx_Instances())
+                        func(amx, 1);
+                }
+
+                static AMX_NATIVE SAMP_SDK_CDECL Host_Find_Native(uint32_t hash) {
+                    return Interceptor_Manager::Instance().Find_Cached_Native(hash);
+                }
+
+                static void Notify_Listeners(AMX* amx, bool loaded) {
+                    for (const auto& [context, func] : Instance().listeners_)
+                        func(amx, loaded ? 1 : 0);
+                }
+
+                const Module_Host_Api* host_ = nullptr;
+                std::unordered_map<void*, Module_Amx_Func> listeners_;
+                std::unordered_map<uint32_t, std::string> names_;
+        };
+    }
+}
\ No newline at end of file
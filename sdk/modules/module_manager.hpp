@@ -36,10 +36,26 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <unordered_map>
+#include <condition_variable>
 //
 #include "dynamic_library.hpp"
+#include "module_link.hpp"
+#include "../utils/hash.hpp"
 #include "../utils/logger.hpp"
+#include "../amx/amx_api.hpp"
 #include "../amx/amx_defs.h"
+#include "../amx/amx_manager.hpp"
+#include "../amx/amx_jit.hpp"
+#include "../amx/amx_sysreq.hpp"
+#include "../core/core.hpp"
+#include "../hooks/interceptor_manager.hpp"
 
 namespace Samp_SDK {
     namespace Detail {
@@ -49,6 +65,14 @@ namespace Samp_SDK {
         using Module_AmxLoad_t = void (SAMP_SDK_CALL *)(AMX *amx);
         using Module_AmxUnload_t = void (SAMP_SDK_CALL *)(AMX *amx);
         using Module_ProcessTick_t = void (SAMP_SDK_CALL *)();
+        using Module_Bind_t = int (SAMP_SDK_CALL *)(const void* host);
+        using Module_Save_State_t = int (SAMP_SDK_CALL *)(const void* writer);
+        using Module_Restore_State_t = int (SAMP_SDK_CALL *)(const void* data, uint32_t size);
+
+        struct Module_State_Writer {
+            void* context;
+            void (SAMP_SDK_CDECL* write)(void* context, const void* data, uint32_t size);
+        };
 
         class Module {
             public:
@@ -59,6 +83,12 @@ namespace Samp_SDK {
                 }
 
                 bool Load(const std::string& path, void** ppData) {
+                    return Open(path) && Start(ppData);
+                }
+
+                bool Open(const std::string& path) {
+                    path_ = path;
+
                     if (!library_.Load(path))
                         return false;
 
@@ -73,15 +103,40 @@ namespace Samp_SDK {
                         return false;
                     }
 
+                    load_func_ = load_func;
                     unload_func_ = unload_func;
                     supports_func_ = supports_func;
 
                     amx_load_func_ = library_.Get_Function<Module_AmxLoad_t>("AmxLoad");
                     amx_unload_func_ = library_.Get_Function<Module_AmxUnload_t>("AmxUnload");
                     process_tick_func_ = library_.Get_Function<Module_ProcessTick_t>("ProcessTick");
+                    parallel_tick_func_ = library_.Get_Function<Module_ProcessTick_t>("ProcessTick_Parallel");
+                    bind_func_ = library_.Get_Function<Module_Bind_t>("Module_Bind");
+                    save_state_func_ = library_.Get_Function<Module_Save_State_t>("Save_State");
+                    restore_state_func_ = library_.Get_Function<Module_Restore_State_t>("Restore_State");
+
+                    return true;
+                }
+
+                bool Start(void** ppData) {
+                    if (!library_.Is_Loaded() || !load_func_)
+                        return false;
+
+                    plugin_data_ = ppData;
+
+                    bool bound = false;
+
+                    if (bind_func_ && !Module_Link::Instance().Is_Linked()) {
+                        Module_Link::Instance().Init_Host_Api(host_api_, this);
+                        bound = bind_func_(&host_api_) != 0;
+                    }
+
+                    if (!bound)
+                        parallel_tick_func_ = nullptr;
                     
-                    if (!load_func(ppData)) {
+                    if (!load_func_(ppData)) {
                         Log("[SAMP-SDK] Error: Module '%s' failed to initialize (Load function returned false).", name_.c_str());
+                        Module_Link::Instance().Release(this);
                         library_.Unload();
 
                         return false;
@@ -90,8 +145,41 @@ namespace Samp_SDK {
                     return true;
                 }
 
+                void Close() {
+                    library_.Unload();
+                }
+
+                bool Save_State(std::vector<unsigned char>& state) {
+                    if (!save_state_func_)
+                        return false;
+
+                    Module_State_Writer writer{&state, &Module::Append_State};
+
+                    return save_state_func_(&writer) != 0;
+                }
+
+                bool Restore_State(const std::vector<unsigned char>& state) {
+                    if (!restore_state_func_)
+                        return false;
+
+                    return restore_state_func_(state.data(), static_cast<uint32_t>(state.size())) != 0;
+                }
+
+                [[nodiscard]] bool Contains(const void* address) const {
+                    return library_.Contains(address);
+                }
+
+                const std::string& Get_Path() const {
+                    return path_;
+                }
+
+                void** Get_Plugin_Data() const {
+                    return plugin_data_;
+                }
+
                 void Unload() {
                     if (library_.Is_Loaded() && unload_func_) {
+                        Module_Link::Instance().Release(this);
                         unload_func_();
                         library_.Unload();
                     }
@@ -109,18 +197,40 @@ namespace Samp_SDK {
                     return process_tick_func_;
                 }
 
+                Module_ProcessTick_t Get_Parallel_Tick_Func() const {
+                    return parallel_tick_func_;
+                }
+
             private:
+                static void SAMP_SDK_CDECL Append_State(void* context, const void* data, uint32_t size) {
+                    auto* state = static_cast<std::vector<unsigned char>*>(context);
+                    const auto* bytes = static_cast<const unsigned char*>(data);
+
+                    state->insert(state->end(), bytes, bytes + size);
+                }
+
                 std::string name_;
+                std::string path_;
+                void** plugin_data_ = nullptr;
                 Dynamic_Library library_;
+                Module_Load_t load_func_ = nullptr;
                 Module_Unload_t unload_func_ = nullptr;
                 Module_Supports_t supports_func_ = nullptr;
                 Module_AmxLoad_t amx_load_func_ = nullptr;
                 Module_AmxUnload_t amx_unload_func_ = nullptr;
                 Module_ProcessTick_t process_tick_func_ = nullptr;
+                Module_ProcessTick_t parallel_tick_func_ = nullptr;
+                Module_Bind_t bind_func_ = nullptr;
+                Module_Save_State_t save_state_func_ = nullptr;
+                Module_Restore_State_t restore_state_func_ = nullptr;
+                Module_Host_Api host_api_{};
+                bool parallel_tick_ = false;
         };
 
         class Module_Manager {
             public:
+                static constexpr size_t MAX_LAZY_NATIVES = 256;
+
                 static Module_Manager& Instance() {
                     static Module_Manager instance;
 
@@ -128,70 +238,621 @@ namespace Samp_SDK {
                 }
 
                 bool Load_Module(const std::string& name, const std::string& path, const std::string& success_msg, void** ppData) {
-                    auto it = std::find_if(loaded_modules_.begin(), loaded_modules_.end(), [&](const auto& module_ptr) {
-                        return module_ptr->Get_Name() == name;
-                    });
-
-                    if (it != loaded_modules_.end())
+                    if (Find_Module(name))
                         return (Log("[SAMP-SDK] Error: A module with the name '%s' is already loaded.", name.c_str()), false);
-                    
-                    std::string full_path = path;
-
-                    if (!path.empty() && path.back() != '/' && path.back() != '\\')
-                        full_path += '/';
-
-                    full_path += name;
-
-#if defined(SAMP_SDK_WINDOWS)
-                    full_path += ".dll";
-#elif defined(SAMP_SDK_LINUX)
-                    full_path += ".so";
-#endif
 
                     auto module = std::make_unique<Module>(name);
 
-                    if (module->Load(full_path, ppData)) {
-                        if (!success_msg.empty())
-                            Log(success_msg.c_str());
+                    if (module->Load(Build_Module_Path(name, path), ppData)) {
+                        Add_Module(std::move(module), success_msg);
 
-                        loaded_modules_.push_back(std::move(module));
                         return true;
                     }
                     
                     return false;
                 }
 
+                void Declare_Module(const std::string& name, const std::string& path, std::vector<std::string> depends_on = {}, const std::string& success_msg = {}) {
+                    declared_modules_.push_back({name, path, std::move(depends_on), success_msg});
+                }
+
+                bool Load_Declared_Modules(void** ppData) {
+                    std::vector<Module_Declaration> declared = std::move(declared_modules_);
+                    size_t count = declared.size();
+                    std::vector<std::unique_ptr<Module>> modules(count);
+                    std::vector<Module_State> states(count, Module_State::Pending);
+                    bool all_loaded = true;
+
+                    declared_modules_.clear();
+
+                    for (size_t i = 0; i < count; ++i) {
+                        if (Find_Module(declared[i].name)) {
+                            Log("[SAMP-SDK] Error: A module with the name '%s' is already loaded.", declared[i].name.c_str());
+                            states[i] = Module_State::Failed;
+                            all_loaded = false;
+
+                            continue;
+                        }
+
+                        modules[i] = std::make_unique<Module>(declared[i].name);
+
+                        if (!modules[i]->Open(Build_Module_Path(declared[i].name, declared[i].path)))
+                            states[i] = Module_State::Failed;
+                    }
+
+                    bool progress = true;
+
+                    while (progress) {
+                        progress = false;
+
+                        for (size_t i = 0; i < count; ++i) {
+                            if (states[i] == Module_State::Loaded || (states[i] == Module_State::Failed && !modules[i]))
+                                continue;
+
+                            bool ready = true;
+                            const char* failed_dependency = nullptr;
+
+                            for (const auto& dependency : declared[i].depends_on) {
+                                if (Find_Module(dependency))
+                                    continue;
+
+                                auto it = std::find_if(declared.begin(), declared.end(), [&](const Module_Declaration& other) { return other.name == dependency; });
+
+                                if (it == declared.end() || states[it - declared.begin()] == Module_State::Failed) {
+                                    failed_dependency = dependency.c_str();
+
+                                    break;
+                                }
+
+                                ready = false;
+                            }
+
+                            if (!ready && !failed_dependency && states[i] != Module_State::Failed)
+                                continue;
+
+                            progress = true;
+
+                            if (failed_dependency && states[i] != Module_State::Failed)
+                                Log("[SAMP-SDK] Error: Module '%s' was not loaded because its dependency '%s' is unavailable.", declared[i].name.c_str(), failed_dependency);
+
+                            if (states[i] == Module_State::Failed || failed_dependency || !modules[i]->Start(ppData)) {
+                                modules[i]->Close();
+                                modules[i].reset();
+                                states[i] = Module_State::Failed;
+                                all_loaded = false;
+
+                                continue;
+                            }
+
+                            states[i] = Module_State::Loaded;
+                            Add_Module(std::move(modules[i]), declared[i].success_msg);
+                        }
+                    }
+
+                    for (size_t i = 0; i < count; ++i) {
+                        if (states[i] == Module_State::Pending) {
+                            Log("[SAMP-SDK] Error: Module '%s' was not loaded because its dependencies form a cycle.", declared[i].name.c_str());
+                            modules[i]->Close();
+                            all_loaded = false;
+                        }
+                    }
+
+                    return all_loaded;
+                }
+
+                bool Declare_Lazy_Module(const std::string& name, const std::string& path, const std::vector<std::string>& natives, void** ppData, const std::string& success_msg = {}) {
+                    if (lazy_slot_count_ + natives.size() > MAX_LAZY_NATIVES)
+                        return (Log("[SAMP-SDK] Error: Module '%s' declares too many lazy natives (limit is %u).", name.c_str(), static_cast<unsigned int>(MAX_LAZY_NATIVES)), false);
+
+                    auto lazy = std::make_unique<Lazy_Module>();
+
+                    lazy->name = name;
+                    lazy->path = path;
+                    lazy->success_msg = success_msg;
+                    lazy->ppData = ppData;
+                    lazy->native_names = natives;
+
+                    for (size_t i = 0; i < natives.size(); ++i) {
+                        size_t slot = lazy_slot_count_++;
+
+                        lazy_slots_[slot].hash = FNV1a_Hash(natives[i].c_str());
+                        lazy_slots_[slot].module = lazy.get();
+                        lazy->slots.push_back(slot);
+                        lazy->stubs.push_back({lazy->native_names[i].c_str(), Lazy_Stubs()[slot]});
+                    }
+
+                    lazy_modules_.push_back(std::move(lazy));
+
+                    return true;
+                }
+
+                bool Reload_Module(const std::string& name, const std::string& path = {}) {
+#if !defined(SAMP_SDK_WANT_PROCESS_TICK)
+                    return (Log("[SAMP-SDK] Error: Cannot reload module '%s', reloads run from ProcessTick and SAMP_SDK_WANT_PROCESS_TICK is not defined.", name.c_str()), false);
+#endif
+                    if (!Find_Module(name))
+                        return (Log("[SAMP-SDK] Error: Cannot reload module '%s' because it is not loaded.", name.c_str()), false);
+
+                    pending_reloads_.emplace_back(name, path);
+
+                    return true;
+                }
+
                 void Unload_All_Modules() {
+                    pending_reloads_.clear();
+                    Stop_Tick_Workers();
+
                     for (auto it = loaded_modules_.rbegin(); it != loaded_modules_.rend(); ++it)
                         (*it)->Unload();
 
                     loaded_modules_.clear();
+
+                    std::lock_guard<std::mutex> lock(lazy_mtx_);
+                    lazy_modules_.clear();
+
+                    for (size_t i = 0; i < lazy_slot_count_; ++i) {
+                        lazy_slots_[i].hash = 0;
+                        lazy_slots_[i].module = nullptr;
+                        lazy_slots_[i].real.store(nullptr, std::memory_order_relaxed);
+                    }
+
+                    lazy_slot_count_ = 0;
+                    Rebuild_Callback_Tables();
                 }
                 
                 void Forward_AmxLoad(AMX* amx) {
-                    for (const auto& module : loaded_modules_) {
-                        if (auto func = module->Get_AmxLoad_Func())
-                            func(amx);
+                    if (tables_dirty_)
+                        Rebuild_Callback_Tables();
+
+                    for (const auto& lazy : lazy_modules_) {
+                        if (lazy->state != Module_State::Loaded)
+                            amx::Register(amx, lazy->stubs.data(), static_cast<int>(lazy->stubs.size()));
                     }
+
+                    for (Module_AmxLoad_t func : amx_load_funcs_)
+                        func(amx);
                 }
 
                 void Forward_AmxUnload(AMX* amx) {
-                    for (auto it = loaded_modules_.rbegin(); it != loaded_modules_.rend(); ++it) {
-                        if (auto func = (*it)->Get_AmxUnload_Func())
-                            func(amx);
-                    }
+                    if (tables_dirty_)
+                        Rebuild_Callback_Tables();
+
+                    for (Module_AmxUnload_t func : amx_unload_funcs_)
+                        func(amx);
                 }
 
                 void Forward_ProcessTick() {
-                    for (const auto& module : loaded_modules_) {
-                        if (auto func = module->Get_ProcessTick_Func())
-                            func();
+                    if (SAMP_SDK_UNLIKELY(!pending_reloads_.empty()))
+                        Process_Pending_Reloads();
+
+                    if (tables_dirty_)
+                        Rebuild_Callback_Tables();
+
+                    for (Module_ProcessTick_t func : parallel_host_tick_funcs_)
+                        func();
+
+                    if (!parallel_tick_funcs_.empty())
+                        Start_Parallel_Ticks();
+
+                    for (Module_ProcessTick_t func : process_tick_funcs_)
+                        func();
+
+                    if (!parallel_tick_funcs_.empty()) {
+                        std::unique_lock<std::mutex> lock(tick_mtx_);
+                        tick_done_cv_.wait(lock, [this] { return tick_pending_ == 0; });
                     }
                 }
                 
             private:
+                enum class Module_State {
+                    Pending,
+                    Loading,
+                    Loaded,
+                    Failed
+                };
+
+                struct Module_Declaration {
+                    std::string name;
+                    std::string path;
+                    std::vector<std::string> depends_on;
+                    std::string success_msg;
+                };
+
+                struct Lazy_Module {
+                    std::string name;
+                    std::string path;
+                    std::string success_msg;
+                    void** ppData = nullptr;
+                    std::vector<std::string> native_names;
+                    std::vector<size_t> slots;
+                    std::vector<AMX_NATIVE_INFO> stubs;
+                    Module_State state = Module_State::Pending;
+                };
+
+                struct Detached_Native {
+                    AMX* amx;
+                    size_t index;
+                    ucell address;
+                };
+
+                struct Lazy_Slot {
+                    uint32_t hash = 0;
+                    Lazy_Module* module = nullptr;
+                    std::atomic<AMX_NATIVE> real{nullptr};
+                };
+
                 Module_Manager() = default;
+
+                template <size_t Index>
+                static cell SAMP_SDK_CDECL Lazy_Stub(AMX* amx, cell* params) {
+                    AMX_NATIVE real = Instance().lazy_slots_[Index].real.load(std::memory_order_acquire);
+
+                    if (SAMP_SDK_UNLIKELY(!real))
+                        real = Instance().Resolve_Lazy_Native(Index);
+
+                    return real ? real(amx, params) : Missing_Native(amx, params);
+                }
+
+                template <size_t... Index>
+                static std::array<AMX_NATIVE, sizeof...(Index)> Make_Lazy_Stubs(std::index_sequence<Index...>) {
+                    return {{&Lazy_Stub<Index>...}};
+                }
+
+                static const std::array<AMX_NATIVE, MAX_LAZY_NATIVES>& Lazy_Stubs() {
+                    static const auto stubs = Make_Lazy_Stubs(std::make_index_sequence<MAX_LAZY_NATIVES>{});
+
+                    return stubs;
+                }
+
+                AMX_NATIVE Resolve_Lazy_Native(size_t index) {
+                    std::unique_lock<std::mutex> lock(lazy_mtx_);
+                    Lazy_Slot& slot = lazy_slots_[index];
+                    Lazy_Module* lazy = slot.module;
+
+                    if (!lazy || lazy->state != Module_State::Pending)
+                        return slot.real.load(std::memory_order_acquire);
+
+                    lazy->state = Module_State::Loading;
+
+                    std::string name = lazy->name;
+                    std::string path = Build_Module_Path(lazy->name, lazy->path);
+                    void** ppData = lazy->ppData;
+
+                    lock.unlock();
+
+                    auto module = std::make_unique<Module>(name);
+                    bool loaded = module->Load(path, ppData);
+
+                    if (loaded) {
+                        if (auto func = module->Get_AmxLoad_Func()) {
+                            for (AMX* amx : Amx_Manager::Instance().Get_Amx_Instances())
+                                func(amx);
+                        }
+                    }
+
+                    lock.lock();
+
+                    if (slot.module != lazy) {
+                        if (loaded)
+                            module->Unload();
+
+                        return nullptr;
+                    }
+
+                    if (!loaded) {
+                        lazy->state = Module_State::Failed;
+
+                        return (Log("[SAMP-SDK] Error: Lazy module '%s' could not be loaded on first use.", name.c_str()), nullptr);
+                    }
+
+                    lazy->state = Module_State::Loaded;
+                    Add_Module(std::move(module), lazy->success_msg);
+
+                    for (size_t i = 0; i < lazy->slots.size(); ++i) {
+                        Lazy_Slot& entry = lazy_slots_[lazy->slots[i]];
+                        AMX_NATIVE real = Interceptor_Manager::Instance().Find_Cached_Native(entry.hash);
+
+                        if (real == Lazy_Stubs()[lazy->slots[i]])
+                            real = nullptr;
+
+                        if (!real)
+                            Log("[SAMP-SDK] Error: Lazy module '%s' did not register its declared native '%s'.", lazy->name.c_str(), lazy->native_names[i].c_str());
+
+                        entry.real.store(real, std::memory_order_release);
+                    }
+
+                    return slot.real.load(std::memory_order_acquire);
+                }
+
+                static cell SAMP_SDK_CDECL Missing_Native(AMX* amx, cell* params) {
+                    (void)params;
+                    amx::Raise_Error(amx, static_cast<int>(Amx_Error::NotFound));
+
+                    return 0;
+                }
+
+                void Start_Parallel_Ticks() {
+                    size_t hardware = std::thread::hardware_concurrency();
+                    size_t wanted = std::min(parallel_tick_funcs_.size(), hardware > 1 ? hardware - 1 : size_t(1));
+
+                    while (tick_workers_.size() < wanted)
+                        tick_workers_.emplace_back(&Module_Manager::Run_Tick_Worker, this, tick_generation_);
+
+                    {
+                        std::lock_guard<std::mutex> lock(tick_mtx_);
+                        tick_next_ = 0;
+                        tick_pending_ = parallel_tick_funcs_.size();
+                        ++tick_generation_;
+                    }
+
+                    tick_cv_.notify_all();
+                }
+
+                void Run_Tick_Worker(uint64_t seen) {
+                    std::unique_lock<std::mutex> lock(tick_mtx_);
+
+                    for (;;) {
+                        tick_cv_.wait(lock, [this, seen] { return tick_stop_ || tick_generation_ != seen; });
+
+                        if (tick_stop_)
+                            return;
+
+                        seen = tick_generation_;
+
+                        while (tick_next_ < parallel_tick_funcs_.size()) {
+                            Module_ProcessTick_t func = parallel_tick_funcs_[tick_next_++];
+
+                            lock.unlock();
+                            func();
+                            lock.lock();
+
+                            if (--tick_pending_ == 0)
+                                tick_done_cv_.notify_one();
+                        }
+                    }
+                }
+
+                void Stop_Tick_Workers() {
+                    {
+                        std::lock_guard<std::mutex> lock(tick_mtx_);
+                        tick_stop_ = true;
+                    }
+
+                    tick_cv_.notify_all();
+
+                    for (auto& worker : tick_workers_)
+                        worker.join();
+
+                    tick_workers_.clear();
+                    tick_stop_ = false;
+                }
+
+                void Process_Pending_Reloads() {
+                    auto reloads = std::move(pending_reloads_);
+
+                    pending_reloads_.clear();
+
+                    for (const auto& [name, path] : reloads)
+                        Perform_Reload(name, path);
+                }
+
+                bool Perform_Reload(const std::string& name, const std::string& path) {
+                    auto it = std::find_if(loaded_modules_.begin(), loaded_modules_.end(), [&](const auto& module_ptr) {
+                        return module_ptr->Get_Name() == name;
+                    });
+
+                    if (it == loaded_modules_.end())
+                        return (Log("[SAMP-SDK] Error: Cannot reload module '%s' because it is not loaded.", name.c_str()), false);
+
+                    auto start = std::chrono::steady_clock::now();
+                    Module& old_module = **it;
+                    std::vector<AMX*> amx_list = Amx_Manager::Instance().Get_Amx_Instances();
+                    std::vector<unsigned char> state;
+                    bool has_state = old_module.Save_State(state);
+
+                    if (auto func = old_module.Get_AmxUnload_Func()) {
+                        for (AMX* amx : amx_list)
+                            func(amx);
+                    }
+
+                    std::vector<Detached_Native> detached;
+
+                    for (AMX* amx : amx_list) {
+                        AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(amx->base);
+                        AMX_FUNCSTUBNT* natives = reinterpret_cast<AMX_FUNCSTUBNT*>(amx->base + hdr->natives);
+                        size_t native_count = static_cast<size_t>((hdr->libraries - hdr->natives) / hdr->defsize);
+
+                        for (size_t i = 0; i < native_count; ++i) {
+                            if (natives[i].address && old_module.Contains(reinterpret_cast<const void*>(static_cast<uintptr_t>(natives[i].address)))) {
+                                detached.push_back({amx, i, natives[i].address});
+                                natives[i].address = 0;
+                            }
+                        }
+                    }
+
+                    std::vector<Native_Hook*> unlinked = Native_Hook_Manager::Instance().Unlink_Next_In_Chain([&old_module](AMX_NATIVE next) {
+                        return old_module.Contains(reinterpret_cast<const void*>(next));
+                    });
+
+                    std::string old_path = old_module.Get_Path();
+                    std::string full_path = path.empty() ? old_path : Build_Module_Path(name, path);
+                    void** ppData = old_module.Get_Plugin_Data();
+
+                    old_module.Unload();
+
+                    bool resident = Dynamic_Library::Is_Resident(old_path);
+
+                    if (resident) {
+                        Log("[SAMP-SDK] Error: Module '%s' stayed mapped after unloading, so its new version cannot replace it. Build modules with -fno-gnu-unique to make them reloadable.", name.c_str());
+                        full_path = old_path;
+                    }
+
+                    auto module = std::make_unique<Module>(name);
+                    bool loaded = module->Load(full_path, ppData);
+
+                    if (loaded) {
+                        if (auto func = module->Get_AmxLoad_Func()) {
+                            for (AMX* amx : amx_list)
+                                func(amx);
+                        }
+                    }
+
+                    Reattach_Natives(detached);
+                    Refresh_Lazy_Slots(name);
+
+                    for (Native_Hook* hook : unlinked) {
+                        if (!hook->Get_Next_In_Chain())
+                            hook->Set_Next_In_Chain(&Module_Manager::Missing_Native);
+                    }
+
+                    Amx_Manager::Instance().Invalidate();
+                    tables_dirty_ = true;
+
+                    if (!loaded) {
+                        loaded_modules_.erase(it);
+
+                        return (Log("[SAMP-SDK] Error: Module '%s' was unloaded but its new version failed to load.", name.c_str()), false);
+                    }
+
+                    if (has_state && !module->Restore_State(state))
+                        Log("[SAMP-SDK] Warning: Module '%s' did not restore the state saved by its previous version.", name.c_str());
+
+                    *it = std::move(module);
+
+                    if (resident)
+                        return false;
+
+                    double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                    Log("[SAMP-SDK] Module '%s' reloaded in %.2f ms.", name.c_str(), elapsed_ms);
+
+                    return true;
+                }
+
+                void Reattach_Natives(const std::vector<Detached_Native>& detached) {
+                    std::unordered_map<AMX*, std::unordered_map<ucell, ucell>> moved;
+
+                    for (const auto& entry : detached) {
+                        AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(entry.amx->base);
+                        AMX_FUNCSTUBNT* native = reinterpret_cast<AMX_FUNCSTUBNT*>(entry.amx->base + hdr->natives) + entry.index;
+
+                        if (!native->address) {
+                            const char* native_name = reinterpret_cast<const char*>(entry.amx->base + native->nameofs);
+                            AMX_NATIVE_INFO missing{native_name, &Module_Manager::Missing_Native};
+
+                            Log("[SAMP-SDK] Warning: Native '%s' is no longer provided after the module reload.", native_name);
+                            native->address = static_cast<ucell>(reinterpret_cast<uintptr_t>(&Module_Manager::Missing_Native));
+                            Interceptor_Manager::Instance().Update_Native_Cache(&missing, 1);
+                        }
+
+                        moved[entry.amx][entry.address] = native->address;
+                    }
+
+                    AMX_CALLBACK default_callback = reinterpret_cast<AMX_CALLBACK>(Core::Instance().Get_AMX_Export(PLUGIN_AMX_EXPORT_Callback));
+
+                    for (const auto& [amx, addresses] : moved) {
+                        Amx_Sysreq_Rewriter::Instance().Repoint(amx, Get_Amx_Opcode_List(amx), addresses);
+
+                        if (Detail::Jit_Program* program = Amx_Jit::Instance().Find(amx))
+                            Amx_Jit::Instance().Compile(amx, Get_Amx_Opcode_List(amx), amx->callback == default_callback, program->Is_Metered());
+                    }
+                }
+
+                void Refresh_Lazy_Slots(const std::string& name) {
+                    std::lock_guard<std::mutex> lock(lazy_mtx_);
+
+                    for (const auto& lazy : lazy_modules_) {
+                        if (lazy->name != name)
+                            continue;
+
+                        for (size_t slot : lazy->slots) {
+                            AMX_NATIVE real = Interceptor_Manager::Instance().Find_Cached_Native(lazy_slots_[slot].hash);
+
+                            lazy_slots_[slot].real.store(real == Lazy_Stubs()[slot] ? nullptr : real, std::memory_order_release);
+                        }
+                    }
+                }
+
+                Module* Find_Module(const std::string& name) const {
+                    auto it = std::find_if(loaded_modules_.begin(), loaded_modules_.end(), [&](const auto& module_ptr) {
+                        return module_ptr->Get_Name() == name;
+                    });
+
+                    return it != loaded_modules_.end() ? it->get() : nullptr;
+                }
+
+                static std::string Build_Module_Path(const std::string& name, const std::string& path) {
+                    std::string full_path = path;
+
+                    if (!path.empty() && path.back() != '/' && path.back() != '\\')
+                        full_path += '/';
+
+                    full_path += name;
+
+#if defined(SAMP_SDK_WINDOWS)
+                    full_path += ".dll";
+#elif defined(SAMP_SDK_LINUX)
+                    full_path += ".so";
+#endif
+                    return full_path;
+                }
+
+                void Add_Module(std::unique_ptr<Module> module, const std::string& success_msg) {
+                    if (!success_msg.empty())
+                        Log("%s", success_msg.c_str());
+
+                    loaded_modules_.push_back(std::move(module));
+                    tables_dirty_ = true;
+                }
+
+                void Rebuild_Callback_Tables() {
+                    tables_dirty_ = false;
+
+                    amx_load_funcs_.clear();
+                    amx_unload_funcs_.clear();
+                    process_tick_funcs_.clear();
+                    parallel_tick_funcs_.clear();
+                    parallel_host_tick_funcs_.clear();
+
+                    for (const auto& module : loaded_modules_) {
+                        if (auto func = module->Get_AmxLoad_Func())
+                            amx_load_funcs_.push_back(func);
+
+                        Module_ProcessTick_t parallel_func = module->Get_Parallel_Tick_Func();
+
+                        if (auto func = module->Get_ProcessTick_Func())
+                            (parallel_func ? parallel_host_tick_funcs_ : process_tick_funcs_).push_back(func);
+
+                        if (parallel_func)
+                            parallel_tick_funcs_.push_back(parallel_func);
+                    }
+
+                    for (auto it = loaded_modules_.rbegin(); it != loaded_modules_.rend(); ++it) {
+                        if (auto func = (*it)->Get_AmxUnload_Func())
+                            amx_unload_funcs_.push_back(func);
+                    }
+                }
+
                 std::vector<std::unique_ptr<Module>> loaded_modules_;
+                std::vector<Module_Declaration> declared_modules_;
+                std::vector<std::pair<std::string, std::string>> pending_reloads_;
+                std::vector<std::unique_ptr<Lazy_Module>> lazy_modules_;
+                std::array<Lazy_Slot, MAX_LAZY_NATIVES> lazy_slots_;
+                size_t lazy_slot_count_ = 0;
+                std::mutex lazy_mtx_;
+                bool tables_dirty_ = false;
+                std::vector<Module_AmxLoad_t> amx_load_funcs_;
+                std::vector<Module_AmxUnload_t> amx_unload_funcs_;
+                std::vector<Module_ProcessTick_t> process_tick_funcs_;
+                std::vector<Module_ProcessTick_t> parallel_tick_funcs_;
+                std::vector<Module_ProcessTick_t> parallel_host_tick_funcs_;
+                std::vector<std::thread> tick_workers_;
+                std::mutex tick_mtx_;
+                std::condition_variable tick_cv_;
+                std::condition_variable tick_done_cv_;
+                uint64_t tick_generation_ = 0;
+                size_t tick_next_ = 0;
+                size_t tick_pending_ = 0;
+                bool tick_stop_ = false;
         };
     }
 }
\ No newline at end of file
@@ -37,15 +37,27 @@
 #include "amx/amx_memory.hpp"
 #include "amx/amx_helpers.hpp"
 #include "amx/amx_manager.hpp"
+#include "amx/amx_opcodes.hpp"
+#include "amx/amx_jit.hpp"
+#include "amx/amx_sysreq.hpp"
 
 #include "core/platform.hpp"
 #include "core/plugin_defs.h"
 #include "core/exports.hpp"
 #include "core/core.hpp"
 
+#include "diagnostics/tracer.hpp"
+#include "diagnostics/watchdog.hpp"
+#include "diagnostics/call_scope.hpp"
+#include "diagnostics/exec_budget.hpp"
+#include "diagnostics/memory_telemetry.hpp"
+#include "diagnostics/traffic_recorder.hpp"
+#include "diagnostics/amx_profiler.hpp"
+
 #include "events/public_dispatcher.hpp"
 #include "events/native.hpp"
 #include "events/callbacks.hpp"
+#include "events/public_packet.hpp"
 
 #include "hooks/assembly.hpp"
 #include "hooks/function_hook.hpp"
@@ -53,9 +65,18 @@
 #include "hooks/interceptor_manager.hpp"
 
 #include "modules/dynamic_library.hpp"
+#include "modules/module_link.hpp"
 #include "modules/module_manager.hpp"
 
+#include "scheduling/timer_service.hpp"
+#include "scheduling/main_thread.hpp"
+#include "scheduling/thread_pool.hpp"
+#include "scheduling/coroutine.hpp"
+#include "scheduling/async_public.hpp"
+
 #include "utils/hash.hpp"
+#include "utils/async_logger.hpp"
+#include "utils/format.hpp"
 #include "utils/logger.hpp"
 #include "utils/samp_defs.hpp"
 
@@ -72,12 +93,18 @@ void OnAmxUnload(AMX* amx);
 void OnProcessTick();
 #endif
 
+#if defined(SAMP_SDK_WANT_HOT_RELOAD)
+void OnSaveState(std::vector<unsigned char>& state);
+void OnRestoreState(const std::vector<unsigned char>& state);
+#endif
+
 #if defined(SAMP_SDK_IMPLEMENTATION)
 
 #if defined(SAMP_SDK_WINDOWS)
     Export_Plugin("Supports", "0");
     Export_Plugin("Load", "4");
     Export_Plugin("Unload", "0");
+    Export_Plugin("Module_Bind", "4");
 
     #if defined(SAMP_SDK_WANT_AMX_EVENTS)
         Export_Plugin("AmxLoad", "4");
@@ -86,6 +113,15 @@ void OnProcessTick();
 
     #if defined(SAMP_SDK_WANT_PROCESS_TICK)
         Export_Plugin("ProcessTick", "0");
+
+        #if defined(SAMP_SDK_WANT_PARALLEL_TICK)
+            Export_Plugin("ProcessTick_Parallel", "0");
+        #endif
+    #endif
+
+    #if defined(SAMP_SDK_WANT_HOT_RELOAD)
+        Export_Plugin("Save_State", "4");
+        Export_Plugin("Restore_State", "8");
     #endif
 #endif
 
@@ -124,9 +160,16 @@ SAMP_SDK_EXPORT unsigned int SAMP_SDK_CALL Supports() {
     return flags;
 }
 
+SAMP_SDK_EXPORT int SAMP_SDK_CALL Module_Bind(const void* host) {
+    return Samp_SDK::Detail::Module_Link::Instance().Bind(static_cast<const Samp_SDK::Detail::Module_Host_Api*>(host));
+}
+
 SAMP_SDK_EXPORT bool SAMP_SDK_CALL Load(void** ppData) {
     Samp_SDK::Core::Instance().Load(ppData);
-    Samp_SDK::Detail::Interceptor_Manager::Instance().Activate();
+    Samp_SDK::Watchdog::Is_Server_Thread() = true;
+
+    if (!Samp_SDK::Detail::Module_Link::Instance().Attach())
+        Samp_SDK::Detail::Interceptor_Manager::Instance().Activate();
 
     return OnLoad();
 }
@@ -135,8 +178,41 @@ SAMP_SDK_EXPORT void SAMP_SDK_CALL Unload() {
     OnUnload();
 
     Samp_SDK::Detail::Module_Manager::Instance().Unload_All_Modules();
+#if defined(SAMP_SDK_WANT_COROUTINES)
+    Samp_SDK::Detail::Coroutine_Scheduler::Instance().Cancel_All();
+#endif
     Samp_SDK::Detail::Interceptor_Manager::Instance().Deactivate();
+    Samp_SDK::Watchdog::Instance().Stop();
+    Samp_SDK::Thread_Pool::Instance().Stop();
+    Samp_SDK::Detail::Main_Thread_Queue::Instance().Process();
+    Samp_SDK::Detail::Main_Thread_Queue::Instance().Clear();
+    Samp_SDK::Detail::Async_Public_Queue::Instance().Clear();
+    Samp_SDK::Traffic_Recorder::Instance().Stop();
+    Samp_SDK::Amx_Profiler::Instance().Detach_All();
+    Samp_SDK::Exec_Budget::Instance().Release_All();
+    Samp_SDK::Log_Limiter::Instance().Flush();
+    Samp_SDK::Async_Logger::Instance().Stop();
+}
+
+#if defined(SAMP_SDK_WANT_HOT_RELOAD)
+SAMP_SDK_EXPORT int SAMP_SDK_CALL Save_State(const void* writer) {
+    const auto* state_writer = static_cast<const Samp_SDK::Detail::Module_State_Writer*>(writer);
+    std::vector<unsigned char> state;
+
+    OnSaveState(state);
+    state_writer->write(state_writer->context, state.data(), static_cast<uint32_t>(state.size()));
+
+    return 1;
+}
+
+SAMP_SDK_EXPORT int SAMP_SDK_CALL Restore_State(const void* data, uint32_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+
+    OnRestoreState(std::vector<unsigned char>(bytes, bytes + size));
+
+    return 1;
 }
+#endif
 
 #if defined(SAMP_SDK_WANT_AMX_EVENTS)
 SAMP_SDK_EXPORT void SAMP_SDK_CALL AmxLoad(AMX* amx) {
@@ -148,6 +224,11 @@ SAMP_SDK_EXPORT void SAMP_SDK_CALL AmxLoad(AMX* amx) {
 }
 
 SAMP_SDK_EXPORT void SAMP_SDK_CALL AmxUnload(AMX* amx) {
+    Samp_SDK::Timer_Service::Instance().Kill_Amx_Timers(amx);
+#if defined(SAMP_SDK_WANT_COROUTINES)
+    Samp_SDK::Detail::Coroutine_Scheduler::Instance().Cancel_Amx(amx);
+#endif
+    Samp_SDK::Amx_Profiler::Instance().Detach(amx);
     Samp_SDK::Detail::Module_Manager::Instance().Forward_AmxUnload(amx);
 
     OnAmxUnload(amx);
@@ -156,10 +237,30 @@ SAMP_SDK_EXPORT void SAMP_SDK_CALL AmxUnload(AMX* amx) {
 
 #if defined(SAMP_SDK_WANT_PROCESS_TICK)
 SAMP_SDK_EXPORT void SAMP_SDK_CALL ProcessTick() {
-    OnProcessTick();
+    Samp_SDK::Traffic_Recorder::Instance().Record_Tick();
+    Samp_SDK::Watchdog::Instance().Tick();
+    Samp_SDK::Memory_Telemetry::Instance().Tick();
+    Samp_SDK::Timer_Service::Instance().Process();
+    Samp_SDK::Detail::Main_Thread_Queue::Instance().Process();
+    Samp_SDK::Detail::Async_Public_Queue::Instance().Process();
+
+#if defined(SAMP_SDK_WANT_COROUTINES)
+    Samp_SDK::Detail::Coroutine_Scheduler::Instance().Process();
+#endif
+
+#if defined(SAMP_SDK_WANT_PARALLEL_TICK)
+    if (!Samp_SDK::Detail::Module_Link::Instance().Is_Linked())
+#endif
+        OnProcessTick();
 
     Samp_SDK::Detail::Module_Manager::Instance().Forward_ProcessTick();
 }
+
+#if defined(SAMP_SDK_WANT_PARALLEL_TICK)
+SAMP_SDK_EXPORT void SAMP_SDK_CALL ProcessTick_Parallel() {
+    OnProcessTick();
+}
+#endif
 #endif
 
 #endif
@@ -167,6 +268,18 @@ SAMP_SDK_EXPORT void SAMP_SDK_CALL ProcessTick() {
 #define Plugin_Module(name, path, ...) \
     Samp_SDK::Detail::Module_Manager::Instance().Load_Module(name, path, ##__VA_ARGS__, Samp_SDK::Core::Instance().Get_Plugin_Data())
 
+#define Plugin_Module_Declare(name, path, ...) \
+    Samp_SDK::Detail::Module_Manager::Instance().Declare_Module(name, path, { __VA_ARGS__ })
+
+#define Plugin_Module_Lazy(name, path, ...) \
+    Samp_SDK::Detail::Module_Manager::Instance().Declare_Lazy_Module(name, path, { __VA_ARGS__ }, Samp_SDK::Core::Instance().Get_Plugin_Data())
+
+#define Plugin_Modules_Load() \
+    Samp_SDK::Detail::Module_Manager::Instance().Load_Declared_Modules(Samp_SDK::Core::Instance().Get_Plugin_Data())
+
+#define Plugin_Module_Reload(name, ...) \
+    Samp_SDK::Detail::Module_Manager::Instance().Reload_Module(name, ##__VA_ARGS__)
+
 #define Plugin_Public(name, ...) \
     static cell SAMP_SDK_CALL name(__VA_ARGS__); \
     namespace { \
@@ -200,8 +313,23 @@ SAMP_SDK_EXPORT void SAMP_SDK_CALL ProcessTick() {
 #define Pawn_Public(name, ...) \
     Samp_SDK::Detail::Caller<Samp_SDK::Pawn_Call_Type::Public>::Call(Samp_SDK::Detail::FNV1a_Hash_Const(#name), #name, ##__VA_ARGS__)
 
+#define Pawn_Public_Async(name, ...) \
+    Samp_SDK::Detail::Call_Public_Async(Samp_SDK::Detail::FNV1a_Hash_Const(#name), #name, ##__VA_ARGS__)
+
+#define Pawn_Public_Future(name, ...) \
+    Samp_SDK::Detail::Call_Public_Future(Samp_SDK::Detail::FNV1a_Hash_Const(#name), #name, ##__VA_ARGS__)
+
 #define Plugin_Format(...) \
     Samp_SDK::Format(__VA_ARGS__)
 
+#define Plugin_Fmt(format, ...) \
+    Samp_SDK::Format_To_String(SAMP_SDK_FORMAT_STRING(format), ##__VA_ARGS__)
+
+#define Plugin_Fmt_To(buffer, format, ...) \
+    Samp_SDK::Format_To(buffer, SAMP_SDK_FORMAT_STRING(format), ##__VA_ARGS__)
+
+#define Plugin_Fmt_To_Amx(amx, amx_addr, size, format, ...) \
+    Samp_SDK::Format_To_Amx(amx, amx_addr, size, SAMP_SDK_FORMAT_STRING(format), ##__VA_ARGS__)
+
 #define Register_Parameters(...) \
     Samp_SDK::Detail::Register_Parameters_Impl(amx, params, __VA_ARGS__)
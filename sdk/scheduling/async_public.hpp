@@ -0,0 +1,192 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+//
+#include "../amx/amx_defs.h"
+#include "../core/platform.hpp"
+#include "../events/callbacks.hpp"
+#include "../events/public_packet.hpp"
+#include "../utils/mpsc_queue.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        struct Async_Public_Node {
+            std::atomic<Async_Public_Node*> next{nullptr};
+            uint32_t hash = 0;
+            const char* name = nullptr;
+            Public_Packet packet;
+            std::unique_ptr<std::promise<Callback_Result>> promise;
+        };
+
+        class Async_Public_Queue {
+            public:
+                static constexpr size_t MAX_POOLED_NODES = 4096;
+
+                static Async_Public_Queue& Instance() {
+                    static Async_Public_Queue instance;
+
+                    return instance;
+                }
+
+                Async_Public_Node* Acquire() {
+                    {
+                        std::lock_guard<std::mutex> lock(pool_mtx_);
+
+                        if (!pool_.empty()) {
+                            Async_Public_Node* node = pool_.back();
+                            pool_.pop_back();
+
+                            return node;
+                        }
+                    }
+
+                    return new Async_Public_Node();
+                }
+
+                void Submit(Async_Public_Node* node) {
+                    pending_.fetch_add(1, std::memory_order_relaxed);
+                    queue_.Push(node);
+                }
+
+                void Process() {
+                    size_t remaining = pending_.load(std::memory_order_relaxed);
+
+                    if (SAMP_SDK_LIKELY(remaining == 0))
+                        return;
+
+                    for (; remaining > 0; --remaining) {
+                        Async_Public_Node* node = queue_.Pop();
+
+                        if (!node)
+                            break;
+
+                        pending_.fetch_sub(1, std::memory_order_relaxed);
+
+                        int pub_index = -1;
+                        AMX* amx = Shared_Caller_Logic::Resolve_Public(node->hash, node->name, pub_index);
+                        Callback_Result result = amx ? node->packet.Execute(amx, pub_index) : Callback_Result();
+
+                        if (node->promise) {
+                            node->promise->set_value(result);
+                            node->promise.reset();
+                        }
+
+                        node->packet.Clear();
+                        released_.push_back(node);
+                    }
+
+                    Recycle_Released();
+                }
+
+                void Clear() {
+                    while (Async_Public_Node* node = queue_.Pop()) {
+                        pending_.fetch_sub(1, std::memory_order_relaxed);
+                        delete node;
+                    }
+
+                    std::lock_guard<std::mutex> lock(pool_mtx_);
+
+                    for (Async_Public_Node* node : pool_)
+                        delete node;
+
+                    pool_.clear();
+                }
+
+                [[nodiscard]] size_t Get_Pending_Count() const {
+                    return pending_.load(std::memory_order_relaxed);
+                }
+
+            private:
+                Async_Public_Queue() = default;
+                ~Async_Public_Queue() {
+                    Clear();
+                }
+                Async_Public_Queue(const Async_Public_Queue&) = delete;
+                Async_Public_Queue& operator=(const Async_Public_Queue&) = delete;
+
+                void Recycle_Released() {
+                    std::lock_guard<std::mutex> lock(pool_mtx_);
+
+                    for (Async_Public_Node* node : released_) {
+                        if (pool_.size() < MAX_POOLED_NODES)
+                            pool_.push_back(node);
+                        else
+                            delete node;
+                    }
+
+                    released_.clear();
+                }
+
+                Mpsc_Queue<Async_Public_Node> queue_;
+                std::atomic<size_t> pending_{0};
+                std::vector<Async_Public_Node*> released_;
+                std::vector<Async_Public_Node*> pool_;
+                std::mutex pool_mtx_;
+        };
+
+        template<typename... Args>
+        inline Async_Public_Node* Prepare_Public_Async(uint32_t func_hash, const char* func_name, Args&&... args) {
+            Async_Public_Node* node = Async_Public_Queue::Instance().Acquire();
+
+            node->hash = func_hash;
+            node->name = func_name;
+            node->packet.Push_All(std::forward<Args>(args)...);
+
+            return node;
+        }
+
+        template<typename... Args>
+        inline void Call_Public_Async(uint32_t func_hash, const char* func_name, Args&&... args) {
+            Async_Public_Queue::Instance().Submit(Prepare_Public_Async(func_hash, func_name, std::forward<Args>(args)...));
+        }
+
+        template<typename... Args>
+        inline std::future<Callback_Result> Call_Public_Future(uint32_t func_hash, const char* func_name, Args&&... args) {
+            Async_Public_Node* node = Prepare_Public_Async(func_hash, func_name, std::forward<Args>(args)...);
+            node->promise = std::make_unique<std::promise<Callback_Result>>();
+            std::future<Callback_Result> future = node->promise->get_future();
+
+            Async_Public_Queue::Instance().Submit(node);
+
+            return future;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,508 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#if defined(SAMP_SDK_WANT_COROUTINES)
+
+#if !defined(__cpp_impl_coroutine)
+    #error "SAMP_SDK_WANT_COROUTINES requires C++20 coroutine support. Please update your compiler settings."
+#endif
+
+#if !defined(SAMP_SDK_WANT_PROCESS_TICK)
+    #error "SAMP_SDK_WANT_COROUTINES requires SAMP_SDK_WANT_PROCESS_TICK, coroutines are only resumed from ProcessTick."
+#endif
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+//
+#include "../amx/amx_defs.h"
+#include "../events/public_dispatcher.hpp"
+#include "../utils/hash.hpp"
+#include "../utils/logger.hpp"
+#include "main_thread.hpp"
+#include "thread_pool.hpp"
+#include "timer_service.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        class Coroutine_Frame_Pool {
+            public:
+                static constexpr size_t GRANULARITY = 64;
+                static constexpr size_t CLASS_COUNT = 64;
+                static constexpr size_t MAX_POOLED_SIZE = GRANULARITY * CLASS_COUNT;
+
+                static void* Allocate(size_t size) {
+                    size_t size_class = Get_Size_Class(size);
+
+                    if (size_class >= CLASS_COUNT)
+                        return ::operator new(size);
+
+                    Free_Block*& head = Get_Free_Lists()[size_class];
+
+                    if (head) {
+                        Free_Block* block = head;
+                        head = block->next;
+
+                        return block;
+                    }
+
+                    return ::operator new((size_class + 1) * GRANULARITY);
+                }
+
+                static void Release(void* ptr, size_t size) noexcept {
+                    size_t size_class = Get_Size_Class(size);
+
+                    if (size_class >= CLASS_COUNT) {
+                        ::operator delete(ptr);
+
+                        return;
+                    }
+
+                    Free_Block*& head = Get_Free_Lists()[size_class];
+                    Free_Block* block = static_cast<Free_Block*>(ptr);
+                    block->next = head;
+                    head = block;
+                }
+
+            private:
+                struct Free_Block {
+                    Free_Block* next;
+                };
+
+                struct Free_Lists {
+                    Free_Block* heads[CLASS_COUNT] = {};
+
+                    Free_Block*& operator[](size_t index) {
+                        return heads[index];
+                    }
+
+                    ~Free_Lists() {
+                        for (Free_Block* head : heads) {
+                            while (head) {
+                                Free_Block* next = head->next;
+                                ::operator delete(head);
+                                head = next;
+                            }
+                        }
+                    }
+                };
+
+                static size_t Get_Size_Class(size_t size) {
+                    return size ? (size - 1) / GRANULARITY : 0;
+                }
+
+                static Free_Lists& Get_Free_Lists() {
+                    static thread_local Free_Lists lists;
+
+                    return lists;
+                }
+        };
+
+        class Coroutine_Scheduler {
+            public:
+                using Public_Waiter = std::function<bool(AMX*)>;
+
+                static Coroutine_Scheduler& Instance() {
+                    static Coroutine_Scheduler instance;
+
+                    return instance;
+                }
+
+                void Schedule_Next_Tick(std::coroutine_handle<> handle, AMX* owner) {
+                    next_tick_.push_back({handle, owner});
+                }
+
+                void Track_Delay(std::coroutine_handle<> handle, AMX* owner, Timer_Id timer_id) {
+                    delays_[handle.address()] = {owner, timer_id};
+                }
+
+                void Resume_Delay(std::coroutine_handle<> handle) {
+                    if (delays_.erase(handle.address()))
+                        handle.resume();
+                }
+
+                void Wait_For_Public(uint32_t hash, std::coroutine_handle<> handle, AMX* owner, Public_Waiter waiter) {
+                    if (registered_publics_.insert(hash).second) {
+                        Public_Dispatcher::Instance().Register(hash, [this, hash](AMX* amx) -> cell {
+                            Dispatch_Public(hash, amx);
+
+                            return PUBLIC_CONTINUE;
+                        }, this);
+                    }
+
+                    public_waiters_[hash].push_back({std::move(waiter), handle, owner});
+                }
+
+                void Begin_Worker(std::coroutine_handle<> handle, AMX* owner) {
+                    on_worker_[handle.address()] = owner;
+                }
+
+                void Resume_Worker(std::coroutine_handle<> handle) {
+                    if (on_worker_.erase(handle.address()))
+                        handle.resume();
+                    else if (cancelled_workers_.erase(handle.address()))
+                        handle.destroy();
+                }
+
+                void Process() {
+                    if (!idle_publics_.empty())
+                        Release_Idle_Publics();
+
+                    if (next_tick_.empty())
+                        return;
+
+                    resuming_.swap(next_tick_);
+
+                    for (auto& entry : resuming_) {
+                        if (entry.handle)
+                            entry.handle.resume();
+                    }
+
+                    resuming_.clear();
+                }
+
+                void Cancel_Amx(AMX* amx) {
+                    Cancel([amx](AMX* owner) { return owner == amx; });
+                }
+
+                void Cancel_All() {
+                    Cancel([](AMX*) { return true; });
+                    Release_Idle_Publics();
+                }
+
+            private:
+                struct Suspended {
+                    std::coroutine_handle<> handle;
+                    AMX* owner;
+                };
+
+                struct Pending_Delay {
+                    AMX* owner;
+                    Timer_Id timer_id;
+                };
+
+                struct Public_Wait {
+                    Public_Waiter waiter;
+                    std::coroutine_handle<> handle;
+                    AMX* owner;
+                };
+
+                Coroutine_Scheduler() = default;
+                Coroutine_Scheduler(const Coroutine_Scheduler&) = delete;
+                Coroutine_Scheduler& operator=(const Coroutine_Scheduler&) = delete;
+
+                template<typename Match>
+                void Cancel(Match match) {
+                    std::vector<std::coroutine_handle<>> doomed;
+
+                    for (auto& list : {&next_tick_, &resuming_}) {
+                        for (auto& entry : *list) {
+                            if (entry.handle && match(entry.owner)) {
+                                doomed.push_back(entry.handle);
+                                entry.handle = nullptr;
+                            }
+                        }
+                    }
+
+                    for (auto it = delays_.begin(); it != delays_.end();) {
+                        if (!match(it->second.owner)) {
+                            ++it;
+
+                            continue;
+                        }
+
+                        Timer_Service::Instance().Kill_Timer(it->second.timer_id);
+                        doomed.push_back(std::coroutine_handle<>::from_address(it->first));
+                        it = delays_.erase(it);
+                    }
+
+                    for (auto& [hash, waits] : public_waiters_) {
+                        for (auto it = waits.begin(); it != waits.end();) {
+                            if (!match(it->owner)) {
+                                ++it;
+
+                                continue;
+                            }
+
+                            doomed.push_back(it->handle);
+                            it = waits.erase(it);
+                        }
+
+                        if (waits.empty())
+                            idle_publics_.insert(hash);
+                    }
+
+                    for (auto it = on_worker_.begin(); it != on_worker_.end();) {
+                        if (!match(it->second)) {
+                            ++it;
+
+                            continue;
+                        }
+
+                        cancelled_workers_.insert(it->first);
+                        it = on_worker_.erase(it);
+                    }
+
+                    for (auto handle : doomed)
+                        handle.destroy();
+                }
+
+                void Dispatch_Public(uint32_t hash, AMX* amx) {
+                    auto it = public_waiters_.find(hash);
+
+                    if (it == public_waiters_.end() || it->second.empty())
+                        return;
+
+                    std::vector<Public_Wait> waits;
+                    waits.swap(it->second);
+
+                    for (auto& wait : waits) {
+                        if (!wait.waiter(amx))
+                            public_waiters_[hash].push_back(std::move(wait));
+                    }
+
+                    if (public_waiters_[hash].empty())
+                        idle_publics_.insert(hash);
+                }
+
+                void Release_Idle_Publics() {
+                    for (uint32_t hash : idle_publics_) {
+                        auto it = public_waiters_.find(hash);
+
+                        if (it != public_waiters_.end() && !it->second.empty())
+                            continue;
+
+                        public_waiters_.erase(hash);
+                        registered_publics_.erase(hash);
+                        Public_Dispatcher::Instance().Unregister(hash, this);
+                    }
+
+                    idle_publics_.clear();
+                }
+
+                std::vector<Suspended> next_tick_;
+                std::vector<Suspended> resuming_;
+                std::unordered_map<void*, Pending_Delay> delays_;
+                std::unordered_map<uint32_t, std::vector<Public_Wait>> public_waiters_;
+                std::unordered_set<uint32_t> registered_publics_;
+                std::unordered_set<uint32_t> idle_publics_;
+                std::unordered_map<void*, AMX*> on_worker_;
+                std::unordered_set<void*> cancelled_workers_;
+        };
+    }
+
+    class Coroutine {
+        public:
+            struct promise_type {
+                promise_type() = default;
+
+                template<typename... Args>
+                promise_type(AMX* amx, Args&...) noexcept : owner(amx) {}
+
+                Coroutine get_return_object() noexcept {
+                    return {};
+                }
+
+                std::suspend_never initial_suspend() noexcept {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() noexcept {
+                    return {};
+                }
+
+                void return_void() noexcept {}
+
+                void unhandled_exception() noexcept {
+                    SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Error: Unhandled exception escaped a coroutine.");
+                }
+
+                static void* operator new(size_t size) {
+                    return Detail::Coroutine_Frame_Pool::Allocate(size);
+                }
+
+                static void operator delete(void* ptr, size_t size) noexcept {
+                    Detail::Coroutine_Frame_Pool::Release(ptr, size);
+                }
+
+                AMX* owner = nullptr;
+            };
+    };
+
+    namespace Detail {
+        template<typename Promise>
+        inline AMX* Get_Coroutine_Owner(std::coroutine_handle<Promise> handle) {
+            if constexpr (std::is_same_v<Promise, Coroutine::promise_type>)
+                return handle.promise().owner;
+            else
+                return (void)handle, nullptr;
+        }
+    }
+
+    class Next_Tick {
+        public:
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            template<typename Promise>
+            void await_suspend(std::coroutine_handle<Promise> handle) const {
+                Detail::Coroutine_Scheduler::Instance().Schedule_Next_Tick(handle, Detail::Get_Coroutine_Owner(handle));
+            }
+
+            void await_resume() const noexcept {}
+    };
+
+    class Delay {
+        public:
+            explicit Delay(std::chrono::milliseconds duration) : duration_(duration) {}
+
+            bool await_ready() const noexcept {
+                return duration_.count() <= 0;
+            }
+
+            template<typename Promise>
+            void await_suspend(std::coroutine_handle<Promise> handle) const {
+                std::coroutine_handle<> resumable = handle;
+                Timer_Id timer_id = Timer_Service::Instance().Set_Timer(static_cast<uint32_t>(duration_.count()), false, [resumable] {
+                    Detail::Coroutine_Scheduler::Instance().Resume_Delay(resumable);
+                });
+
+                Detail::Coroutine_Scheduler::Instance().Track_Delay(handle, Detail::Get_Coroutine_Owner(handle), timer_id);
+            }
+
+            void await_resume() const noexcept {}
+
+        private:
+            std::chrono::milliseconds duration_;
+    };
+
+    template<typename... Args>
+    class Wait_For_Public {
+        public:
+            using Predicate_Func = std::function<bool(const decay_t<Args>&...)>;
+            using Result_Type = std::tuple<decay_t<Args>...>;
+
+            Wait_For_Public(const char* public_name, Predicate_Func predicate = nullptr) : hash_(Detail::FNV1a_Hash(public_name)), predicate_(std::move(predicate)) {}
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            template<typename Promise>
+            void await_suspend(std::coroutine_handle<Promise> handle) {
+                Detail::Coroutine_Scheduler::Instance().Wait_For_Public(hash_, handle, Detail::Get_Coroutine_Owner(handle), [this, handle](AMX* amx) -> bool {
+                    Result_Type params;
+
+                    std::apply([&](auto&... args) {
+                        Detail::Public_Param_Reader::Get_Public_Params(amx, args...);
+                    }, params);
+
+                    if (predicate_ && !std::apply(predicate_, params))
+                        return false;
+
+                    result_ = std::move(params);
+                    handle.resume();
+
+                    return true;
+                });
+            }
+
+            Result_Type await_resume() {
+                return std::move(*result_);
+            }
+
+        private:
+            uint32_t hash_;
+            Predicate_Func predicate_;
+            std::optional<Result_Type> result_;
+    };
+
+    template<typename Work>
+    class Run_On_Worker {
+        public:
+            using Result_Type = std::invoke_result_t<Work>;
+
+            explicit Run_On_Worker(Work work) : work_(std::move(work)) {}
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            template<typename Promise>
+            void await_suspend(std::coroutine_handle<Promise> handle) {
+                std::coroutine_handle<> resumable = handle;
+
+                Detail::Coroutine_Scheduler::Instance().Begin_Worker(handle, Detail::Get_Coroutine_Owner(handle));
+                Thread_Pool::Instance().Submit([this, resumable] {
+                    if constexpr (std::is_void_v<Result_Type>)
+                        work_();
+                    else
+                        result_.emplace(work_());
+
+                    Main_Thread::Post([resumable] {
+                        Detail::Coroutine_Scheduler::Instance().Resume_Worker(resumable);
+                    });
+                });
+            }
+
+            Result_Type await_resume() {
+                if constexpr (!std::is_void_v<Result_Type>)
+                    return std::move(*result_);
+            }
+
+        private:
+            struct Empty_Result {};
+
+            Work work_;
+            std::optional<std::conditional_t<std::is_void_v<Result_Type>, Empty_Result, Result_Type>> result_;
+    };
+
+    template<typename Work>
+    Run_On_Worker(Work) -> Run_On_Worker<Work>;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,158 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+//
+#include "../core/platform.hpp"
+#include "../utils/logger.hpp"
+#include "../utils/mpsc_queue.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        class Main_Thread_Queue {
+            public:
+                using Task_Func = std::function<void()>;
+
+                static Main_Thread_Queue& Instance() {
+                    static Main_Thread_Queue instance;
+
+                    return instance;
+                }
+
+                void Push(Task_Func task) {
+                    Task_Node* node = new Task_Node(std::move(task));
+
+                    pending_.fetch_add(1, std::memory_order_relaxed);
+                    queue_.Push(node);
+                }
+
+                void Process() {
+                    size_t remaining = pending_.load(std::memory_order_relaxed);
+
+                    if (SAMP_SDK_LIKELY(remaining == 0))
+                        return;
+
+                    int64_t budget_us = budget_us_.load(std::memory_order_relaxed);
+                    auto start = std::chrono::steady_clock::now();
+
+                    for (; remaining > 0; --remaining) {
+                        std::unique_ptr<Task_Node> node(queue_.Pop());
+
+                        if (!node)
+                            break;
+
+                        pending_.fetch_sub(1, std::memory_order_relaxed);
+
+                        try {
+                            node->task();
+                        }
+                        catch (...) {
+                            SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Error: Unhandled exception in main thread task.");
+                        }
+
+                        if (budget_us > 0 && std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() >= budget_us)
+                            break;
+                    }
+                }
+
+                void Clear() {
+                    while (Task_Node* node = queue_.Pop()) {
+                        pending_.fetch_sub(1, std::memory_order_relaxed);
+                        delete node;
+                    }
+                }
+
+                void Set_Budget(std::chrono::microseconds budget) {
+                    budget_us_.store(static_cast<int64_t>(budget.count()), std::memory_order_relaxed);
+                }
+
+                [[nodiscard]] std::chrono::microseconds Get_Budget() const {
+                    return std::chrono::microseconds(budget_us_.load(std::memory_order_relaxed));
+                }
+
+                [[nodiscard]] size_t Get_Pending_Count() const {
+                    return pending_.load(std::memory_order_relaxed);
+                }
+
+            private:
+                Main_Thread_Queue() = default;
+                ~Main_Thread_Queue() {
+                    Clear();
+                }
+                Main_Thread_Queue(const Main_Thread_Queue&) = delete;
+                Main_Thread_Queue& operator=(const Main_Thread_Queue&) = delete;
+
+                struct Task_Node {
+                    Task_Node() = default;
+                    explicit Task_Node(Task_Func func) : task(std::move(func)) {}
+
+                    std::atomic<Task_Node*> next{nullptr};
+                    Task_Func task;
+                };
+
+                Mpsc_Queue<Task_Node> queue_;
+                std::atomic<size_t> pending_{0};
+                std::atomic<int64_t> budget_us_{0};
+        };
+    }
+
+    namespace Main_Thread {
+#if defined(SAMP_SDK_WANT_PROCESS_TICK)
+        inline void Post(Detail::Main_Thread_Queue::Task_Func task) {
+            if (task)
+                Detail::Main_Thread_Queue::Instance().Push(std::move(task));
+        }
+#else
+        template<typename Task>
+        inline void Post(Task&&) {
+            static_assert(!std::is_same_v<Task, Task>, "Main_Thread::Post requires SAMP_SDK_WANT_PROCESS_TICK, posted tasks are only run from ProcessTick.");
+        }
+#endif
+
+        inline void Set_Budget(std::chrono::microseconds budget) {
+            Detail::Main_Thread_Queue::Instance().Set_Budget(budget);
+        }
+
+        [[nodiscard]] inline size_t Get_Pending_Count() {
+            return Detail::Main_Thread_Queue::Instance().Get_Pending_Count();
+        }
+    }
+}
\ No newline at end of file
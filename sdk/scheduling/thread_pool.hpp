@@ -0,0 +1,332 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+//
+#include "../core/platform.hpp"
+#include "../utils/logger.hpp"
+#include "main_thread.hpp"
+
+#if defined(SAMP_SDK_WINDOWS)
+    #include <windows.h>
+#elif defined(SAMP_SDK_LINUX)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace Samp_SDK {
+    class Thread_Pool {
+        public:
+            using Task_Func = std::function<void()>;
+
+            static Thread_Pool& Instance() {
+                static Thread_Pool instance;
+
+                return instance;
+            }
+
+            bool Start(size_t thread_count = 0, bool pin_threads = false) {
+                std::lock_guard<std::mutex> lock(lifecycle_mtx_);
+
+                if (running_.load(std::memory_order_acquire))
+                    return true;
+
+                if (thread_count == 0) {
+                    unsigned int hardware_threads = std::thread::hardware_concurrency();
+                    thread_count = hardware_threads > 1 ? hardware_threads - 1 : 1;
+                }
+
+                std::lock_guard<std::shared_mutex> workers_lock(workers_mtx_);
+
+                stop_requested_.store(false, std::memory_order_relaxed);
+                workers_.clear();
+
+                for (size_t i = 0; i < thread_count; ++i)
+                    workers_.push_back(std::make_unique<Worker>());
+
+                running_.store(true, std::memory_order_release);
+
+                for (size_t i = 0; i < thread_count; ++i) {
+                    workers_[i]->thread = std::thread(&Thread_Pool::Run, this, i);
+
+                    if (pin_threads)
+                        Pin_Thread(workers_[i]->thread, i);
+                }
+
+                return true;
+            }
+
+            void Stop() {
+                std::lock_guard<std::mutex> lock(lifecycle_mtx_);
+
+                if (!running_.load(std::memory_order_acquire))
+                    return;
+
+                {
+                    std::lock_guard<std::shared_mutex> workers_lock(workers_mtx_);
+                    std::lock_guard<std::mutex> sleep_lock(sleep_mtx_);
+                    stop_requested_.store(true, std::memory_order_release);
+                }
+
+                sleep_cv_.notify_all();
+
+                for (auto& worker : workers_) {
+                    if (worker->thread.joinable())
+                        worker->thread.join();
+                }
+
+                std::lock_guard<std::shared_mutex> workers_lock(workers_mtx_);
+
+                workers_.clear();
+                queued_.store(0, std::memory_order_relaxed);
+                running_.store(false, std::memory_order_release);
+            }
+
+            bool Submit(Task_Func task) {
+                if (!task)
+                    return false;
+
+                if (SAMP_SDK_UNLIKELY(!running_.load(std::memory_order_acquire)))
+                    Start();
+
+                {
+                    std::shared_lock<std::shared_mutex> workers_lock(workers_mtx_);
+                    size_t worker_count = workers_.size();
+
+                    if (stop_requested_.load(std::memory_order_acquire) || worker_count == 0)
+                        return (SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Warning: Thread pool is stopping, a submitted task was rejected."), false);
+
+                    size_t target = (Current_Worker_Index() < worker_count) ? Current_Worker_Index() : next_worker_.fetch_add(1, std::memory_order_relaxed) % worker_count;
+
+                    {
+                        std::lock_guard<std::mutex> lock(workers_[target]->mtx);
+                        workers_[target]->tasks.push_back(std::move(task));
+                    }
+
+                    queued_.fetch_add(1, std::memory_order_release);
+                }
+
+                {
+                    std::lock_guard<std::mutex> sleep_lock(sleep_mtx_);
+                }
+
+                sleep_cv_.notify_one();
+
+                return true;
+            }
+
+            [[nodiscard]] size_t Get_Thread_Count() const {
+                return workers_.size();
+            }
+
+            [[nodiscard]] bool Is_Running() const {
+                return running_.load(std::memory_order_acquire);
+            }
+
+            [[nodiscard]] static bool Is_Worker_Thread() {
+                return Current_Worker_Index() != static_cast<size_t>(-1);
+            }
+
+        private:
+            Thread_Pool() = default;
+            ~Thread_Pool() {
+                Stop();
+            }
+            Thread_Pool(const Thread_Pool&) = delete;
+            Thread_Pool& operator=(const Thread_Pool&) = delete;
+
+            struct Worker {
+                std::deque<Task_Func> tasks;
+                std::mutex mtx;
+                std::thread thread;
+            };
+
+            static size_t& Current_Worker_Index() {
+                static thread_local size_t index = static_cast<size_t>(-1);
+
+                return index;
+            }
+
+            static void Pin_Thread(std::thread& thread, size_t index) {
+                unsigned int hardware_threads = std::thread::hardware_concurrency();
+
+                if (hardware_threads == 0)
+                    return;
+#if defined(SAMP_SDK_WINDOWS)
+                SetThreadAffinityMask(thread.native_handle(), static_cast<DWORD_PTR>(1) << (index % hardware_threads));
+#elif defined(SAMP_SDK_LINUX)
+                cpu_set_t cpu_set;
+                CPU_ZERO(&cpu_set);
+                CPU_SET(index % hardware_threads, &cpu_set);
+
+                if (pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set) != 0)
+                    Log("[SA-MP SDK] Warning: Could not set CPU affinity for worker thread %u.", static_cast<unsigned int>(index));
+#endif
+            }
+
+            bool Pop_Local(size_t index, Task_Func& task) {
+                Worker& worker = *workers_[index];
+                std::lock_guard<std::mutex> lock(worker.mtx);
+
+                if (worker.tasks.empty())
+                    return false;
+
+                task = std::move(worker.tasks.back());
+                worker.tasks.pop_back();
+
+                return true;
+            }
+
+            bool Steal(size_t index, Task_Func& task) {
+                size_t worker_count = workers_.size();
+
+                for (size_t offset = 1; offset < worker_count; ++offset) {
+                    Worker& victim = *workers_[(index + offset) % worker_count];
+                    std::unique_lock<std::mutex> lock(victim.mtx, std::try_to_lock);
+
+                    if (!lock.owns_lock() || victim.tasks.empty())
+                        continue;
+
+                    task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+
+                    return true;
+                }
+
+                return false;
+            }
+
+            void Run(size_t index) {
+                Current_Worker_Index() = index;
+                Task_Func task;
+
+                while (true) {
+                    if (Pop_Local(index, task) || Steal(index, task)) {
+                        queued_.fetch_sub(1, std::memory_order_relaxed);
+
+                        try {
+                            task();
+                        }
+                        catch (...) {
+                            SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Error: Unhandled exception in worker thread task.");
+                        }
+
+                        task = nullptr;
+
+                        continue;
+                    }
+
+                    if (stop_requested_.load(std::memory_order_acquire) && queued_.load(std::memory_order_acquire) == 0)
+                        break;
+
+                    std::unique_lock<std::mutex> sleep_lock(sleep_mtx_);
+                    sleep_cv_.wait(sleep_lock, [this] {
+                        return stop_requested_.load(std::memory_order_acquire) || queued_.load(std::memory_order_acquire) > 0;
+                    });
+                }
+
+                Current_Worker_Index() = static_cast<size_t>(-1);
+            }
+
+            std::vector<std::unique_ptr<Worker>> workers_;
+            std::atomic<bool> running_{false};
+            std::atomic<bool> stop_requested_{false};
+            std::atomic<size_t> queued_{0};
+            std::atomic<size_t> next_worker_{0};
+            std::shared_mutex workers_mtx_;
+            std::mutex lifecycle_mtx_;
+            std::mutex sleep_mtx_;
+            std::condition_variable sleep_cv_;
+    };
+
+    template<typename Work>
+    class Async_Task {
+        public:
+            using Result_Type = std::invoke_result_t<Work>;
+
+            explicit Async_Task(Work work) : work_(std::move(work)), submitted_(false) {}
+
+            Async_Task(Async_Task&& other) noexcept : work_(std::move(other.work_)), submitted_(other.submitted_) {
+                other.submitted_ = true;
+            }
+
+            Async_Task(const Async_Task&) = delete;
+            Async_Task& operator=(const Async_Task&) = delete;
+            Async_Task& operator=(Async_Task&&) = delete;
+
+            ~Async_Task() {
+                if (!submitted_)
+                    Thread_Pool::Instance().Submit(std::move(work_));
+            }
+
+            template<typename Callback>
+            void Then_On_Main(Callback callback) {
+                submitted_ = true;
+
+                Thread_Pool::Instance().Submit([work = std::move(work_), callback = std::move(callback)]() mutable {
+                    if constexpr (std::is_void_v<Result_Type>) {
+                        work();
+                        Main_Thread::Post(std::move(callback));
+                    }
+                    else {
+                        auto result = std::make_shared<Result_Type>(work());
+
+                        Main_Thread::Post([callback = std::move(callback), result]() mutable {
+                            callback(std::move(*result));
+                        });
+                    }
+                });
+            }
+
+        private:
+            Work work_;
+            bool submitted_;
+    };
+
+    template<typename Work>
+    inline Async_Task<std::decay_t<Work>> Async(Work&& work) {
+        return Async_Task<std::decay_t<Work>>(std::forward<Work>(work));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,503 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+//
+#include "../amx/amx_api.hpp"
+#include "../amx/amx_defs.h"
+#include "../amx/amx_helpers.hpp"
+#include "../events/native.hpp"
+#include "../events/public_packet.hpp"
+#include "../utils/logger.hpp"
+
+namespace Samp_SDK {
+    using Timer_Id = int32_t;
+
+    constexpr Timer_Id INVALID_TIMER_ID = 0;
+
+    class Timer_Service {
+        public:
+            using Callback_Func = std::function<void()>;
+
+            static Timer_Service& Instance() {
+                static Timer_Service instance;
+
+                return instance;
+            }
+
+            Timer_Id Set_Timer(uint32_t interval_ms, bool repeat, Callback_Func callback) {
+                if (!callback)
+                    return INVALID_TIMER_ID;
+
+                int32_t index = Allocate_Node();
+
+                if (index < 0)
+                    return INVALID_TIMER_ID;
+
+                Timer_Node& node = Get_Node(index);
+                node.callback = std::move(callback);
+
+                return Schedule_New(index, interval_ms, repeat);
+            }
+
+            Timer_Id Set_Pawn_Timer(AMX* amx, const std::string& public_name, uint32_t interval_ms, bool repeat, Detail::Public_Packet packet = {}) {
+                if (!amx || public_name.empty())
+                    return INVALID_TIMER_ID;
+
+                int32_t index = Allocate_Node();
+
+                if (index < 0)
+                    return INVALID_TIMER_ID;
+
+                Timer_Node& node = Get_Node(index);
+                node.amx = amx;
+                node.public_name = public_name;
+                node.packet = std::move(packet);
+
+                return Schedule_New(index, interval_ms, repeat);
+            }
+
+            bool Kill_Timer(Timer_Id id) {
+                int32_t index = Resolve(id);
+
+                if (index < 0)
+                    return false;
+
+                Timer_Node& node = Get_Node(index);
+
+                if (node.state == Node_State::Firing)
+                    node.state = Node_State::Killed;
+                else {
+                    Unlink(index);
+                    Release_Node(index);
+                }
+
+                return true;
+            }
+
+            [[nodiscard]] bool Is_Valid(Timer_Id id) const {
+                return Resolve(id) >= 0;
+            }
+
+            [[nodiscard]] size_t Get_Active_Count() const {
+                return active_count_;
+            }
+
+            void Kill_Amx_Timers(AMX* amx) {
+                for (int32_t index = 0; index < static_cast<int32_t>(node_count_); ++index) {
+                    Timer_Node& node = Get_Node(index);
+
+                    if (node.amx == amx && (node.state == Node_State::Scheduled || node.state == Node_State::Firing))
+                        Kill_Timer(Make_Id(index, node.generation));
+                }
+            }
+
+            void Process() {
+                uint64_t target_ms = Now_Ms();
+
+                if (active_count_ == 0) {
+                    next_ms_ = target_ms + 1;
+
+                    return;
+                }
+
+                target_ms_ = target_ms;
+
+                while (next_ms_ <= target_ms) {
+                    size_t slot = static_cast<size_t>(next_ms_ & WHEEL_0_MASK);
+
+                    if (slot == 0 && !Cascade(1) && !Cascade(2))
+                        Cascade(3);
+
+                    processing_ = true;
+
+                    while (wheels_[slot] >= 0) {
+                        int32_t index = wheels_[slot];
+
+                        Unlink(index);
+                        Fire(index);
+                    }
+
+                    processing_ = false;
+                    ++next_ms_;
+                }
+            }
+
+        private:
+            Timer_Service() : epoch_(std::chrono::steady_clock::now()) {
+                wheels_.fill(-1);
+                next_ms_ = 1;
+            }
+            ~Timer_Service() = default;
+            Timer_Service(const Timer_Service&) = delete;
+            Timer_Service& operator=(const Timer_Service&) = delete;
+
+            static constexpr uint32_t WHEEL_0_BITS = 8;
+            static constexpr uint32_t WHEEL_N_BITS = 6;
+            static constexpr uint32_t WHEEL_LEVELS = 4;
+            static constexpr uint64_t WHEEL_0_SIZE = uint64_t(1) << WHEEL_0_BITS;
+            static constexpr uint64_t WHEEL_N_SIZE = uint64_t(1) << WHEEL_N_BITS;
+            static constexpr uint64_t WHEEL_0_MASK = WHEEL_0_SIZE - 1;
+            static constexpr uint64_t WHEEL_N_MASK = WHEEL_N_SIZE - 1;
+            static constexpr uint64_t MAX_WHEEL_DELTA = uint64_t(1) << (WHEEL_0_BITS + (WHEEL_LEVELS - 1) * WHEEL_N_BITS);
+            static constexpr size_t TOTAL_SLOTS = WHEEL_0_SIZE + (WHEEL_LEVELS - 1) * WHEEL_N_SIZE;
+
+            static constexpr uint32_t INDEX_BITS = 20;
+            static constexpr uint32_t GENERATION_MASK = 0x3FF;
+            static constexpr int32_t MAX_NODES = int32_t(1) << INDEX_BITS;
+            static constexpr int32_t CHUNK_BITS = 10;
+            static constexpr int32_t CHUNK_SIZE = int32_t(1) << CHUNK_BITS;
+
+            enum class Node_State : uint8_t {
+                Free,
+                Scheduled,
+                Firing,
+                Killed
+            };
+
+            struct Timer_Node {
+                uint64_t expires_ms = 0;
+                uint32_t interval_ms = 0;
+                int32_t prev = -1;
+                int32_t next = -1;
+                int32_t slot = -1;
+                uint32_t generation = 0;
+                Node_State state = Node_State::Free;
+                bool repeat = false;
+                Callback_Func callback;
+                AMX* amx = nullptr;
+                std::string public_name;
+                Detail::Public_Packet packet;
+            };
+
+            uint64_t Now_Ms() const {
+                return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - epoch_).count());
+            }
+
+            Timer_Node& Get_Node(int32_t index) {
+                return chunks_[static_cast<size_t>(index >> CHUNK_BITS)][index & (CHUNK_SIZE - 1)];
+            }
+
+            const Timer_Node& Get_Node(int32_t index) const {
+                return chunks_[static_cast<size_t>(index >> CHUNK_BITS)][index & (CHUNK_SIZE - 1)];
+            }
+
+            static Timer_Id Make_Id(int32_t index, uint32_t generation) {
+                return static_cast<Timer_Id>((((generation & GENERATION_MASK) << INDEX_BITS) | static_cast<uint32_t>(index)) + 1u);
+            }
+
+            int32_t Resolve(Timer_Id id) const {
+                if (id <= 0)
+                    return -1;
+
+                uint32_t raw = static_cast<uint32_t>(id - 1);
+                int32_t index = static_cast<int32_t>(raw & (static_cast<uint32_t>(MAX_NODES) - 1));
+
+                if (index >= static_cast<int32_t>(node_count_))
+                    return -1;
+
+                const Timer_Node& node = Get_Node(index);
+
+                if ((node.generation & GENERATION_MASK) != (raw >> INDEX_BITS) || (node.state != Node_State::Scheduled && node.state != Node_State::Firing))
+                    return -1;
+
+                return index;
+            }
+
+            int32_t Allocate_Node() {
+                int32_t index;
+
+                if (!free_nodes_.empty()) {
+                    index = free_nodes_.back();
+                    free_nodes_.pop_back();
+                }
+                else {
+                    if (static_cast<int32_t>(node_count_) >= MAX_NODES)
+                        return (SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Error: Timer limit of %d reached.", MAX_NODES), -1);
+
+                    if ((node_count_ & (CHUNK_SIZE - 1)) == 0)
+                        chunks_.push_back(std::make_unique<Timer_Node[]>(CHUNK_SIZE));
+
+                    index = static_cast<int32_t>(node_count_++);
+                }
+
+                ++active_count_;
+
+                return index;
+            }
+
+            void Release_Node(int32_t index) {
+                Timer_Node& node = Get_Node(index);
+
+                node.state = Node_State::Free;
+                node.generation++;
+                node.callback = nullptr;
+                node.amx = nullptr;
+                node.public_name.clear();
+                node.packet.Clear();
+                free_nodes_.push_back(index);
+                --active_count_;
+            }
+
+            Timer_Id Schedule_New(int32_t index, uint32_t interval_ms, bool repeat) {
+                Timer_Node& node = Get_Node(index);
+                uint64_t base_ms = processing_ ? next_ms_ : Now_Ms();
+
+                if (!processing_ && active_count_ == 1)
+                    next_ms_ = base_ms + 1;
+
+                node.interval_ms = interval_ms ? interval_ms : 1;
+                node.repeat = repeat;
+                node.expires_ms = base_ms + node.interval_ms;
+                node.state = Node_State::Scheduled;
+                Link(index);
+
+                return Make_Id(index, node.generation);
+            }
+
+            void Link(int32_t index) {
+                Timer_Node& node = Get_Node(index);
+                uint64_t expires = node.expires_ms;
+                uint64_t delta = (expires > next_ms_) ? expires - next_ms_ : 0;
+                size_t slot;
+
+                if (delta >= MAX_WHEEL_DELTA)
+                    expires = next_ms_ + MAX_WHEEL_DELTA - 1, delta = MAX_WHEEL_DELTA - 1;
+
+                if (expires < next_ms_)
+                    slot = static_cast<size_t>(next_ms_ & WHEEL_0_MASK);
+                else if (delta < WHEEL_0_SIZE)
+                    slot = static_cast<size_t>(expires & WHEEL_0_MASK);
+                else {
+                    uint32_t level = 1;
+                    uint32_t shift = WHEEL_0_BITS;
+
+                    while (level < WHEEL_LEVELS - 1 && delta >= (uint64_t(1) << (shift + WHEEL_N_BITS))) {
+                        ++level;
+                        shift += WHEEL_N_BITS;
+                    }
+
+                    slot = static_cast<size_t>(WHEEL_0_SIZE + (level - 1) * WHEEL_N_SIZE + ((expires >> shift) & WHEEL_N_MASK));
+                }
+
+                node.slot = static_cast<int32_t>(slot);
+                node.prev = -1;
+                node.next = wheels_[slot];
+
+                if (node.next >= 0)
+                    Get_Node(node.next).prev = index;
+
+                wheels_[slot] = index;
+            }
+
+            void Unlink(int32_t index) {
+                Timer_Node& node = Get_Node(index);
+
+                if (node.slot < 0)
+                    return;
+
+                if (node.prev >= 0)
+                    Get_Node(node.prev).next = node.next;
+                else
+                    wheels_[static_cast<size_t>(node.slot)] = node.next;
+
+                if (node.next >= 0)
+                    Get_Node(node.next).prev = node.prev;
+
+                node.prev = node.next = node.slot = -1;
+            }
+
+            bool Cascade(uint32_t level) {
+                uint32_t shift = WHEEL_0_BITS + (level - 1) * WHEEL_N_BITS;
+                size_t bucket = static_cast<size_t>((next_ms_ >> shift) & WHEEL_N_MASK);
+                size_t slot = static_cast<size_t>(WHEEL_0_SIZE + (level - 1) * WHEEL_N_SIZE + bucket);
+                int32_t index = wheels_[slot];
+
+                wheels_[slot] = -1;
+
+                while (index >= 0) {
+                    int32_t next = Get_Node(index).next;
+
+                    Get_Node(index).slot = -1;
+                    Link(index);
+                    index = next;
+                }
+
+                return bucket != 0;
+            }
+
+            void Fire(int32_t index) {
+                Timer_Node& node = Get_Node(index);
+
+                if (node.expires_ms > next_ms_) {
+                    Link(index);
+
+                    return;
+                }
+
+                node.state = Node_State::Firing;
+
+                if (node.callback)
+                    node.callback();
+                else
+                    node.packet.Execute(node.amx, node.public_name.c_str());
+
+                if (node.state == Node_State::Killed || !node.repeat) {
+                    Release_Node(index);
+
+                    return;
+                }
+
+                node.state = Node_State::Scheduled;
+                node.expires_ms += node.interval_ms;
+
+                if (node.expires_ms <= target_ms_)
+                    node.expires_ms += ((target_ms_ - node.expires_ms) / node.interval_ms + 1) * node.interval_ms;
+
+                Link(index);
+            }
+
+            std::chrono::steady_clock::time_point epoch_;
+            std::array<int32_t, TOTAL_SLOTS> wheels_;
+            std::vector<std::unique_ptr<Timer_Node[]>> chunks_;
+            std::vector<int32_t> free_nodes_;
+            size_t node_count_ = 0;
+            size_t active_count_ = 0;
+            uint64_t next_ms_ = 0;
+            uint64_t target_ms_ = 0;
+            bool processing_ = false;
+    };
+}
+
+#if defined(SAMP_SDK_WANT_TIMER_NATIVES) && !defined(SAMP_SDK_WANT_PROCESS_TICK)
+    #error "SAMP_SDK_WANT_TIMER_NATIVES requires SAMP_SDK_WANT_PROCESS_TICK, timers are only processed from ProcessTick."
+#endif
+
+#if defined(SAMP_SDK_IMPLEMENTATION) && defined(SAMP_SDK_WANT_AMX_EVENTS) && defined(SAMP_SDK_WANT_TIMER_NATIVES)
+namespace Samp_SDK {
+    namespace Detail {
+        namespace Timer_Natives {
+            inline cell Create_Timer(AMX* amx, cell* params, bool extended) {
+                Native_Params p(amx, params);
+                std::string public_name = p.Get_String(0);
+                cell interval = p.Get<cell>(1);
+                bool repeat = p.Get<cell>(2) != 0;
+                int public_index = 0;
+
+                if (interval < 0)
+                    return (SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Error: SDK_SetTimer%s called with a negative interval for '%s'.", extended ? "Ex" : "", public_name.c_str()), INVALID_TIMER_ID);
+
+                if (amx::Find_Public(amx, public_name.c_str(), &public_index) != 0)
+                    return (SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Error: SDK_SetTimer%s could not find public '%s'.", extended ? "Ex" : "", public_name.c_str()), INVALID_TIMER_ID);
+
+                Public_Packet packet;
+
+                if (extended) {
+                    std::string format = p.Get_String(3);
+                    size_t arg_index = 4;
+
+                    for (char specifier : format) {
+                        cell* phys_addr = nullptr;
+
+                        if (arg_index >= p.Count())
+                            return (SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Error: SDK_SetTimerEx format '%s' expects more arguments than were passed.", format.c_str()), INVALID_TIMER_ID);
+
+                        if (amx::Get_Addr(amx, params[arg_index + 1], &phys_addr) != 0 || !phys_addr)
+                            return INVALID_TIMER_ID;
+
+                        switch (specifier) {
+                            case 's':
+                            case 'S':
+                                packet.Push_String(Samp_SDK::Get_String(amx, params[arg_index + 1]));
+                                break;
+                            case 'f':
+                            case 'F':
+                                packet.Push_Float(amx::AMX_CTOF(*phys_addr));
+                                break;
+                            case 'd':
+                            case 'D':
+                            case 'i':
+                            case 'I':
+                            case 'b':
+                            case 'B':
+                            case 'c':
+                            case 'C':
+                            case 'x':
+                            case 'X':
+                                packet.Push_Cell(*phys_addr);
+                                break;
+                            default:
+                                return (SAMP_SDK_LOG_LIMITED("[SA-MP SDK] Error: SDK_SetTimerEx format '%s' contains unsupported specifier '%c'.", format.c_str(), specifier), INVALID_TIMER_ID);
+                        }
+
+                        ++arg_index;
+                    }
+                }
+
+                return Timer_Service::Instance().Set_Pawn_Timer(amx, public_name, static_cast<uint32_t>(interval), repeat, std::move(packet));
+            }
+
+            inline cell SAMP_SDK_CDECL SDK_SetTimer(AMX* amx, cell* params) {
+                return Create_Timer(amx, params, false);
+            }
+
+            inline cell SAMP_SDK_CDECL SDK_SetTimerEx(AMX* amx, cell* params) {
+                return Create_Timer(amx, params, true);
+            }
+
+            inline cell SAMP_SDK_CDECL SDK_KillTimer(AMX* amx, cell* params) {
+                return Timer_Service::Instance().Kill_Timer(Native_Params(amx, params).Get<Timer_Id>(0)) ? 1 : 0;
+            }
+
+            inline cell SAMP_SDK_CDECL SDK_IsValidTimer(AMX* amx, cell* params) {
+                return Timer_Service::Instance().Is_Valid(Native_Params(amx, params).Get<Timer_Id>(0)) ? 1 : 0;
+            }
+        }
+    }
+}
+
+namespace {
+    ::Samp_SDK::Detail::Native_Register register_SDK_SetTimer("SDK_SetTimer", &::Samp_SDK::Detail::Timer_Natives::SDK_SetTimer);
+    ::Samp_SDK::Detail::Native_Register register_SDK_SetTimerEx("SDK_SetTimerEx", &::Samp_SDK::Detail::Timer_Natives::SDK_SetTimerEx);
+    ::Samp_SDK::Detail::Native_Register register_SDK_KillTimer("SDK_KillTimer", &::Samp_SDK::Detail::Timer_Natives::SDK_KillTimer);
+    ::Samp_SDK::Detail::Native_Register register_SDK_IsValidTimer("SDK_IsValidTimer", &::Samp_SDK::Detail::Timer_Natives::SDK_IsValidTimer);
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,895 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+//
+#include "../amx/amx_defs.h"
+#include "../amx/amx_opcodes.hpp"
+#include "../core/platform.hpp"
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define SAMP_SDK_AMX_THREADED
+#endif
+
+#if defined(SAMP_SDK_AMX_THREADED)
+    #define SAMP_SDK_AMX_OP(name) Op_##name
+    #define SAMP_SDK_AMX_NEXT() goto *labels[*cip++]
+#else
+    #define SAMP_SDK_AMX_OP(name) case static_cast<cell>(Amx_Opcode::name)
+    #define SAMP_SDK_AMX_NEXT() continue
+#endif
+
+#define SAMP_SDK_AMX_ABORT(code) do { error = static_cast<int>(code); goto Abort; } while (0)
+#define SAMP_SDK_AMX_READ(address) (*reinterpret_cast<cell*>(data + (address)))
+#define SAMP_SDK_AMX_PUSH(value) (stk -= static_cast<cell>(sizeof(cell)), SAMP_SDK_AMX_READ(stk) = (value))
+#define SAMP_SDK_AMX_POP(target) ((target) = SAMP_SDK_AMX_READ(stk), stk += static_cast<cell>(sizeof(cell)))
+#define SAMP_SDK_AMX_CHECK_MEMORY(address) do { if ((static_cast<ucell>(address) >= static_cast<ucell>(hea) && static_cast<ucell>(address) < static_cast<ucell>(stk)) || static_cast<ucell>(address) >= static_cast<ucell>(amx->stp)) SAMP_SDK_AMX_ABORT(Amx_Error::MemAccess); } while (0)
+#define SAMP_SDK_AMX_CHECK_MARGIN() do { if (hea + AMX_INTERPRETER_STACK_MARGIN > stk) SAMP_SDK_AMX_ABORT(Amx_Error::StackErr); } while (0)
+#define SAMP_SDK_AMX_JUMP_TO(offset) do { if (!Amx_Is_Code_Target(code, code_size, offset)) SAMP_SDK_AMX_ABORT(Amx_Error::MemAccess); cip = reinterpret_cast<const cell*>(code + (offset)); } while (0)
+#define SAMP_SDK_AMX_BRANCH(condition) do { if (condition) cip = reinterpret_cast<const cell*>(code + *cip); else ++cip; } while (0)
+#define SAMP_SDK_AMX_SAVE_STATE() (amx->cip = static_cast<cell>(reinterpret_cast<const unsigned char*>(cip) - code), amx->hea = hea, amx->frm = frm, amx->stk = stk)
+#define SAMP_SDK_AMX_SLEEP() do { amx->pri = pri; amx->alt = alt; amx->reset_stk = reset_stk; amx->reset_hea = reset_hea; return static_cast<int>(Amx_Error::Sleep); } while (0)
+
+namespace Samp_SDK {
+    namespace Detail {
+        constexpr int16_t AMX_INTERPRETER_FILE_VERSION = 8;
+        constexpr cell AMX_INTERPRETER_STACK_MARGIN = 16 * sizeof(cell);
+
+        SAMP_SDK_FORCE_INLINE bool Amx_Is_Code_Target(const unsigned char* code, cell code_size, cell offset) {
+            if (offset < 0 || offset >= code_size || (offset & (sizeof(cell) - 1)) != 0)
+                return false;
+
+            cell opcode;
+            std::memcpy(&opcode, code + offset, sizeof(opcode));
+
+            return opcode >= 0 && opcode < AMX_OPCODE_COUNT;
+        }
+
+        inline bool Amx_Expand_Compact(unsigned char* code, size_t compact_size, size_t memory_size) {
+            std::vector<ucell> cells;
+            cells.reserve(memory_size / sizeof(cell));
+
+            for (size_t i = 0; i < compact_size;) {
+                ucell value = (code[i] & 0x40) ? ~static_cast<ucell>(0) : 0;
+                int length = 0;
+
+                for (;;) {
+                    if (i >= compact_size || ++length > 5)
+                        return false;
+
+                    unsigned char byte = code[i++];
+                    value = (value << 7) | (byte & 0x7F);
+
+                    if ((byte & 0x80) == 0)
+                        break;
+                }
+
+                if (cells.size() >= memory_size / sizeof(cell))
+                    return false;
+
+                cells.push_back(value);
+            }
+
+            std::memcpy(code, cells.data(), cells.size() * sizeof(cell));
+            std::memset(code + cells.size() * sizeof(cell), 0, memory_size - cells.size() * sizeof(cell));
+
+            return true;
+        }
+
+        inline int Amx_Interpreter_Verify(const AMX_HEADER* hdr) {
+            const unsigned char* code = reinterpret_cast<const unsigned char*>(hdr) + hdr->cod;
+            const cell* cells = reinterpret_cast<const cell*>(code);
+            cell code_size = hdr->dat - hdr->cod;
+            size_t count = static_cast<size_t>(code_size) / sizeof(cell);
+
+            for (size_t cip = 0; cip < count;) {
+                int size = Get_Amx_Instruction_Cells(cells, count, cip);
+
+                if (size <= 0 || cip + static_cast<size_t>(size) > count)
+                    return static_cast<int>(Amx_Error::InvInstr);
+
+                auto opcode = static_cast<Amx_Opcode>(cells[cip]);
+                bool valid = true;
+
+                switch (opcode) {
+                    case Amx_Opcode::Call:
+                    case Amx_Opcode::Jump:
+                    case Amx_Opcode::Jzer:
+                    case Amx_Opcode::Jnz:
+                    case Amx_Opcode::Jeq:
+                    case Amx_Opcode::Jneq:
+                    case Amx_Opcode::Jless:
+                    case Amx_Opcode::Jleq:
+                    case Amx_Opcode::Jgrtr:
+                    case Amx_Opcode::Jgeq:
+                    case Amx_Opcode::Jsless:
+                    case Amx_Opcode::Jsleq:
+                    case Amx_Opcode::Jsgrtr:
+                    case Amx_Opcode::Jsgeq:
+                        valid = Amx_Is_Code_Target(code, code_size, cells[cip + 1]);
+                        break;
+                    case Amx_Opcode::Jrel:
+                        valid = Amx_Is_Code_Target(code, code_size, static_cast<cell>((cip + 2) * sizeof(cell)) + cells[cip + 1]);
+                        break;
+                    case Amx_Opcode::Switch:
+                        valid = Amx_Is_Code_Target(code, code_size, cells[cip + 1]) && cells[cells[cip + 1] / sizeof(cell)] == static_cast<cell>(Amx_Opcode::Casetbl);
+                        break;
+                    case Amx_Opcode::Casetbl:
+                        for (cell i = 0; i <= cells[cip + 1] && valid; ++i)
+                            valid = Amx_Is_Code_Target(code, code_size, cells[cip + 2 + 2 * i]);
+                        break;
+                    default:
+                        break;
+                }
+
+                if (!valid)
+                    return static_cast<int>(Amx_Error::InvInstr);
+
+                cip += static_cast<size_t>(size);
+            }
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int Amx_Interpreter_Prepare(AMX_HEADER* hdr) {
+            if (hdr->magic != AMX_MAGIC || hdr->defsize != sizeof(AMX_FUNCSTUBNT))
+                return static_cast<int>(Amx_Error::Format);
+
+            if (hdr->file_version < 7 || hdr->file_version > AMX_INTERPRETER_FILE_VERSION || hdr->amx_version > AMX_INTERPRETER_FILE_VERSION)
+                return static_cast<int>(Amx_Error::Version);
+
+            if (hdr->cod < static_cast<int32_t>(sizeof(AMX_HEADER)) || hdr->dat < hdr->cod || hdr->hea < hdr->dat || hdr->stp <= hdr->hea || hdr->size > hdr->hea || ((hdr->cod | hdr->dat | hdr->hea | hdr->stp) & (sizeof(cell) - 1)) != 0)
+                return static_cast<int>(Amx_Error::Format);
+
+            if (hdr->flags & AMX_FLAG_COMPACT) {
+                unsigned char* code = reinterpret_cast<unsigned char*>(hdr) + hdr->cod;
+
+                if (!Amx_Expand_Compact(code, static_cast<size_t>(hdr->size - hdr->cod), static_cast<size_t>(hdr->hea - hdr->cod)))
+                    return static_cast<int>(Amx_Error::Format);
+
+                hdr->flags &= ~AMX_FLAG_COMPACT;
+            }
+
+            return Amx_Interpreter_Verify(hdr);
+        }
+
+        inline int Amx_Interpreter_Exec(AMX* amx, cell* retval, int index) {
+            AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(amx->base);
+            const unsigned char* code = amx->base + hdr->cod;
+            unsigned char* data = amx->data ? amx->data : amx->base + hdr->dat;
+            cell code_size = hdr->dat - hdr->cod;
+            const cell* cip;
+            cell pri, alt, frm, stk, hea, reset_stk, reset_hea, offs;
+            int error;
+
+            if (index == AMX_EXEC_CONT) {
+                pri = amx->pri;
+                alt = amx->alt;
+                frm = amx->frm;
+                stk = amx->stk;
+                hea = amx->hea;
+                reset_stk = amx->reset_stk;
+                reset_hea = amx->reset_hea;
+
+                if (!Amx_Is_Code_Target(code, code_size, amx->cip))
+                    return static_cast<int>(Amx_Error::InvState);
+
+                cip = reinterpret_cast<const cell*>(code + amx->cip);
+            }
+            else {
+                cell paramcount = amx->paramcount;
+
+                amx->paramcount = 0;
+
+                if (index == AMX_EXEC_MAIN)
+                    offs = hdr->cip;
+                else if (index >= 0 && index < (hdr->natives - hdr->publics) / hdr->defsize)
+                    offs = static_cast<cell>(reinterpret_cast<AMX_FUNCSTUBNT*>(amx->base + hdr->publics)[index].address);
+                else
+                    offs = -1;
+
+                if ((amx->flags & AMX_FLAG_NTVREG) == 0 || !Amx_Is_Code_Target(code, code_size, offs)) {
+                    amx->stk += paramcount * static_cast<cell>(sizeof(cell));
+
+                    return static_cast<int>((amx->flags & AMX_FLAG_NTVREG) == 0 ? Amx_Error::NotFound : Amx_Error::Index);
+                }
+
+                pri = alt = 0;
+                frm = amx->frm;
+                stk = amx->stk;
+                hea = amx->hea;
+                reset_stk = stk + paramcount * static_cast<cell>(sizeof(cell));
+                reset_hea = hea;
+
+                if (hea + AMX_INTERPRETER_STACK_MARGIN > stk - 2 * static_cast<cell>(sizeof(cell))) {
+                    amx->stk = reset_stk;
+
+                    return static_cast<int>(Amx_Error::StackErr);
+                }
+
+                SAMP_SDK_AMX_PUSH(paramcount * static_cast<cell>(sizeof(cell)));
+                SAMP_SDK_AMX_PUSH(0);
+                cip = reinterpret_cast<const cell*>(code + offs);
+            }
+
+            amx->error = static_cast<int>(Amx_Error::None);
+
+#if defined(SAMP_SDK_AMX_THREADED)
+            static const void* const labels[AMX_OPCODE_COUNT] = {
+                &&Op_None, &&Op_Load_Pri, &&Op_Load_Alt, &&Op_Load_S_Pri, &&Op_Load_S_Alt, &&Op_Lref_Pri, &&Op_Lref_Alt, &&Op_Lref_S_Pri,
+                &&Op_Lref_S_Alt, &&Op_Load_I, &&Op_Lodb_I, &&Op_Const_Pri, &&Op_Const_Alt, &&Op_Addr_Pri, &&Op_Addr_Alt, &&Op_Stor_Pri,
+                &&Op_Stor_Alt, &&Op_Stor_S_Pri, &&Op_Stor_S_Alt, &&Op_Sref_Pri, &&Op_Sref_Alt, &&Op_Sref_S_Pri, &&Op_Sref_S_Alt, &&Op_Stor_I,
+                &&Op_Strb_I, &&Op_Lidx, &&Op_Lidx_B, &&Op_Idxaddr, &&Op_Idxaddr_B, &&Op_Align_Pri, &&Op_Align_Alt, &&Op_Lctrl,
+                &&Op_Sctrl, &&Op_Move_Pri, &&Op_Move_Alt, &&Op_Xchg, &&Op_Push_Pri, &&Op_Push_Alt, &&Op_Push_R, &&Op_Push_C,
+                &&Op_Push, &&Op_Push_S, &&Op_Pop_Pri, &&Op_Pop_Alt, &&Op_Stack, &&Op_Heap, &&Op_Proc, &&Op_Ret,
+                &&Op_Retn, &&Op_Call, &&Op_Call_Pri, &&Op_Jump, &&Op_Jrel, &&Op_Jzer, &&Op_Jnz, &&Op_Jeq,
+                &&Op_Jneq, &&Op_Jless, &&Op_Jleq, &&Op_Jgrtr, &&Op_Jgeq, &&Op_Jsless, &&Op_Jsleq, &&Op_Jsgrtr,
+                &&Op_Jsgeq, &&Op_Shl, &&Op_Shr, &&Op_Sshr, &&Op_Shl_C_Pri, &&Op_Shl_C_Alt, &&Op_Shr_C_Pri, &&Op_Shr_C_Alt,
+                &&Op_Smul, &&Op_Sdiv, &&Op_Sdiv_Alt, &&Op_Umul, &&Op_Udiv, &&Op_Udiv_Alt, &&Op_Add, &&Op_Sub,
+                &&Op_Sub_Alt, &&Op_And, &&Op_Or, &&Op_Xor, &&Op_Not, &&Op_Neg, &&Op_Invert, &&Op_Add_C,
+                &&Op_Smul_C, &&Op_Zero_Pri, &&Op_Zero_Alt, &&Op_Zero, &&Op_Zero_S, &&Op_Sign_Pri, &&Op_Sign_Alt, &&Op_Eq,
+                &&Op_Neq, &&Op_Less, &&Op_Leq, &&Op_Grtr, &&Op_Geq, &&Op_Sless, &&Op_Sleq, &&Op_Sgrtr,
+                &&Op_Sgeq, &&Op_Eq_C_Pri, &&Op_Eq_C_Alt, &&Op_Inc_Pri, &&Op_Inc_Alt, &&Op_Inc, &&Op_Inc_S, &&Op_Inc_I,
+                &&Op_Dec_Pri, &&Op_Dec_Alt, &&Op_Dec, &&Op_Dec_S, &&Op_Dec_I, &&Op_Movs, &&Op_Cmps, &&Op_Fill,
+                &&Op_Halt, &&Op_Bounds, &&Op_Sysreq_Pri, &&Op_Sysreq_C, &&Op_File, &&Op_Line, &&Op_Symbol, &&Op_Srange,
+                &&Op_Jump_Pri, &&Op_Switch, &&Op_Casetbl, &&Op_Swap_Pri, &&Op_Swap_Alt, &&Op_Push_Adr, &&Op_Nop, &&Op_Sysreq_D,
+                &&Op_Symtag, &&Op_Break
+            };
+
+            SAMP_SDK_AMX_NEXT();
+#else
+            for (;;) {
+                switch (*cip++) {
+#endif
+            SAMP_SDK_AMX_OP(Load_Pri):
+                pri = SAMP_SDK_AMX_READ(*cip++);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Load_Alt):
+                alt = SAMP_SDK_AMX_READ(*cip++);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Load_S_Pri):
+                pri = SAMP_SDK_AMX_READ(frm + *cip++);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Load_S_Alt):
+                alt = SAMP_SDK_AMX_READ(frm + *cip++);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Lref_Pri):
+                pri = SAMP_SDK_AMX_READ(SAMP_SDK_AMX_READ(*cip++));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Lref_Alt):
+                alt = SAMP_SDK_AMX_READ(SAMP_SDK_AMX_READ(*cip++));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Lref_S_Pri):
+                pri = SAMP_SDK_AMX_READ(SAMP_SDK_AMX_READ(frm + *cip++));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Lref_S_Alt):
+                alt = SAMP_SDK_AMX_READ(SAMP_SDK_AMX_READ(frm + *cip++));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Load_I):
+                SAMP_SDK_AMX_CHECK_MEMORY(pri);
+                pri = SAMP_SDK_AMX_READ(pri);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Lodb_I):
+                SAMP_SDK_AMX_CHECK_MEMORY(pri);
+                offs = *cip++;
+
+                if (offs == 1)
+                    pri = *(data + pri);
+                else if (offs == 2)
+                    pri = *reinterpret_cast<uint16_t*>(data + pri);
+                else if (offs == 4)
+                    pri = SAMP_SDK_AMX_READ(pri);
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Const_Pri):
+                pri = *cip++;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Const_Alt):
+                alt = *cip++;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Addr_Pri):
+                pri = frm + *cip++;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Addr_Alt):
+                alt = frm + *cip++;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Stor_Pri):
+                SAMP_SDK_AMX_READ(*cip++) = pri;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Stor_Alt):
+                SAMP_SDK_AMX_READ(*cip++) = alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Stor_S_Pri):
+                SAMP_SDK_AMX_READ(frm + *cip++) = pri;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Stor_S_Alt):
+                SAMP_SDK_AMX_READ(frm + *cip++) = alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sref_Pri):
+                SAMP_SDK_AMX_READ(SAMP_SDK_AMX_READ(*cip++)) = pri;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sref_Alt):
+                SAMP_SDK_AMX_READ(SAMP_SDK_AMX_READ(*cip++)) = alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sref_S_Pri):
+                SAMP_SDK_AMX_READ(SAMP_SDK_AMX_READ(frm + *cip++)) = pri;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sref_S_Alt):
+                SAMP_SDK_AMX_READ(SAMP_SDK_AMX_READ(frm + *cip++)) = alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Stor_I):
+                SAMP_SDK_AMX_CHECK_MEMORY(alt);
+                SAMP_SDK_AMX_READ(alt) = pri;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Strb_I):
+                SAMP_SDK_AMX_CHECK_MEMORY(alt);
+                offs = *cip++;
+
+                if (offs == 1)
+                    *(data + alt) = static_cast<unsigned char>(pri);
+                else if (offs == 2)
+                    *reinterpret_cast<uint16_t*>(data + alt) = static_cast<uint16_t>(pri);
+                else if (offs == 4)
+                    SAMP_SDK_AMX_READ(alt) = pri;
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Lidx):
+                offs = static_cast<cell>(static_cast<ucell>(pri) * sizeof(cell) + static_cast<ucell>(alt));
+                SAMP_SDK_AMX_CHECK_MEMORY(offs);
+                pri = SAMP_SDK_AMX_READ(offs);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Lidx_B):
+                offs = static_cast<cell>((static_cast<ucell>(pri) << *cip++) + static_cast<ucell>(alt));
+                SAMP_SDK_AMX_CHECK_MEMORY(offs);
+                pri = SAMP_SDK_AMX_READ(offs);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Idxaddr):
+                pri = static_cast<cell>(static_cast<ucell>(pri) * sizeof(cell) + static_cast<ucell>(alt));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Idxaddr_B):
+                pri = static_cast<cell>((static_cast<ucell>(pri) << *cip++) + static_cast<ucell>(alt));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Align_Pri):
+                offs = *cip++;
+
+                if (offs < static_cast<cell>(sizeof(cell)))
+                    pri ^= static_cast<cell>(sizeof(cell)) - offs;
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Align_Alt):
+                offs = *cip++;
+
+                if (offs < static_cast<cell>(sizeof(cell)))
+                    alt ^= static_cast<cell>(sizeof(cell)) - offs;
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Lctrl):
+                switch (*cip++) {
+                    case 0: pri = hdr->cod; break;
+                    case 1: pri = hdr->dat; break;
+                    case 2: pri = hea; break;
+                    case 3: pri = amx->stp; break;
+                    case 4: pri = stk; break;
+                    case 5: pri = frm; break;
+                    case 6: pri = static_cast<cell>(reinterpret_cast<const unsigned char*>(cip) - code); break;
+                }
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sctrl):
+                switch (*cip++) {
+                    case 2: hea = pri; break;
+                    case 4: stk = pri; break;
+                    case 5: frm = pri; break;
+                    case 6: SAMP_SDK_AMX_JUMP_TO(pri); break;
+                }
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Move_Pri):
+                pri = alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Move_Alt):
+                alt = pri;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Xchg):
+                offs = pri;
+                pri = alt;
+                alt = offs;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Push_Pri):
+                SAMP_SDK_AMX_PUSH(pri);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Push_Alt):
+                SAMP_SDK_AMX_PUSH(alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Push_R):
+                for (offs = *cip++; offs-- > 0;)
+                    SAMP_SDK_AMX_PUSH(pri);
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Push_C):
+                SAMP_SDK_AMX_PUSH(*cip++);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Push):
+                SAMP_SDK_AMX_PUSH(SAMP_SDK_AMX_READ(*cip++));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Push_S):
+                SAMP_SDK_AMX_PUSH(SAMP_SDK_AMX_READ(frm + *cip++));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Pop_Pri):
+                SAMP_SDK_AMX_POP(pri);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Pop_Alt):
+                SAMP_SDK_AMX_POP(alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Stack):
+                alt = stk;
+                stk += *cip++;
+                SAMP_SDK_AMX_CHECK_MARGIN();
+
+                if (stk > amx->stp)
+                    SAMP_SDK_AMX_ABORT(Amx_Error::StackLow);
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Heap):
+                alt = hea;
+                hea += *cip++;
+                SAMP_SDK_AMX_CHECK_MARGIN();
+
+                if (hea < amx->hlw)
+                    SAMP_SDK_AMX_ABORT(Amx_Error::HeapLow);
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Proc):
+                SAMP_SDK_AMX_PUSH(frm);
+                frm = stk;
+                SAMP_SDK_AMX_CHECK_MARGIN();
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Ret):
+                SAMP_SDK_AMX_POP(frm);
+                SAMP_SDK_AMX_POP(offs);
+                SAMP_SDK_AMX_JUMP_TO(offs);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Retn):
+                SAMP_SDK_AMX_POP(frm);
+                SAMP_SDK_AMX_POP(offs);
+                SAMP_SDK_AMX_JUMP_TO(offs);
+                stk += SAMP_SDK_AMX_READ(stk) + static_cast<cell>(sizeof(cell));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Call):
+                SAMP_SDK_AMX_PUSH(static_cast<cell>(reinterpret_cast<const unsigned char*>(cip + 1) - code));
+                cip = reinterpret_cast<const cell*>(code + *cip);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Call_Pri):
+                SAMP_SDK_AMX_PUSH(static_cast<cell>(reinterpret_cast<const unsigned char*>(cip) - code));
+                SAMP_SDK_AMX_JUMP_TO(pri);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jump):
+                cip = reinterpret_cast<const cell*>(code + *cip);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jrel):
+                offs = *cip++;
+                cip = reinterpret_cast<const cell*>(reinterpret_cast<const unsigned char*>(cip) + offs);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jzer):
+                SAMP_SDK_AMX_BRANCH(pri == 0);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jnz):
+                SAMP_SDK_AMX_BRANCH(pri != 0);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jeq):
+                SAMP_SDK_AMX_BRANCH(pri == alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jneq):
+                SAMP_SDK_AMX_BRANCH(pri != alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jless):
+                SAMP_SDK_AMX_BRANCH(static_cast<ucell>(pri) < static_cast<ucell>(alt));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jleq):
+                SAMP_SDK_AMX_BRANCH(static_cast<ucell>(pri) <= static_cast<ucell>(alt));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jgrtr):
+                SAMP_SDK_AMX_BRANCH(static_cast<ucell>(pri) > static_cast<ucell>(alt));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jgeq):
+                SAMP_SDK_AMX_BRANCH(static_cast<ucell>(pri) >= static_cast<ucell>(alt));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jsless):
+                SAMP_SDK_AMX_BRANCH(pri < alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jsleq):
+                SAMP_SDK_AMX_BRANCH(pri <= alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jsgrtr):
+                SAMP_SDK_AMX_BRANCH(pri > alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jsgeq):
+                SAMP_SDK_AMX_BRANCH(pri >= alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Shl):
+                pri = static_cast<cell>(static_cast<ucell>(pri) << (alt & 31));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Shr):
+                pri = static_cast<cell>(static_cast<ucell>(pri) >> (alt & 31));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sshr):
+                pri >>= (alt & 31);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Shl_C_Pri):
+                pri = static_cast<cell>(static_cast<ucell>(pri) << (*cip++ & 31));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Shl_C_Alt):
+                alt = static_cast<cell>(static_cast<ucell>(alt) << (*cip++ & 31));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Shr_C_Pri):
+                pri = static_cast<cell>(static_cast<ucell>(pri) >> (*cip++ & 31));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Shr_C_Alt):
+                alt = static_cast<cell>(static_cast<ucell>(alt) >> (*cip++ & 31));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Smul):
+                pri = static_cast<cell>(static_cast<ucell>(pri) * static_cast<ucell>(alt));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sdiv):
+                if (alt == 0)
+                    SAMP_SDK_AMX_ABORT(Amx_Error::Divide);
+
+                offs = static_cast<cell>((static_cast<int64_t>(pri) % alt + alt) % alt);
+                pri = static_cast<cell>((static_cast<int64_t>(pri) - offs) / alt);
+                alt = offs;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sdiv_Alt):
+                if (pri == 0)
+                    SAMP_SDK_AMX_ABORT(Amx_Error::Divide);
+
+                offs = static_cast<cell>((static_cast<int64_t>(alt) % pri + pri) % pri);
+                pri = static_cast<cell>((static_cast<int64_t>(alt) - offs) / pri);
+                alt = offs;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Umul):
+                pri = static_cast<cell>(static_cast<ucell>(pri) * static_cast<ucell>(alt));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Udiv):
+                if (alt == 0)
+                    SAMP_SDK_AMX_ABORT(Amx_Error::Divide);
+
+                offs = static_cast<cell>(static_cast<ucell>(pri) % static_cast<ucell>(alt));
+                pri = static_cast<cell>(static_cast<ucell>(pri) / static_cast<ucell>(alt));
+                alt = offs;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Udiv_Alt):
+                if (pri == 0)
+                    SAMP_SDK_AMX_ABORT(Amx_Error::Divide);
+
+                offs = static_cast<cell>(static_cast<ucell>(alt) % static_cast<ucell>(pri));
+                pri = static_cast<cell>(static_cast<ucell>(alt) / static_cast<ucell>(pri));
+                alt = offs;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Add):
+                pri = static_cast<cell>(static_cast<ucell>(pri) + static_cast<ucell>(alt));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sub):
+                pri = static_cast<cell>(static_cast<ucell>(pri) - static_cast<ucell>(alt));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sub_Alt):
+                pri = static_cast<cell>(static_cast<ucell>(alt) - static_cast<ucell>(pri));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(And):
+                pri &= alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Or):
+                pri |= alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Xor):
+                pri ^= alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Not):
+                pri = !pri;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Neg):
+                pri = static_cast<cell>(0 - static_cast<ucell>(pri));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Invert):
+                pri = ~pri;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Add_C):
+                pri = static_cast<cell>(static_cast<ucell>(pri) + static_cast<ucell>(*cip++));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Smul_C):
+                pri = static_cast<cell>(static_cast<ucell>(pri) * static_cast<ucell>(*cip++));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Zero_Pri):
+                pri = 0;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Zero_Alt):
+                alt = 0;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Zero):
+                SAMP_SDK_AMX_READ(*cip++) = 0;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Zero_S):
+                SAMP_SDK_AMX_READ(frm + *cip++) = 0;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sign_Pri):
+                if ((pri & 0xFF) >= 0x80)
+                    pri |= ~static_cast<cell>(0xFF);
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sign_Alt):
+                if ((alt & 0xFF) >= 0x80)
+                    alt |= ~static_cast<cell>(0xFF);
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Eq):
+                pri = pri == alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Neq):
+                pri = pri != alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Less):
+                pri = static_cast<ucell>(pri) < static_cast<ucell>(alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Leq):
+                pri = static_cast<ucell>(pri) <= static_cast<ucell>(alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Grtr):
+                pri = static_cast<ucell>(pri) > static_cast<ucell>(alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Geq):
+                pri = static_cast<ucell>(pri) >= static_cast<ucell>(alt);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sless):
+                pri = pri < alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sleq):
+                pri = pri <= alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sgrtr):
+                pri = pri > alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sgeq):
+                pri = pri >= alt;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Eq_C_Pri):
+                pri = pri == *cip++;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Eq_C_Alt):
+                pri = alt == *cip++;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Inc_Pri):
+                pri = static_cast<cell>(static_cast<ucell>(pri) + 1);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Inc_Alt):
+                alt = static_cast<cell>(static_cast<ucell>(alt) + 1);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Inc):
+                offs = *cip++;
+                SAMP_SDK_AMX_READ(offs) = static_cast<cell>(static_cast<ucell>(SAMP_SDK_AMX_READ(offs)) + 1);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Inc_S):
+                offs = frm + *cip++;
+                SAMP_SDK_AMX_READ(offs) = static_cast<cell>(static_cast<ucell>(SAMP_SDK_AMX_READ(offs)) + 1);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Inc_I):
+                SAMP_SDK_AMX_CHECK_MEMORY(pri);
+                SAMP_SDK_AMX_READ(pri) = static_cast<cell>(static_cast<ucell>(SAMP_SDK_AMX_READ(pri)) + 1);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Dec_Pri):
+                pri = static_cast<cell>(static_cast<ucell>(pri) - 1);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Dec_Alt):
+                alt = static_cast<cell>(static_cast<ucell>(alt) - 1);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Dec):
+                offs = *cip++;
+                SAMP_SDK_AMX_READ(offs) = static_cast<cell>(static_cast<ucell>(SAMP_SDK_AMX_READ(offs)) - 1);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Dec_S):
+                offs = frm + *cip++;
+                SAMP_SDK_AMX_READ(offs) = static_cast<cell>(static_cast<ucell>(SAMP_SDK_AMX_READ(offs)) - 1);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Dec_I):
+                SAMP_SDK_AMX_CHECK_MEMORY(pri);
+                SAMP_SDK_AMX_READ(pri) = static_cast<cell>(static_cast<ucell>(SAMP_SDK_AMX_READ(pri)) - 1);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Movs):
+                offs = *cip++;
+                SAMP_SDK_AMX_CHECK_MEMORY(pri);
+                SAMP_SDK_AMX_CHECK_MEMORY(pri + offs - 1);
+                SAMP_SDK_AMX_CHECK_MEMORY(alt);
+                SAMP_SDK_AMX_CHECK_MEMORY(alt + offs - 1);
+                std::memmove(data + alt, data + pri, static_cast<size_t>(offs));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Cmps):
+                offs = *cip++;
+                SAMP_SDK_AMX_CHECK_MEMORY(pri);
+                SAMP_SDK_AMX_CHECK_MEMORY(pri + offs - 1);
+                SAMP_SDK_AMX_CHECK_MEMORY(alt);
+                SAMP_SDK_AMX_CHECK_MEMORY(alt + offs - 1);
+                pri = std::memcmp(data + alt, data + pri, static_cast<size_t>(offs));
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Fill):
+                offs = *cip++;
+                SAMP_SDK_AMX_CHECK_MEMORY(alt);
+                SAMP_SDK_AMX_CHECK_MEMORY(alt + offs - 1);
+
+                for (cell address = alt; offs >= static_cast<cell>(sizeof(cell)); address += sizeof(cell), offs -= sizeof(cell))
+                    SAMP_SDK_AMX_READ(address) = pri;
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Halt):
+                offs = *cip++;
+
+                if (retval)
+                    *retval = pri;
+
+                SAMP_SDK_AMX_SAVE_STATE();
+                amx->pri = pri;
+                amx->alt = alt;
+
+                if (offs == static_cast<cell>(Amx_Error::Sleep))
+                    SAMP_SDK_AMX_SLEEP();
+
+                SAMP_SDK_AMX_ABORT(offs);
+            SAMP_SDK_AMX_OP(Bounds):
+                if (static_cast<ucell>(pri) > static_cast<ucell>(*cip++)) {
+                    amx->cip = static_cast<cell>(reinterpret_cast<const unsigned char*>(cip) - code);
+                    SAMP_SDK_AMX_ABORT(Amx_Error::Bounds);
+                }
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sysreq_Pri):
+                offs = pri;
+                goto Sysreq;
+            SAMP_SDK_AMX_OP(Sysreq_C):
+                offs = *cip++;
+            Sysreq:
+                SAMP_SDK_AMX_SAVE_STATE();
+                error = amx->callback(amx, offs, &pri, reinterpret_cast<cell*>(data + stk));
+
+                if (error != static_cast<int>(Amx_Error::None)) {
+                    if (error == static_cast<int>(Amx_Error::Sleep))
+                        SAMP_SDK_AMX_SLEEP();
+
+                    goto Abort;
+                }
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Sysreq_D):
+                offs = *cip++;
+                SAMP_SDK_AMX_SAVE_STATE();
+                amx->error = static_cast<int>(Amx_Error::None);
+                pri = reinterpret_cast<AMX_NATIVE>(static_cast<uintptr_t>(static_cast<ucell>(offs)))(amx, reinterpret_cast<cell*>(data + stk));
+
+                if (amx->error != static_cast<int>(Amx_Error::None)) {
+                    if (amx->error == static_cast<int>(Amx_Error::Sleep))
+                        SAMP_SDK_AMX_SLEEP();
+
+                    SAMP_SDK_AMX_ABORT(amx->error);
+                }
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Jump_Pri):
+                SAMP_SDK_AMX_JUMP_TO(pri);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Switch): {
+                const cell* table = reinterpret_cast<const cell*>(code + *cip) + 1;
+                cell records = table[0];
+
+                cip = reinterpret_cast<const cell*>(code + table[1]);
+
+                for (table += 2; records > 0; --records, table += 2) {
+                    if (table[0] == pri) {
+                        cip = reinterpret_cast<const cell*>(code + table[1]);
+
+                        break;
+                    }
+                }
+
+                SAMP_SDK_AMX_NEXT();
+            }
+            SAMP_SDK_AMX_OP(Swap_Pri):
+                offs = SAMP_SDK_AMX_READ(stk);
+                SAMP_SDK_AMX_READ(stk) = pri;
+                pri = offs;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Swap_Alt):
+                offs = SAMP_SDK_AMX_READ(stk);
+                SAMP_SDK_AMX_READ(stk) = alt;
+                alt = offs;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Push_Adr):
+                SAMP_SDK_AMX_PUSH(frm + *cip++);
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Nop):
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Symtag):
+                ++cip;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Srange):
+                cip += 2;
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(Break):
+                if (amx->debug) {
+                    SAMP_SDK_AMX_SAVE_STATE();
+                    error = amx->debug(amx);
+
+                    if (error != static_cast<int>(Amx_Error::None)) {
+                        if (error == static_cast<int>(Amx_Error::Sleep))
+                            SAMP_SDK_AMX_SLEEP();
+
+                        goto Abort;
+                    }
+                }
+
+                SAMP_SDK_AMX_NEXT();
+            SAMP_SDK_AMX_OP(None):
+            SAMP_SDK_AMX_OP(File):
+            SAMP_SDK_AMX_OP(Line):
+            SAMP_SDK_AMX_OP(Symbol):
+            SAMP_SDK_AMX_OP(Casetbl):
+#if !defined(SAMP_SDK_AMX_THREADED)
+                default:
+#endif
+                SAMP_SDK_AMX_ABORT(Amx_Error::InvInstr);
+#if !defined(SAMP_SDK_AMX_THREADED)
+                }
+            }
+#endif
+
+        Abort:
+            amx->stk = reset_stk;
+            amx->hea = reset_hea;
+
+            return error;
+        }
+    }
+}
+
+#undef SAMP_SDK_AMX_SLEEP
+#undef SAMP_SDK_AMX_SAVE_STATE
+#undef SAMP_SDK_AMX_BRANCH
+#undef SAMP_SDK_AMX_JUMP_TO
+#undef SAMP_SDK_AMX_CHECK_MARGIN
+#undef SAMP_SDK_AMX_CHECK_MEMORY
+#undef SAMP_SDK_AMX_POP
+#undef SAMP_SDK_AMX_PUSH
+#undef SAMP_SDK_AMX_READ
+#undef SAMP_SDK_AMX_ABORT
+#undef SAMP_SDK_AMX_NEXT
+#undef SAMP_SDK_AMX_OP
+#undef SAMP_SDK_AMX_THREADED
\ No newline at end of file
@@ -0,0 +1,403 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+//
+#include "../core/platform.hpp"
+
+#if defined(SAMP_SDK_WINDOWS)
+    #include <malloc.h>
+#endif
+
+namespace Samp_SDK {
+    namespace Detail {
+        inline std::atomic<uint64_t>& Benchmark_Allocation_Counter() {
+            static std::atomic<uint64_t> counter{0};
+
+            return counter;
+        }
+
+        inline void* Benchmark_Aligned_Alloc(std::size_t size, std::align_val_t alignment) noexcept {
+            std::size_t align = std::max(static_cast<std::size_t>(alignment), sizeof(void*));
+
+            Benchmark_Allocation_Counter().fetch_add(1, std::memory_order_relaxed);
+
+#if defined(SAMP_SDK_WINDOWS)
+            return _aligned_malloc(size ? size : 1, align);
+#else
+            void* ptr = nullptr;
+
+            return posix_memalign(&ptr, align, size ? size : 1) == 0 ? ptr : nullptr;
+#endif
+        }
+
+        inline void Benchmark_Aligned_Free(void* ptr) noexcept {
+#if defined(SAMP_SDK_WINDOWS)
+            _aligned_free(ptr);
+#else
+            std::free(ptr);
+#endif
+        }
+    }
+
+    namespace Testing {
+        using Benchmark_Func = std::function<void(uint64_t iterations)>;
+
+        struct Benchmark_Result {
+            std::string name;
+            double ns_per_op = 0.0;
+            double allocs_per_op = 0.0;
+            uint64_t iterations = 0;
+        };
+
+        struct Benchmark_Options {
+            std::string filter;
+            std::chrono::milliseconds min_time{200};
+            int repetitions = 3;
+            std::string baseline_path;
+            std::string save_baseline_path;
+            double tolerance = 0.10;
+        };
+
+        template<typename T>
+        SAMP_SDK_FORCE_INLINE void Do_Not_Optimize(T const& value) {
+#if defined(SAMP_SDK_COMPILER_GCC_OR_CLANG)
+            asm volatile("" : : "r,m"(value) : "memory");
+#else
+            const volatile T* sink = &value;
+            (void)sink;
+#endif
+        }
+
+        class Benchmark_Registry {
+            public:
+                static Benchmark_Registry& Instance() {
+                    static Benchmark_Registry instance;
+
+                    return instance;
+                }
+
+                void Add(const char* name, Benchmark_Func func) {
+                    benchmarks_.push_back({name, std::move(func)});
+                }
+
+                std::vector<Benchmark_Result> Run(const Benchmark_Options& options) {
+                    std::vector<Benchmark_Result> results;
+
+                    for (const auto& benchmark : benchmarks_) {
+                        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos)
+                            continue;
+
+                        results.push_back(Run_One(benchmark, options));
+                        std::printf("%-48s %14.1f ns/op %10.2f allocs/op %12llu iterations\n", results.back().name.c_str(), results.back().ns_per_op,
+                            results.back().allocs_per_op, static_cast<unsigned long long>(results.back().iterations));
+                        std::fflush(stdout);
+                    }
+
+                    return results;
+                }
+
+                static bool Save_Baseline(const std::string& path, const std::vector<Benchmark_Result>& results) {
+                    std::ofstream file(path, std::ios::trunc);
+
+                    if (!file)
+                        return false;
+
+                    for (const auto& result : results)
+                        file << result.name << '\t' << result.ns_per_op << '\t' << result.allocs_per_op << '\n';
+
+                    return static_cast<bool>(file);
+                }
+
+                static int Compare_Baseline(const std::string& path, const std::vector<Benchmark_Result>& results, double tolerance) {
+                    std::ifstream file(path);
+
+                    if (!file) {
+                        std::printf("Could not open baseline '%s'.\n", path.c_str());
+
+                        return -1;
+                    }
+
+                    std::map<std::string, std::pair<double, double>> baseline;
+                    std::string line;
+
+                    while (std::getline(file, line)) {
+                        std::istringstream stream(line);
+                        std::string name;
+                        double ns = 0.0, allocs = 0.0;
+
+                        if (std::getline(stream, name, '\t') && stream >> ns >> allocs)
+                            baseline[name] = {ns, allocs};
+                    }
+
+                    int regressions = 0;
+
+                    std::printf("\n%-48s %12s %12s %9s %12s\n", "benchmark", "baseline", "current", "delta", "allocs");
+
+                    for (const auto& result : results) {
+                        auto it = baseline.find(result.name);
+
+                        if (it == baseline.end()) {
+                            std::printf("%-48s %12s %12.1f %9s %12.2f\n", result.name.c_str(), "-", result.ns_per_op, "new", result.allocs_per_op);
+
+                            continue;
+                        }
+
+                        double delta = it->second.first > 0.0 ? (result.ns_per_op - it->second.first) / it->second.first : 0.0;
+                        bool slower = delta > tolerance;
+                        bool more_allocs = result.allocs_per_op > it->second.second + 0.01;
+
+                        if (slower || more_allocs)
+                            ++regressions;
+
+                        std::printf("%-48s %12.1f %12.1f %+8.1f%% %5.2f->%-5.2f%s\n", result.name.c_str(), it->second.first, result.ns_per_op, delta * 100.0,
+                            it->second.second, result.allocs_per_op, (slower || more_allocs) ? "  REGRESSION" : "");
+                    }
+
+                    return regressions;
+                }
+
+                int Main(int argc, char** argv) {
+                    Benchmark_Options options;
+
+                    for (int i = 1; i < argc; ++i) {
+                        std::string arg = argv[i];
+                        auto value = [&arg](const char* prefix) { return arg.compare(0, std::strlen(prefix), prefix) == 0 ? arg.substr(std::strlen(prefix)) : std::string(); };
+
+                        if (!value("--filter=").empty())
+                            options.filter = value("--filter=");
+                        else if (!value("--min-time=").empty())
+                            options.min_time = std::chrono::milliseconds(std::atoi(value("--min-time=").c_str()));
+                        else if (!value("--repetitions=").empty())
+                            options.repetitions = std::max(1, std::atoi(value("--repetitions=").c_str()));
+                        else if (!value("--baseline=").empty())
+                            options.baseline_path = value("--baseline=");
+                        else if (!value("--save-baseline=").empty())
+                            options.save_baseline_path = value("--save-baseline=");
+                        else if (!value("--tolerance=").empty())
+                            options.tolerance = std::atof(value("--tolerance=").c_str()) / 100.0;
+                        else {
+                            std::printf("Usage: %s [--filter=text] [--min-time=ms] [--repetitions=n] [--baseline=file] [--save-baseline=file] [--tolerance=percent]\n", argv[0]);
+
+                            return 2;
+                        }
+                    }
+
+                    std::vector<Benchmark_Result> results = Run(options);
+
+                    if (!options.save_baseline_path.empty() && !Save_Baseline(options.save_baseline_path, results)) {
+                        std::printf("Could not write baseline '%s'.\n", options.save_baseline_path.c_str());
+
+                        return 2;
+                    }
+
+                    if (options.baseline_path.empty())
+                        return 0;
+
+                    int regressions = Compare_Baseline(options.baseline_path, results, options.tolerance);
+
+                    if (regressions > 0)
+                        std::printf("\n%d benchmark(s) regressed beyond %.1f%%.\n", regressions, options.tolerance * 100.0);
+
+                    return regressions == 0 ? 0 : 1;
+                }
+
+            private:
+                Benchmark_Registry() = default;
+                ~Benchmark_Registry() = default;
+                Benchmark_Registry(const Benchmark_Registry&) = delete;
+                Benchmark_Registry& operator=(const Benchmark_Registry&) = delete;
+
+                struct Entry {
+                    std::string name;
+                    Benchmark_Func func;
+                };
+
+                static Benchmark_Result Run_One(const Entry& benchmark, const Benchmark_Options& options) {
+                    using Clock = std::chrono::steady_clock;
+
+                    auto measure = [&benchmark](uint64_t iterations, uint64_t& allocations) {
+                        uint64_t allocs_before = Detail::Benchmark_Allocation_Counter().load(std::memory_order_relaxed);
+                        auto start = Clock::now();
+
+                        benchmark.func(iterations);
+
+                        auto elapsed = Clock::now() - start;
+                        allocations = Detail::Benchmark_Allocation_Counter().load(std::memory_order_relaxed) - allocs_before;
+
+                        return std::chrono::duration<double, std::nano>(elapsed).count();
+                    };
+
+                    double target_ns = std::chrono::duration<double, std::nano>(options.min_time).count();
+                    uint64_t iterations = 1;
+                    uint64_t allocations = 0;
+                    double elapsed_ns = measure(iterations, allocations);
+
+                    while (elapsed_ns < target_ns / 10.0 && iterations < (static_cast<uint64_t>(1) << 40)) {
+                        iterations *= 4;
+                        elapsed_ns = measure(iterations, allocations);
+                    }
+
+                    if (elapsed_ns > 0.0 && elapsed_ns < target_ns)
+                        iterations = std::max<uint64_t>(1, static_cast<uint64_t>(static_cast<double>(iterations) * target_ns / elapsed_ns));
+
+                    Benchmark_Result result;
+                    result.name = benchmark.name;
+                    result.iterations = iterations;
+                    result.ns_per_op = -1.0;
+
+                    for (int i = 0; i < options.repetitions; ++i) {
+                        double ns = measure(iterations, allocations) / static_cast<double>(iterations);
+
+                        if (result.ns_per_op < 0.0 || ns < result.ns_per_op) {
+                            result.ns_per_op = ns;
+                            result.allocs_per_op = static_cast<double>(allocations) / static_cast<double>(iterations);
+                        }
+                    }
+
+                    return result;
+                }
+
+                std::vector<Entry> benchmarks_;
+        };
+
+        class Benchmark_Register {
+            public:
+                Benchmark_Register(const char* name, Benchmark_Func func) {
+                    Benchmark_Registry::Instance().Add(name, std::move(func));
+                }
+        };
+    }
+}
+
+#if defined(SAMP_SDK_BENCHMARK_MAIN)
+void* operator new(std::size_t size) {
+    Samp_SDK::Detail::Benchmark_Allocation_Counter().fetch_add(1, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    Samp_SDK::Detail::Benchmark_Allocation_Counter().fetch_add(1, std::memory_order_relaxed);
+
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = Samp_SDK::Detail::Benchmark_Aligned_Alloc(size, alignment))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Samp_SDK::Detail::Benchmark_Aligned_Alloc(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Samp_SDK::Detail::Benchmark_Aligned_Alloc(size, alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    Samp_SDK::Detail::Benchmark_Aligned_Free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+    Samp_SDK::Detail::Benchmark_Aligned_Free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    Samp_SDK::Detail::Benchmark_Aligned_Free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+    Samp_SDK::Detail::Benchmark_Aligned_Free(ptr);
+}
+
+int main(int argc, char** argv) {
+    return Samp_SDK::Testing::Benchmark_Registry::Instance().Main(argc, argv);
+}
+#endif
+
+#define SAMP_SDK_BENCHMARK(name) \
+    static void Benchmark_##name(uint64_t iterations); \
+    namespace { \
+        Samp_SDK::Testing::Benchmark_Register register_benchmark_##name(#name, &Benchmark_##name); \
+    } \
+    static void Benchmark_##name(uint64_t iterations)
@@ -0,0 +1,422 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+//
+#include "../amx/amx_defs.h"
+#include "../utils/samp_defs.hpp"
+#include "mock_host.hpp"
+
+namespace Samp_SDK {
+    namespace Testing {
+        enum class Load_Callback : size_t {
+            Player_Update,
+            Key_State_Change,
+            Weapon_Shot,
+            Take_Damage,
+            Give_Damage,
+            State_Change,
+            Player_Text,
+            Command_Text,
+            Count
+        };
+
+        constexpr size_t LOAD_CALLBACK_COUNT = static_cast<size_t>(Load_Callback::Count);
+
+        constexpr const char* LOAD_CALLBACK_NAMES[LOAD_CALLBACK_COUNT] = {
+            "OnPlayerUpdate",
+            "OnPlayerKeyStateChange",
+            "OnPlayerWeaponShot",
+            "OnPlayerTakeDamage",
+            "OnPlayerGiveDamage",
+            "OnPlayerStateChange",
+            "OnPlayerText",
+            "OnPlayerCommandText"
+        };
+
+        struct Load_Profile {
+            int players = MAX_PLAYERS;
+            uint64_t ticks = 2000;
+            std::chrono::microseconds tick_interval{5000};
+            bool realtime = false;
+            bool connect_players = true;
+            uint32_t seed = 1;
+            std::array<double, LOAD_CALLBACK_COUNT> rates = {30.0, 2.0, 1.0, 0.3, 0.3, 0.05, 0.05, 0.02};
+            std::vector<std::string> commands = {"/help", "/stats", "/tp 1", "/v 411", "/kill", "/pm 12 hello there", "/weather 10"};
+            std::vector<std::string> messages = {"hi", "lol", "anyone up for a race?", "where is the bank", "gg"};
+
+            void Set_Rate(Load_Callback callback, double per_player_per_second) {
+                rates[static_cast<size_t>(callback)] = per_player_per_second;
+            }
+        };
+
+        struct Load_Callback_Stats {
+            const char* name = "";
+            uint64_t calls = 0;
+            uint64_t errors = 0;
+            double total_ns = 0.0;
+            double max_ns = 0.0;
+
+            [[nodiscard]] double Mean_Ns() const {
+                return calls ? total_ns / static_cast<double>(calls) : 0.0;
+            }
+        };
+
+        struct Load_Report {
+            int players = 0;
+            uint64_t ticks = 0;
+            uint64_t overrun_ticks = 0;
+            uint64_t callbacks = 0;
+            double wall_seconds = 0.0;
+            double busy_seconds = 0.0;
+            double tick_p50_us = 0.0;
+            double tick_p90_us = 0.0;
+            double tick_p99_us = 0.0;
+            double tick_p999_us = 0.0;
+            double tick_max_us = 0.0;
+            std::vector<Load_Callback_Stats> stats;
+
+            [[nodiscard]] double Callbacks_Per_Second() const {
+                return busy_seconds > 0.0 ? static_cast<double>(callbacks) / busy_seconds : 0.0;
+            }
+
+            void Print() const {
+                std::printf("players: %d, ticks: %llu (%llu overran the tick interval), wall time: %.2f s, busy time: %.2f s\n", players,
+                    static_cast<unsigned long long>(ticks), static_cast<unsigned long long>(overrun_ticks), wall_seconds, busy_seconds);
+                std::printf("callbacks: %llu, throughput: %.0f callbacks/s\n", static_cast<unsigned long long>(callbacks), Callbacks_Per_Second());
+                std::printf("tick time (us): p50 %.1f, p90 %.1f, p99 %.1f, p99.9 %.1f, max %.1f\n\n", tick_p50_us, tick_p90_us, tick_p99_us, tick_p999_us, tick_max_us);
+                std::printf("%-26s %12s %8s %12s %12s %8s\n", "callback", "calls", "errors", "mean ns", "max ns", "share");
+
+                double total = 0.0;
+
+                for (const auto& entry : stats)
+                    total += entry.total_ns;
+
+                for (const auto& entry : stats) {
+                    std::printf("%-26s %12llu %8llu %12.1f %12.1f %7.1f%%\n", entry.name, static_cast<unsigned long long>(entry.calls),
+                        static_cast<unsigned long long>(entry.errors), entry.Mean_Ns(), entry.max_ns, total > 0.0 ? entry.total_ns * 100.0 / total : 0.0);
+                }
+            }
+        };
+
+        class Load_Generator {
+            public:
+                Load_Generator(AMX* amx, Load_Profile profile = Load_Profile()) : amx_(amx), profile_(std::move(profile)), rng_(profile_.seed) {}
+
+                static Mock_Script Make_Script(Mock_Script script = Mock_Script()) {
+                    auto add = [&script](const char* name) {
+                        auto it = std::find_if(script.publics.begin(), script.publics.end(), [name](const auto& entry) { return entry.first == name; });
+
+                        if (it == script.publics.end())
+                            script.publics.push_back({name, [](AMX*, cell*) { return static_cast<cell>(1); }});
+                    };
+
+                    for (const char* name : LOAD_CALLBACK_NAMES)
+                        add(name);
+
+                    add("OnPlayerConnect");
+                    add("OnPlayerDisconnect");
+
+                    return script;
+                }
+
+                Load_Report Run() {
+                    using Clock = std::chrono::steady_clock;
+
+                    Mock_Host& host = Mock_Host::Instance();
+                    Load_Report report;
+                    std::vector<double> tick_ns;
+                    std::vector<std::pair<Load_Callback, int>> events;
+                    std::array<double, LOAD_CALLBACK_COUNT> pending{};
+                    double interval_seconds = std::chrono::duration<double>(profile_.tick_interval).count();
+
+                    stats_.assign(LOAD_CALLBACK_COUNT + 3, Load_Callback_Stats());
+
+                    for (size_t i = 0; i < LOAD_CALLBACK_COUNT; ++i)
+                        stats_[i].name = LOAD_CALLBACK_NAMES[i];
+
+                    stats_[CONNECT_STATS].name = "OnPlayerConnect";
+                    stats_[DISCONNECT_STATS].name = "OnPlayerDisconnect";
+                    stats_[TICK_STATS].name = "ProcessTick";
+
+                    players_.assign(static_cast<size_t>(std::max(profile_.players, 0)), Player_State());
+                    report.players = static_cast<int>(players_.size());
+                    tick_ns.reserve(static_cast<size_t>(profile_.ticks));
+
+                    if (profile_.connect_players) {
+                        for (int playerid = 0; playerid < report.players; ++playerid)
+                            Timed(CONNECT_STATS, [&] { return host.Call_Public(amx_, "OnPlayerConnect", playerid); });
+                    }
+
+                    auto run_start = Clock::now();
+                    auto next_tick = run_start;
+
+                    for (uint64_t tick = 0; tick < profile_.ticks && !players_.empty(); ++tick) {
+                        auto tick_start = Clock::now();
+                        events.clear();
+
+                        for (size_t i = 0; i < LOAD_CALLBACK_COUNT; ++i) {
+                            pending[i] += profile_.rates[i] * static_cast<double>(players_.size()) * interval_seconds;
+
+                            for (; pending[i] >= 1.0; pending[i] -= 1.0)
+                                events.push_back({static_cast<Load_Callback>(i), Random_Player()});
+                        }
+
+                        std::shuffle(events.begin(), events.end(), rng_);
+
+                        for (const auto& event : events)
+                            Dispatch(event.first, event.second);
+
+                        Timed(TICK_STATS, [&] { host.Process_Tick(); return Mock_Call_Result(); });
+
+                        double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - tick_start).count();
+                        tick_ns.push_back(elapsed);
+                        report.callbacks += events.size();
+                        report.busy_seconds += elapsed / 1e9;
+
+                        if (elapsed > interval_seconds * 1e9)
+                            ++report.overrun_ticks;
+
+                        if (profile_.realtime) {
+                            next_tick += profile_.tick_interval;
+                            std::this_thread::sleep_until(next_tick);
+                        }
+                    }
+
+                    report.wall_seconds = std::chrono::duration<double>(Clock::now() - run_start).count();
+
+                    if (profile_.connect_players) {
+                        for (int playerid = 0; playerid < report.players; ++playerid)
+                            Timed(DISCONNECT_STATS, [&] { return host.Call_Public(amx_, "OnPlayerDisconnect", playerid, 1); });
+                    }
+
+                    report.ticks = tick_ns.size();
+
+                    if (!tick_ns.empty()) {
+                        std::sort(tick_ns.begin(), tick_ns.end());
+
+                        auto percentile = [&tick_ns](double p) {
+                            size_t index = static_cast<size_t>(p * static_cast<double>(tick_ns.size() - 1) + 0.5);
+
+                            return tick_ns[std::min(index, tick_ns.size() - 1)] / 1000.0;
+                        };
+
+                        report.tick_p50_us = percentile(0.50);
+                        report.tick_p90_us = percentile(0.90);
+                        report.tick_p99_us = percentile(0.99);
+                        report.tick_p999_us = percentile(0.999);
+                        report.tick_max_us = tick_ns.back() / 1000.0;
+                    }
+
+                    report.stats = stats_;
+
+                    return report;
+                }
+
+                static int Main(int argc, char** argv) {
+                    Load_Profile profile;
+                    std::string plugin_path;
+                    std::string amx_path;
+
+                    for (int i = 1; i < argc; ++i) {
+                        std::string arg = argv[i];
+                        auto value = [&arg](const char* prefix) { return arg.compare(0, std::strlen(prefix), prefix) == 0 ? arg.substr(std::strlen(prefix)) : std::string(); };
+                        bool handled = true;
+
+                        if (!value("--plugin=").empty())
+                            plugin_path = value("--plugin=");
+                        else if (!value("--amx=").empty())
+                            amx_path = value("--amx=");
+                        else if (!value("--players=").empty())
+                            profile.players = std::atoi(value("--players=").c_str());
+                        else if (!value("--ticks=").empty())
+                            profile.ticks = std::strtoull(value("--ticks=").c_str(), nullptr, 10);
+                        else if (!value("--tick-us=").empty())
+                            profile.tick_interval = std::chrono::microseconds(std::atoi(value("--tick-us=").c_str()));
+                        else if (!value("--seed=").empty())
+                            profile.seed = static_cast<uint32_t>(std::strtoul(value("--seed=").c_str(), nullptr, 10));
+                        else if (arg == "--realtime")
+                            profile.realtime = true;
+                        else {
+                            handled = false;
+
+                            for (size_t c = 0; c < LOAD_CALLBACK_COUNT && !handled; ++c) {
+                                std::string prefix = std::string("--rate-") + LOAD_CALLBACK_NAMES[c] + "=";
+
+                                if (arg.compare(0, prefix.size(), prefix) == 0)
+                                    profile.rates[c] = std::atof(arg.c_str() + prefix.size()), handled = true;
+                            }
+                        }
+
+                        if (!handled) {
+                            std::printf("Usage: %s --plugin=file [--amx=file] [--players=n] [--ticks=n] [--tick-us=n] [--seed=n] [--realtime] [--rate-<Callback>=per player per second]\n", argv[0]);
+
+                            return 2;
+                        }
+                    }
+
+                    Mock_Host& host = Mock_Host::Instance();
+
+                    if (plugin_path.empty() || !host.Load_Plugin(plugin_path)) {
+                        std::printf("Could not load plugin '%s'.\n", plugin_path.c_str());
+
+                        return 1;
+                    }
+
+                    AMX* amx = amx_path.empty() ? host.Create_Amx(Make_Script()) : host.Load_Amx(amx_path);
+
+                    if (amx && !amx_path.empty())
+                        host.Register_Native_Stubs(amx);
+
+                    int error = amx ? host.Exec_Main(amx) : static_cast<int>(Amx_Error::Init);
+
+                    if (error != static_cast<int>(Amx_Error::None) && error != static_cast<int>(Amx_Error::Index)) {
+                        std::printf("Could not %s.\n", amx_path.empty() ? "create the stand-in script" : ("run '" + amx_path + "'").c_str());
+                        host.Shutdown();
+
+                        return 1;
+                    }
+
+                    Load_Report report = Load_Generator(amx, profile).Run();
+                    report.Print();
+                    host.Shutdown();
+
+                    return 0;
+                }
+
+            private:
+                static constexpr size_t CONNECT_STATS = LOAD_CALLBACK_COUNT;
+                static constexpr size_t DISCONNECT_STATS = LOAD_CALLBACK_COUNT + 1;
+                static constexpr size_t TICK_STATS = LOAD_CALLBACK_COUNT + 2;
+
+                struct Player_State {
+                    int keys = 0;
+                    int state = PLAYER_STATE_ONFOOT;
+                };
+
+                int Random_Player() {
+                    return static_cast<int>(rng_() % players_.size());
+                }
+
+                int Random(int min, int max) {
+                    return min + static_cast<int>(rng_() % static_cast<uint32_t>(max - min + 1));
+                }
+
+                float Random_Float(float min, float max) {
+                    return min + (max - min) * static_cast<float>(rng_() & 0xFFFFFF) / static_cast<float>(0xFFFFFF);
+                }
+
+                template<typename Func>
+                void Timed(size_t slot, Func&& func) {
+                    auto start = std::chrono::steady_clock::now();
+                    Mock_Call_Result result = func();
+                    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+                    Load_Callback_Stats& entry = stats_[slot];
+
+                    ++entry.calls;
+                    entry.total_ns += elapsed;
+                    entry.max_ns = std::max(entry.max_ns, elapsed);
+
+                    if (!result.Ok())
+                        ++entry.errors;
+                }
+
+                void Dispatch(Load_Callback callback, int playerid) {
+                    Mock_Host& host = Mock_Host::Instance();
+                    Player_State& player = players_[static_cast<size_t>(playerid)];
+                    size_t slot = static_cast<size_t>(callback);
+                    const char* name = LOAD_CALLBACK_NAMES[slot];
+
+                    switch (callback) {
+                        case Load_Callback::Player_Update:
+                            Timed(slot, [&] { return host.Call_Public(amx_, name, playerid); });
+                            break;
+                        case Load_Callback::Key_State_Change: {
+                            int old_keys = player.keys;
+                            player.keys = static_cast<int>(rng_() & (KEY_ACTION | KEY_CROUCH | KEY_FIRE | KEY_SPRINT | KEY_JUMP | KEY_SECONDARY_ATTACK));
+                            Timed(slot, [&] { return host.Call_Public(amx_, name, playerid, player.keys, old_keys); });
+                            break;
+                        }
+                        case Load_Callback::Weapon_Shot:
+                            Timed(slot, [&] { return host.Call_Public(amx_, name, playerid, Random(WEAPON_COLT45, WEAPON_SNIPER), Random(BULLET_HIT_TYPE_NONE, BULLET_HIT_TYPE_PLAYER), Random_Player(),
+                                Random_Float(-1.0f, 1.0f), Random_Float(-1.0f, 1.0f), Random_Float(-1.0f, 1.0f)); });
+                            break;
+                        case Load_Callback::Take_Damage:
+                        case Load_Callback::Give_Damage:
+                            Timed(slot, [&] { return host.Call_Public(amx_, name, playerid, Random_Player(), Random_Float(5.0f, 46.2f), Random(WEAPON_COLT45, WEAPON_SNIPER), Random(3, 9)); });
+                            break;
+                        case Load_Callback::State_Change: {
+                            int old_state = player.state;
+                            player.state = old_state == PLAYER_STATE_ONFOOT ? PLAYER_STATE_DRIVER : PLAYER_STATE_ONFOOT;
+                            Timed(slot, [&] { return host.Call_Public(amx_, name, playerid, player.state, old_state); });
+                            break;
+                        }
+                        case Load_Callback::Player_Text:
+                            if (!profile_.messages.empty())
+                                Timed(slot, [&] { return host.Call_Public(amx_, name, playerid, profile_.messages[rng_() % profile_.messages.size()].c_str()); });
+                            break;
+                        case Load_Callback::Command_Text:
+                            if (!profile_.commands.empty())
+                                Timed(slot, [&] { return host.Call_Public(amx_, name, playerid, profile_.commands[rng_() % profile_.commands.size()].c_str()); });
+                            break;
+                        default:
+                            break;
+                    }
+                }
+
+                AMX* amx_;
+                Load_Profile profile_;
+                std::mt19937 rng_;
+                std::vector<Player_State> players_;
+                std::vector<Load_Callback_Stats> stats_;
+        };
+    }
+}
+
+#if defined(SAMP_SDK_LOAD_TEST_MAIN)
+int main(int argc, char** argv) {
+    return Samp_SDK::Testing::Load_Generator::Main(argc, argv);
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,1323 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+//
+#include "../amx/amx_api.hpp"
+#include "../amx/amx_defs.h"
+#include "../core/platform.hpp"
+#include "../core/plugin_defs.h"
+#include "../modules/dynamic_library.hpp"
+#include "amx_interpreter.hpp"
+
+namespace Samp_SDK {
+    namespace Testing {
+        using Mock_Public = std::function<cell(AMX* amx, cell* params)>;
+
+        struct Mock_Script {
+            std::vector<std::pair<std::string, Mock_Public>> publics;
+            std::vector<std::string> natives;
+            std::vector<std::pair<std::string, cell>> pub_vars;
+            Mock_Public main;
+            size_t data_cells = 0;
+            size_t stack_heap_cells = 16384;
+        };
+
+        struct Mock_Ref {
+            cell& value;
+        };
+
+        struct Mock_Call_Result {
+            int error = static_cast<int>(Amx_Error::None);
+            cell value = 0;
+
+            [[nodiscard]] bool Ok() const {
+                return error == static_cast<int>(Amx_Error::None);
+            }
+        };
+
+        struct Mock_Plugin_Exports {
+            using Supports_t = unsigned int (SAMP_SDK_CALL *)();
+            using Load_t = bool (SAMP_SDK_CALL *)(void** ppData);
+            using Unload_t = void (SAMP_SDK_CALL *)();
+            using Amx_Load_t = void (SAMP_SDK_CALL *)(AMX* amx);
+            using Amx_Unload_t = void (SAMP_SDK_CALL *)(AMX* amx);
+            using Process_Tick_t = void (SAMP_SDK_CALL *)();
+
+            Supports_t supports = nullptr;
+            Load_t load = nullptr;
+            Unload_t unload = nullptr;
+            Amx_Load_t amx_load = nullptr;
+            Amx_Unload_t amx_unload = nullptr;
+            Process_Tick_t process_tick = nullptr;
+        };
+    }
+
+    namespace Detail {
+        constexpr int MOCK_STACK_MARGIN = 16 * sizeof(cell);
+        constexpr cell MOCK_STAND_IN_TAG = 0x4B434F4D;
+        constexpr ucell MOCK_UNPACKED_MAX = (static_cast<ucell>(1) << ((sizeof(cell) - 1) * 8)) - 1;
+
+        struct Mock_Script_Runtime {
+            std::vector<Testing::Mock_Public> publics;
+            Testing::Mock_Public main;
+        };
+
+        SAMP_SDK_FORCE_INLINE AMX_HEADER* Mock_Header(AMX* amx) {
+            return reinterpret_cast<AMX_HEADER*>(amx->base);
+        }
+
+        SAMP_SDK_FORCE_INLINE unsigned char* Mock_Data(AMX* amx) {
+            return amx->data ? amx->data : amx->base + Mock_Header(amx)->dat;
+        }
+
+        SAMP_SDK_FORCE_INLINE AMX_FUNCSTUBNT* Mock_Table(AMX* amx, int32_t offset) {
+            return reinterpret_cast<AMX_FUNCSTUBNT*>(amx->base + offset);
+        }
+
+        SAMP_SDK_FORCE_INLINE int Mock_Table_Count(AMX* amx, int32_t begin, int32_t end) {
+            return (end - begin) / Mock_Header(amx)->defsize;
+        }
+
+        SAMP_SDK_FORCE_INLINE const char* Mock_Name(AMX* amx, const AMX_FUNCSTUBNT& entry) {
+            return reinterpret_cast<const char*>(amx->base + entry.nameofs);
+        }
+
+        SAMP_SDK_FORCE_INLINE bool Mock_Is_Stand_In(const AMX_HEADER* hdr) {
+            cell tag = 0;
+
+            if ((hdr->flags & AMX_FLAG_COMPACT) == 0 && hdr->dat - hdr->cod >= static_cast<int32_t>(sizeof(cell)))
+                std::memcpy(&tag, reinterpret_cast<const unsigned char*>(hdr) + hdr->cod, sizeof(tag));
+
+            return tag == MOCK_STAND_IN_TAG;
+        }
+
+        SAMP_SDK_FORCE_INLINE Mock_Script_Runtime* Mock_Runtime(AMX* amx) {
+            Mock_Script_Runtime* runtime;
+            std::memcpy(&runtime, amx->base + Mock_Header(amx)->cod + sizeof(cell), sizeof(runtime));
+
+            return runtime;
+        }
+
+        inline int Mock_Find_In_Table(AMX* amx, int32_t begin, int32_t end, const char* name, int* index) {
+            int count = Mock_Table_Count(amx, begin, end);
+            AMX_FUNCSTUBNT* table = Mock_Table(amx, begin);
+            int low = 0, high = count - 1;
+
+            while (low <= high) {
+                int mid = (low + high) / 2;
+                int cmp = std::strcmp(Mock_Name(amx, table[mid]), name);
+
+                if (cmp == 0)
+                    return (*index = mid, static_cast<int>(Amx_Error::None));
+
+                if (cmp < 0)
+                    low = mid + 1;
+                else
+                    high = mid - 1;
+            }
+
+            for (int i = 0; i < count; ++i) {
+                if (std::strcmp(Mock_Name(amx, table[i]), name) == 0)
+                    return (*index = i, static_cast<int>(Amx_Error::None));
+            }
+
+            *index = 0x7FFFFFFF;
+
+            return static_cast<int>(Amx_Error::NotFound);
+        }
+
+        inline uint16_t* SAMP_SDK_CDECL Mock_Amx_Align16(uint16_t* v) {
+            return v;
+        }
+
+        inline uint32_t* SAMP_SDK_CDECL Mock_Amx_Align32(uint32_t* v) {
+            return v;
+        }
+
+        inline uint64_t* SAMP_SDK_CDECL Mock_Amx_Align64(uint64_t* v) {
+            return v;
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Allot(AMX* amx, int cells, cell* amx_addr, cell** phys_addr) {
+            if (cells < 0 || amx->stk - amx->hea - cells * static_cast<cell>(sizeof(cell)) < MOCK_STACK_MARGIN)
+                return static_cast<int>(Amx_Error::Memory);
+
+            if (amx_addr)
+                *amx_addr = amx->hea;
+
+            if (phys_addr)
+                *phys_addr = reinterpret_cast<cell*>(Mock_Data(amx) + amx->hea);
+
+            amx->hea += cells * static_cast<cell>(sizeof(cell));
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Callback(AMX* amx, cell index, cell* result, cell* params) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+
+            if (index < 0 || index >= Mock_Table_Count(amx, hdr->natives, hdr->libraries))
+                return static_cast<int>(Amx_Error::Index);
+
+            AMX_NATIVE func = reinterpret_cast<AMX_NATIVE>(Mock_Table(amx, hdr->natives)[index].address);
+
+            if (!func)
+                return static_cast<int>(Amx_Error::NotFound);
+
+            amx->error = static_cast<int>(Amx_Error::None);
+            *result = func(amx, params);
+
+            return amx->error;
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Cleanup(AMX* amx) {
+            if (!amx || !amx->base)
+                return static_cast<int>(Amx_Error::Params);
+
+            amx->callback = nullptr;
+            amx->debug = nullptr;
+            amx->flags &= ~AMX_FLAG_NTVREG;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Clone(AMX* amxClone, AMX* amxSource, void* data) {
+            if (!amxClone || !amxSource || !data || !amxSource->base)
+                return static_cast<int>(Amx_Error::Params);
+
+            AMX_HEADER* hdr = Mock_Header(amxSource);
+
+            std::memset(amxClone, 0, sizeof(AMX));
+            amxClone->base = amxSource->base;
+            amxClone->data = static_cast<unsigned char*>(data);
+            amxClone->callback = amxSource->callback;
+            amxClone->debug = amxSource->debug;
+            amxClone->flags = amxSource->flags;
+            amxClone->hea = hdr->hea - hdr->dat;
+            amxClone->hlw = amxClone->hea;
+            amxClone->stp = hdr->stp - hdr->dat - static_cast<cell>(sizeof(cell));
+            amxClone->stk = amxClone->stp;
+            amxClone->reset_stk = amxClone->stk;
+            amxClone->reset_hea = amxClone->hea;
+
+            std::memcpy(data, Mock_Data(amxSource), static_cast<size_t>(hdr->hea - hdr->dat));
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Exec(AMX* amx, cell* retval, int index) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+
+            if (!Mock_Is_Stand_In(hdr))
+                return Amx_Interpreter_Exec(amx, retval, index);
+
+            Mock_Script_Runtime* runtime = Mock_Runtime(amx);
+            const Testing::Mock_Public* handler = nullptr;
+            cell paramcount = amx->paramcount;
+
+            amx->paramcount = 0;
+
+            if (index == AMX_EXEC_MAIN)
+                handler = runtime->main ? &runtime->main : nullptr;
+            else if (index >= 0 && index < Mock_Table_Count(amx, hdr->publics, hdr->natives))
+                handler = &runtime->publics[Mock_Table(amx, hdr->publics)[index].address];
+
+            if (!handler || !*handler) {
+                amx->stk += paramcount * static_cast<cell>(sizeof(cell));
+
+                return static_cast<int>(index == AMX_EXEC_MAIN ? Amx_Error::Index : Amx_Error::NotFound);
+            }
+
+            if (amx->stk - static_cast<cell>(sizeof(cell)) < amx->hea + MOCK_STACK_MARGIN) {
+                amx->stk += paramcount * static_cast<cell>(sizeof(cell));
+
+                return static_cast<int>(Amx_Error::StackErr);
+            }
+
+            unsigned char* data = Mock_Data(amx);
+            cell saved_cip = amx->cip;
+
+            amx->stk -= sizeof(cell);
+            *reinterpret_cast<cell*>(data + amx->stk) = paramcount * static_cast<cell>(sizeof(cell));
+            amx->error = static_cast<int>(Amx_Error::None);
+            amx->cip = index;
+
+            cell result = (*handler)(amx, reinterpret_cast<cell*>(data + amx->stk));
+
+            amx->cip = saved_cip;
+            amx->stk += (paramcount + 1) * static_cast<cell>(sizeof(cell));
+
+            if (retval)
+                *retval = result;
+
+            return amx->error;
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Find_Native(AMX* amx, const char* name, int* index) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+
+            return Mock_Find_In_Table(amx, hdr->natives, hdr->libraries, name, index);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Find_Public(AMX* amx, const char* funcname, int* index) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+
+            return Mock_Find_In_Table(amx, hdr->publics, hdr->natives, funcname, index);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Find_Pub_Var(AMX* amx, const char* varname, cell* amx_addr) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+            int index;
+            int error = Mock_Find_In_Table(amx, hdr->pubvars, hdr->tags, varname, &index);
+
+            if (error == static_cast<int>(Amx_Error::None))
+                *amx_addr = static_cast<cell>(Mock_Table(amx, hdr->pubvars)[index].address);
+
+            return error;
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Find_Tag_Id(AMX* amx, cell tag_id, char* tagname) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+            int count = Mock_Table_Count(amx, hdr->tags, hdr->nametable);
+            AMX_FUNCSTUBNT* tags = Mock_Table(amx, hdr->tags);
+
+            for (int i = 0; i < count; ++i) {
+                if (static_cast<cell>(tags[i].address) == tag_id)
+                    return (std::strcpy(tagname, Mock_Name(amx, tags[i])), static_cast<int>(Amx_Error::None));
+            }
+
+            *tagname = '\0';
+
+            return static_cast<int>(Amx_Error::NotFound);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Flags(AMX* amx, uint16_t* flags) {
+            if (!amx || !amx->base)
+                return (*flags = 0, static_cast<int>(Amx_Error::InvState));
+
+            *flags = static_cast<uint16_t>(Mock_Header(amx)->flags);
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Get_Addr(AMX* amx, cell amx_addr, cell** phys_addr) {
+            if (amx_addr < 0 || amx_addr >= amx->stp || (amx_addr >= amx->hea && amx_addr < amx->stk))
+                return (*phys_addr = nullptr, static_cast<int>(Amx_Error::MemAccess));
+
+            *phys_addr = reinterpret_cast<cell*>(Mock_Data(amx) + amx_addr);
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Get_Native(AMX* amx, int index, char* funcname) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+
+            if (index < 0 || index >= Mock_Table_Count(amx, hdr->natives, hdr->libraries))
+                return static_cast<int>(Amx_Error::Index);
+
+            std::strcpy(funcname, Mock_Name(amx, Mock_Table(amx, hdr->natives)[index]));
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Get_Public(AMX* amx, int index, char* funcname) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+
+            if (index < 0 || index >= Mock_Table_Count(amx, hdr->publics, hdr->natives))
+                return static_cast<int>(Amx_Error::Index);
+
+            std::strcpy(funcname, Mock_Name(amx, Mock_Table(amx, hdr->publics)[index]));
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Get_Pub_Var(AMX* amx, int index, char* varname, cell* amx_addr) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+
+            if (index < 0 || index >= Mock_Table_Count(amx, hdr->pubvars, hdr->tags))
+                return static_cast<int>(Amx_Error::Index);
+
+            AMX_FUNCSTUBNT& entry = Mock_Table(amx, hdr->pubvars)[index];
+            std::strcpy(varname, Mock_Name(amx, entry));
+            *amx_addr = static_cast<cell>(entry.address);
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Get_String(char* dest, const cell* source, int use_wchar, size_t size) {
+            size_t length = 0;
+
+            (void)use_wchar;
+
+            if (size == 0)
+                return static_cast<int>(Amx_Error::None);
+
+            if (static_cast<ucell>(*source) > MOCK_UNPACKED_MAX) {
+                for (size_t i = 0; length + 1 < size; ++i) {
+                    char c = static_cast<char>(static_cast<ucell>(source[i / sizeof(cell)]) >> ((sizeof(cell) - 1 - i % sizeof(cell)) * 8));
+
+                    if (c == '\0')
+                        break;
+
+                    dest[length++] = c;
+                }
+            }
+            else {
+                while (source[length] != 0 && length + 1 < size) {
+                    dest[length] = static_cast<char>(source[length]);
+                    ++length;
+                }
+            }
+
+            dest[length] = '\0';
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Get_Tag(AMX* amx, int index, char* tagname, cell* tag_id) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+
+            if (index < 0 || index >= Mock_Table_Count(amx, hdr->tags, hdr->nametable))
+                return (*tagname = '\0', *tag_id = 0, static_cast<int>(Amx_Error::Index));
+
+            AMX_FUNCSTUBNT& entry = Mock_Table(amx, hdr->tags)[index];
+            std::strcpy(tagname, Mock_Name(amx, entry));
+            *tag_id = static_cast<cell>(entry.address);
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Get_User_Data(AMX* amx, long tag, void** ptr) {
+            for (int i = 0; i < 4; ++i) {
+                if (amx->usertags[i] == tag)
+                    return (*ptr = amx->userdata[i], static_cast<int>(Amx_Error::None));
+            }
+
+            *ptr = nullptr;
+
+            return static_cast<int>(Amx_Error::UserData);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Init(AMX* amx, void* program) {
+            AMX_HEADER* hdr = static_cast<AMX_HEADER*>(program);
+
+            if (!amx || !hdr)
+                return static_cast<int>(Amx_Error::Params);
+
+            if (hdr->magic != AMX_MAGIC || hdr->defsize != sizeof(AMX_FUNCSTUBNT))
+                return static_cast<int>(Amx_Error::Format);
+
+            if (!Mock_Is_Stand_In(hdr)) {
+                int error = Amx_Interpreter_Prepare(hdr);
+
+                if (error != static_cast<int>(Amx_Error::None))
+                    return error;
+            }
+
+            std::memset(amx, 0, sizeof(AMX));
+            amx->base = static_cast<unsigned char*>(program);
+            amx->callback = Mock_Amx_Callback;
+            amx->flags = hdr->flags;
+            amx->hea = hdr->hea - hdr->dat;
+            amx->hlw = amx->hea;
+            amx->stp = hdr->stp - hdr->dat - static_cast<cell>(sizeof(cell));
+            amx->stk = amx->stp;
+            amx->reset_stk = amx->stk;
+            amx->reset_hea = amx->hea;
+
+            if (Mock_Table_Count(amx, hdr->natives, hdr->libraries) == 0)
+                amx->flags |= AMX_FLAG_NTVREG;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Init_JIT(AMX* amx, void* reloc_table, void* native_code) {
+            (void)reloc_table;
+            (void)native_code;
+
+            if (amx)
+                amx->error = static_cast<int>(Amx_Error::InitJit);
+
+            return static_cast<int>(Amx_Error::InitJit);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Mem_Info(AMX* amx, long* codesize, long* datasize, long* stackheap) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+
+            if (codesize)
+                *codesize = hdr->dat - hdr->cod;
+
+            if (datasize)
+                *datasize = hdr->hea - hdr->dat;
+
+            if (stackheap)
+                *stackheap = hdr->stp - hdr->hea;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Name_Length(AMX* amx, int* length) {
+            uint16_t value;
+            std::memcpy(&value, amx->base + Mock_Header(amx)->nametable, sizeof(value));
+            *length = value;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline AMX_NATIVE_INFO* SAMP_SDK_CDECL Mock_Amx_Native_Info(const char* name, AMX_NATIVE func) {
+            static thread_local AMX_NATIVE_INFO info;
+
+            info.name = name;
+            info.func = func;
+
+            return &info;
+        }
+
+        inline cell SAMP_SDK_CDECL Mock_Native_Stub(AMX* amx, cell* params) {
+            (void)amx;
+            (void)params;
+
+            return 0;
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Num_Natives(AMX* amx, int* number) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+            *number = Mock_Table_Count(amx, hdr->natives, hdr->libraries);
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Num_Publics(AMX* amx, int* number) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+            *number = Mock_Table_Count(amx, hdr->publics, hdr->natives);
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Num_Pub_Vars(AMX* amx, int* number) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+            *number = Mock_Table_Count(amx, hdr->pubvars, hdr->tags);
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Num_Tags(AMX* amx, int* number) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+            *number = Mock_Table_Count(amx, hdr->tags, hdr->nametable);
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Push(AMX* amx, cell value) {
+            if (amx->stk - static_cast<cell>(sizeof(cell)) < amx->hea + MOCK_STACK_MARGIN)
+                return static_cast<int>(Amx_Error::StackErr);
+
+            amx->stk -= sizeof(cell);
+            *reinterpret_cast<cell*>(Mock_Data(amx) + amx->stk) = value;
+            amx->paramcount++;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Push_Array(AMX* amx, cell* amx_addr, cell** phys_addr, const cell array[], int numcells) {
+            cell address;
+            cell* physical;
+            int error = Mock_Amx_Allot(amx, numcells, &address, &physical);
+
+            if (error != static_cast<int>(Amx_Error::None))
+                return error;
+
+            if (array)
+                std::memcpy(physical, array, static_cast<size_t>(numcells) * sizeof(cell));
+
+            if (amx_addr)
+                *amx_addr = address;
+
+            if (phys_addr)
+                *phys_addr = physical;
+
+            return Mock_Amx_Push(amx, address);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Set_String(cell* dest, const char* source, int pack, int use_wchar, size_t size) {
+            size_t length = std::strlen(source);
+
+            (void)use_wchar;
+
+            if (pack) {
+                if (length >= size * sizeof(cell))
+                    length = size * sizeof(cell) - 1;
+
+                std::memset(dest, 0, (length / sizeof(cell) + 1) * sizeof(cell));
+
+                for (size_t i = 0; i < length; ++i)
+                    dest[i / sizeof(cell)] |= static_cast<cell>(static_cast<ucell>(static_cast<unsigned char>(source[i])) << ((sizeof(cell) - 1 - i % sizeof(cell)) * 8));
+            }
+            else {
+                if (length >= size)
+                    length = size - 1;
+
+                for (size_t i = 0; i < length; ++i)
+                    dest[i] = static_cast<cell>(source[i]);
+
+                dest[length] = 0;
+            }
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Push_String(AMX* amx, cell* amx_addr, cell** phys_addr, const char* string, int pack, int use_wchar) {
+            size_t length = std::strlen(string);
+            int numcells = static_cast<int>(pack ? (length + sizeof(cell)) / sizeof(cell) : length + 1);
+            cell address;
+            cell* physical;
+            int error = Mock_Amx_Allot(amx, numcells, &address, &physical);
+
+            if (error != static_cast<int>(Amx_Error::None))
+                return error;
+
+            Mock_Amx_Set_String(physical, string, pack, use_wchar, static_cast<size_t>(numcells));
+
+            if (amx_addr)
+                *amx_addr = address;
+
+            if (phys_addr)
+                *phys_addr = physical;
+
+            return Mock_Amx_Push(amx, address);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Raise_Error(AMX* amx, int error) {
+            if (error != static_cast<int>(Amx_Error::None))
+                amx->error = error;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Register(AMX* amx, const AMX_NATIVE_INFO* nativelist, int number) {
+            AMX_HEADER* hdr = Mock_Header(amx);
+            int count = Mock_Table_Count(amx, hdr->natives, hdr->libraries);
+            AMX_FUNCSTUBNT* natives = Mock_Table(amx, hdr->natives);
+            int error = static_cast<int>(Amx_Error::None);
+
+            for (int i = 0; i < count; ++i) {
+                if (natives[i].address != 0)
+                    continue;
+
+                for (int j = 0; (number == -1 || j < number) && nativelist[j].name != nullptr; ++j) {
+                    if (std::strcmp(nativelist[j].name, Mock_Name(amx, natives[i])) == 0) {
+                        natives[i].address = static_cast<ucell>(reinterpret_cast<uintptr_t>(nativelist[j].func));
+
+                        break;
+                    }
+                }
+
+                if (natives[i].address == 0)
+                    error = static_cast<int>(Amx_Error::NotFound);
+            }
+
+            if (error == static_cast<int>(Amx_Error::None))
+                amx->flags |= AMX_FLAG_NTVREG;
+
+            return error;
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Release(AMX* amx, cell amx_addr) {
+            if (amx->hea > amx_addr)
+                amx->hea = amx_addr;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Set_Callback(AMX* amx, AMX_CALLBACK callback) {
+            amx->callback = callback;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Set_Debug_Hook(AMX* amx, AMX_DEBUG debug) {
+            amx->debug = debug;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Set_User_Data(AMX* amx, long tag, void* ptr) {
+            for (int i = 0; i < 4; ++i) {
+                if (amx->usertags[i] == tag || amx->usertags[i] == 0) {
+                    amx->usertags[i] = tag;
+                    amx->userdata[i] = ptr;
+
+                    return static_cast<int>(Amx_Error::None);
+                }
+            }
+
+            return static_cast<int>(Amx_Error::Memory);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_Str_Len(const cell* cstring, int* length) {
+            int count = 0;
+
+            if (static_cast<ucell>(*cstring) > MOCK_UNPACKED_MAX) {
+                while (static_cast<char>(static_cast<ucell>(cstring[count / sizeof(cell)]) >> ((sizeof(cell) - 1 - count % sizeof(cell)) * 8)) != '\0')
+                    ++count;
+            }
+            else {
+                while (cstring[count] != 0)
+                    ++count;
+            }
+
+            *length = count;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_UTF8_Get(const char* string, const char** endptr, cell* value) {
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(string);
+            int extra = (*p < 0x80) ? 0 : (*p & 0xE0) == 0xC0 ? 1 : (*p & 0xF0) == 0xE0 ? 2 : (*p & 0xF8) == 0xF0 ? 3 : -1;
+
+            if (extra < 0)
+                return (endptr ? (*endptr = string) : nullptr, static_cast<int>(Amx_Error::Format));
+
+            cell result = extra == 0 ? *p : (*p & (0x3F >> extra));
+
+            for (int i = 1; i <= extra; ++i) {
+                if ((p[i] & 0xC0) != 0x80)
+                    return (endptr ? (*endptr = string) : nullptr, static_cast<int>(Amx_Error::Format));
+
+                result = (result << 6) | (p[i] & 0x3F);
+            }
+
+            if (value)
+                *value = result;
+
+            if (endptr)
+                *endptr = string + extra + 1;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_UTF8_Check(const char* string, int* length) {
+            int count = 0;
+
+            while (*string) {
+                int error = Mock_Amx_UTF8_Get(string, &string, nullptr);
+
+                if (error != static_cast<int>(Amx_Error::None))
+                    return (length ? (*length = count) : 0, error);
+
+                ++count;
+            }
+
+            if (length)
+                *length = count;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_UTF8_Len(const cell* cstr, int* length) {
+            int count = 0;
+
+            for (; *cstr != 0; ++cstr)
+                count += (*cstr < 0x80) ? 1 : (*cstr < 0x800) ? 2 : (*cstr < 0x10000) ? 3 : 4;
+
+            *length = count;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+
+        inline int SAMP_SDK_CDECL Mock_Amx_UTF8_Put(char* string, char** endptr, int maxchars, cell value) {
+            int needed = (value < 0x80) ? 1 : (value < 0x800) ? 2 : (value < 0x10000) ? 3 : 4;
+
+            if (needed > maxchars)
+                return (endptr ? (*endptr = string) : nullptr, static_cast<int>(Amx_Error::Domain));
+
+            if (needed == 1)
+                string[0] = static_cast<char>(value);
+            else {
+                static constexpr unsigned char lead[] = {0, 0, 0xC0, 0xE0, 0xF0};
+
+                for (int i = needed - 1; i > 0; --i) {
+                    string[i] = static_cast<char>(0x80 | (value & 0x3F));
+                    value >>= 6;
+                }
+
+                string[0] = static_cast<char>(lead[needed] | value);
+            }
+
+            if (endptr)
+                *endptr = string + needed;
+
+            return static_cast<int>(Amx_Error::None);
+        }
+    }
+
+    namespace Testing {
+        class Mock_Host {
+            public:
+                static Mock_Host& Instance() {
+                    static Mock_Host instance;
+
+                    return instance;
+                }
+
+                [[nodiscard]] void** Get_Plugin_Data() {
+                    return plugin_data_;
+                }
+
+                template<typename Func>
+                [[nodiscard]] Func Get_Export(int index) const {
+                    return reinterpret_cast<Func>(amx_exports_[index]);
+                }
+
+                bool Load_Plugin(const std::string& path) {
+                    auto library = std::make_unique<Samp_SDK::Detail::Dynamic_Library>();
+
+                    if (!library->Load(path))
+                        return false;
+
+                    Mock_Plugin_Exports exports;
+                    exports.supports = library->Get_Function<Mock_Plugin_Exports::Supports_t>("Supports");
+                    exports.load = library->Get_Function<Mock_Plugin_Exports::Load_t>("Load");
+                    exports.unload = library->Get_Function<Mock_Plugin_Exports::Unload_t>("Unload");
+                    exports.amx_load = library->Get_Function<Mock_Plugin_Exports::Amx_Load_t>("AmxLoad");
+                    exports.amx_unload = library->Get_Function<Mock_Plugin_Exports::Amx_Unload_t>("AmxUnload");
+                    exports.process_tick = library->Get_Function<Mock_Plugin_Exports::Process_Tick_t>("ProcessTick");
+
+                    if (!Attach_Plugin(exports))
+                        return (library->Unload(), false);
+
+                    plugins_.back().library = std::move(library);
+
+                    return true;
+                }
+
+                bool Attach_Plugin(const Mock_Plugin_Exports& exports) {
+                    if (!exports.supports || !exports.load || !exports.unload)
+                        return false;
+
+                    unsigned int flags = exports.supports();
+
+                    if ((flags & SUPPORTS_VERSION_MASK) > SUPPORTS_VERSION || !exports.load(plugin_data_))
+                        return false;
+
+                    plugins_.push_back({exports, flags, nullptr});
+
+                    for (auto& script : scripts_) {
+                        if ((flags & SUPPORTS_AMX_NATIVES) && exports.amx_load)
+                            exports.amx_load(script.amx.get());
+                    }
+
+                    return true;
+                }
+
+                AMX* Create_Amx(const Mock_Script& script) {
+                    Script_Slot slot;
+                    slot.runtime = std::make_unique<Detail::Mock_Script_Runtime>();
+                    slot.runtime->main = script.main;
+
+                    std::vector<std::pair<std::string, Mock_Public>> publics = script.publics;
+                    std::vector<std::string> natives = script.natives;
+                    std::vector<std::pair<std::string, cell>> pub_vars = script.pub_vars;
+
+                    std::sort(publics.begin(), publics.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+                    std::sort(natives.begin(), natives.end());
+                    std::sort(pub_vars.begin(), pub_vars.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+                    size_t names_size = 0;
+                    size_t max_name = 0;
+
+                    for (const auto& entry : publics)
+                        names_size += entry.first.size() + 1, max_name = std::max(max_name, entry.first.size());
+
+                    for (const auto& entry : natives)
+                        names_size += entry.size() + 1, max_name = std::max(max_name, entry.size());
+
+                    for (const auto& entry : pub_vars)
+                        names_size += entry.first.size() + 1, max_name = std::max(max_name, entry.first.size());
+
+                    auto align = [](size_t value) { return (value + sizeof(cell) - 1) & ~(sizeof(cell) - 1); };
+                    size_t publics_offset = sizeof(AMX_HEADER);
+                    size_t natives_offset = publics_offset + publics.size() * sizeof(AMX_FUNCSTUBNT);
+                    size_t libraries_offset = natives_offset + natives.size() * sizeof(AMX_FUNCSTUBNT);
+                    size_t pubvars_offset = libraries_offset;
+                    size_t tags_offset = pubvars_offset + pub_vars.size() * sizeof(AMX_FUNCSTUBNT);
+                    size_t nametable_offset = tags_offset;
+                    size_t names_offset = nametable_offset + sizeof(uint16_t);
+                    size_t cod_offset = align(names_offset + names_size);
+                    size_t dat_offset = cod_offset + align(sizeof(cell) + sizeof(Detail::Mock_Script_Runtime*));
+                    size_t data_size = (pub_vars.size() + script.data_cells) * sizeof(cell);
+                    size_t hea_offset = dat_offset + data_size;
+                    size_t stp_offset = hea_offset + script.stack_heap_cells * sizeof(cell);
+
+                    slot.memory.reset(new cell[stp_offset / sizeof(cell)]());
+                    unsigned char* base = reinterpret_cast<unsigned char*>(slot.memory.get());
+                    AMX_HEADER* hdr = reinterpret_cast<AMX_HEADER*>(base);
+
+                    hdr->size = static_cast<int32_t>(hea_offset);
+                    hdr->magic = AMX_MAGIC;
+                    hdr->file_version = MIN_FILE_VERSION + 6;
+                    hdr->amx_version = MIN_AMX_VERSION;
+                    hdr->flags = 0;
+                    hdr->defsize = sizeof(AMX_FUNCSTUBNT);
+                    hdr->cod = static_cast<int32_t>(cod_offset);
+                    hdr->dat = static_cast<int32_t>(dat_offset);
+                    hdr->hea = static_cast<int32_t>(hea_offset);
+                    hdr->stp = static_cast<int32_t>(stp_offset);
+                    hdr->cip = -1;
+                    hdr->publics = static_cast<int32_t>(publics_offset);
+                    hdr->natives = static_cast<int32_t>(natives_offset);
+                    hdr->libraries = static_cast<int32_t>(libraries_offset);
+                    hdr->pubvars = static_cast<int32_t>(pubvars_offset);
+                    hdr->tags = static_cast<int32_t>(tags_offset);
+                    hdr->nametable = static_cast<int32_t>(nametable_offset);
+
+                    uint16_t name_length = static_cast<uint16_t>(max_name);
+                    std::memcpy(base + nametable_offset, &name_length, sizeof(name_length));
+
+                    size_t name_cursor = names_offset;
+                    auto write_entry = [&](size_t table_offset, size_t index, ucell address, const std::string& name) {
+                        AMX_FUNCSTUBNT entry{address, static_cast<uint32_t>(name_cursor)};
+                        std::memcpy(base + table_offset + index * sizeof(AMX_FUNCSTUBNT), &entry, sizeof(entry));
+                        std::memcpy(base + name_cursor, name.c_str(), name.size() + 1);
+                        name_cursor += name.size() + 1;
+                    };
+
+                    for (size_t i = 0; i < publics.size(); ++i) {
+                        slot.runtime->publics.push_back(publics[i].second);
+                        write_entry(publics_offset, i, static_cast<ucell>(i), publics[i].first);
+                    }
+
+                    for (size_t i = 0; i < natives.size(); ++i)
+                        write_entry(natives_offset, i, 0, natives[i]);
+
+                    for (size_t i = 0; i < pub_vars.size(); ++i) {
+                        std::memcpy(base + dat_offset + i * sizeof(cell), &pub_vars[i].second, sizeof(cell));
+                        write_entry(pubvars_offset, i, static_cast<ucell>(i * sizeof(cell)), pub_vars[i].first);
+                    }
+
+                    Detail::Mock_Script_Runtime* runtime = slot.runtime.get();
+                    std::memcpy(base + cod_offset, &Detail::MOCK_STAND_IN_TAG, sizeof(cell));
+                    std::memcpy(base + cod_offset + sizeof(cell), &runtime, sizeof(runtime));
+
+                    return Attach_Amx(std::move(slot));
+                }
+
+                AMX* Load_Amx(const std::string& path) {
+                    std::ifstream file(path, std::ios::binary);
+
+                    if (!file)
+                        return nullptr;
+
+                    std::vector<char> image((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+                    return Load_Amx_Image(image.data(), image.size());
+                }
+
+                AMX* Load_Amx_Image(const void* image, size_t size) {
+                    AMX_HEADER hdr;
+
+                    if (size < sizeof(hdr))
+                        return nullptr;
+
+                    std::memcpy(&hdr, image, sizeof(hdr));
+
+                    if (hdr.magic != AMX_MAGIC || hdr.size < static_cast<int32_t>(sizeof(hdr)) || static_cast<size_t>(hdr.size) > size || hdr.stp < hdr.size)
+                        return nullptr;
+
+                    Script_Slot slot;
+                    slot.memory.reset(new cell[(static_cast<size_t>(hdr.stp) + sizeof(cell) - 1) / sizeof(cell)]());
+                    std::memcpy(slot.memory.get(), image, static_cast<size_t>(hdr.size));
+
+                    return Attach_Amx(std::move(slot));
+                }
+
+                int Register_Native_Stubs(AMX* amx, AMX_NATIVE stub = Detail::Mock_Native_Stub) {
+                    AMX_HEADER* hdr = Detail::Mock_Header(amx);
+                    AMX_FUNCSTUBNT* natives = Detail::Mock_Table(amx, hdr->natives);
+                    std::vector<AMX_NATIVE_INFO> stubs;
+
+                    for (int i = 0; i < Detail::Mock_Table_Count(amx, hdr->natives, hdr->libraries); ++i) {
+                        if (natives[i].address == 0)
+                            stubs.push_back({Detail::Mock_Name(amx, natives[i]), stub});
+                    }
+
+                    Register_Natives(amx, stubs.data(), static_cast<int>(stubs.size()));
+
+                    return static_cast<int>(stubs.size());
+                }
+
+                bool Destroy_Amx(AMX* amx) {
+                    auto it = std::find_if(scripts_.begin(), scripts_.end(), [amx](const Script_Slot& slot) { return slot.amx.get() == amx; });
+
+                    if (it == scripts_.end())
+                        return false;
+
+                    for (auto& plugin : plugins_) {
+                        if ((plugin.flags & SUPPORTS_AMX_NATIVES) && plugin.exports.amx_unload)
+                            plugin.exports.amx_unload(amx);
+                    }
+
+                    Get_Export<amx::Cleanup_t>(PLUGIN_AMX_EXPORT_Cleanup)(amx);
+                    scripts_.erase(it);
+
+                    return true;
+                }
+
+                int Register_Natives(AMX* amx, const AMX_NATIVE_INFO* nativelist, int number = -1) {
+                    return Get_Export<amx::Register_t>(PLUGIN_AMX_EXPORT_Register)(amx, nativelist, number);
+                }
+
+                int Exec_Main(AMX* amx, cell* retval = nullptr) {
+                    return Get_Export<amx::Exec_t>(PLUGIN_AMX_EXPORT_Exec)(amx, retval, AMX_EXEC_MAIN);
+                }
+
+                template<typename... Args>
+                Mock_Call_Result Call_Public(AMX* amx, const char* name, Args&&... args) {
+                    Mock_Call_Result result;
+                    int index;
+
+                    result.error = Get_Export<amx::Find_Public_t>(PLUGIN_AMX_EXPORT_FindPublic)(amx, name, &index);
+
+                    if (!result.Ok())
+                        return result;
+
+                    cell saved_hea = amx->hea;
+                    Argument_Frame<sizeof...(Args)> frame;
+
+                    if (!Encode_Arguments(amx, frame, std::forward<Args>(args)...))
+                        return (Get_Export<amx::Release_t>(PLUGIN_AMX_EXPORT_Release)(amx, saved_hea), result.error = static_cast<int>(Amx_Error::Memory), result);
+
+                    for (size_t i = sizeof...(Args); i-- > 0;)
+                        Get_Export<amx::Push_t>(PLUGIN_AMX_EXPORT_Push)(amx, frame.values[i]);
+
+                    result.error = Get_Export<amx::Exec_t>(PLUGIN_AMX_EXPORT_Exec)(amx, &result.value, index);
+                    frame.Write_Back(amx);
+                    Get_Export<amx::Release_t>(PLUGIN_AMX_EXPORT_Release)(amx, saved_hea);
+
+                    return result;
+                }
+
+                template<typename... Args>
+                Mock_Call_Result Call_Native(AMX* amx, const char* name, Args&&... args) {
+                    Mock_Call_Result result;
+                    int index;
+
+                    result.error = Detail::Mock_Amx_Find_Native(amx, name, &index);
+
+                    if (!result.Ok())
+                        return result;
+
+                    cell saved_hea = amx->hea;
+                    cell saved_stk = amx->stk;
+                    Argument_Frame<sizeof...(Args)> frame;
+
+                    if (!Encode_Arguments(amx, frame, std::forward<Args>(args)...))
+                        return (amx->hea = saved_hea, result.error = static_cast<int>(Amx_Error::StackErr), result);
+
+                    result = Call_Native_Raw(amx, index, frame.values, sizeof...(Args));
+                    frame.Write_Back(amx);
+                    amx->stk = saved_stk;
+                    amx->hea = saved_hea;
+
+                    return result;
+                }
+
+                Mock_Call_Result Call_Public_Raw(AMX* amx, int index, const cell* args, size_t count) {
+                    Mock_Call_Result result;
+
+                    for (size_t i = count; i-- > 0;)
+                        Get_Export<amx::Push_t>(PLUGIN_AMX_EXPORT_Push)(amx, args[i]);
+
+                    result.error = Get_Export<amx::Exec_t>(PLUGIN_AMX_EXPORT_Exec)(amx, &result.value, index);
+
+                    return result;
+                }
+
+                Mock_Call_Result Call_Native_Raw(AMX* amx, int index, const cell* args, size_t count) {
+                    Mock_Call_Result result;
+                    cell saved_stk = amx->stk;
+
+                    if (amx->stk - static_cast<cell>((count + 1) * sizeof(cell)) < amx->hea + Detail::MOCK_STACK_MARGIN)
+                        return (result.error = static_cast<int>(Amx_Error::StackErr), result);
+
+                    unsigned char* data = Detail::Mock_Data(amx);
+
+                    for (size_t i = count; i-- > 0;) {
+                        amx->stk -= sizeof(cell);
+                        *reinterpret_cast<cell*>(data + amx->stk) = args[i];
+                    }
+
+                    amx->stk -= sizeof(cell);
+                    *reinterpret_cast<cell*>(data + amx->stk) = static_cast<cell>(count * sizeof(cell));
+
+                    result.error = amx->callback(amx, index, &result.value, reinterpret_cast<cell*>(data + amx->stk));
+                    amx->stk = saved_stk;
+
+                    return result;
+                }
+
+                void Process_Tick() {
+                    for (auto& plugin : plugins_) {
+                        if ((plugin.flags & SUPPORTS_PROCESS_TICK) && plugin.exports.process_tick)
+                            plugin.exports.process_tick();
+                    }
+                }
+
+                void Shutdown() {
+                    while (!scripts_.empty())
+                        Destroy_Amx(scripts_.back().amx.get());
+
+                    while (!plugins_.empty()) {
+                        plugins_.back().exports.unload();
+
+                        if (plugins_.back().library)
+                            plugins_.back().library->Unload();
+
+                        plugins_.pop_back();
+                    }
+                }
+
+                [[nodiscard]] std::vector<std::string> Get_Log() {
+                    std::lock_guard<std::mutex> lock(log_mtx_);
+
+                    return log_;
+                }
+
+                void Clear_Log() {
+                    std::lock_guard<std::mutex> lock(log_mtx_);
+
+                    log_.clear();
+                }
+
+                void Set_Log_Echo(bool echo) {
+                    echo_log_ = echo;
+                }
+
+            private:
+                Mock_Host() {
+                    amx_exports_[PLUGIN_AMX_EXPORT_Align16] = reinterpret_cast<void*>(Detail::Mock_Amx_Align16);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Align32] = reinterpret_cast<void*>(Detail::Mock_Amx_Align32);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Align64] = reinterpret_cast<void*>(Detail::Mock_Amx_Align64);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Allot] = reinterpret_cast<void*>(Detail::Mock_Amx_Allot);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Callback] = reinterpret_cast<void*>(Detail::Mock_Amx_Callback);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Cleanup] = reinterpret_cast<void*>(Detail::Mock_Amx_Cleanup);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Clone] = reinterpret_cast<void*>(Detail::Mock_Amx_Clone);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Exec] = reinterpret_cast<void*>(Detail::Mock_Amx_Exec);
+                    amx_exports_[PLUGIN_AMX_EXPORT_FindNative] = reinterpret_cast<void*>(Detail::Mock_Amx_Find_Native);
+                    amx_exports_[PLUGIN_AMX_EXPORT_FindPublic] = reinterpret_cast<void*>(Detail::Mock_Amx_Find_Public);
+                    amx_exports_[PLUGIN_AMX_EXPORT_FindPubVar] = reinterpret_cast<void*>(Detail::Mock_Amx_Find_Pub_Var);
+                    amx_exports_[PLUGIN_AMX_EXPORT_FindTagId] = reinterpret_cast<void*>(Detail::Mock_Amx_Find_Tag_Id);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Flags] = reinterpret_cast<void*>(Detail::Mock_Amx_Flags);
+                    amx_exports_[PLUGIN_AMX_EXPORT_GetAddr] = reinterpret_cast<void*>(Detail::Mock_Amx_Get_Addr);
+                    amx_exports_[PLUGIN_AMX_EXPORT_GetNative] = reinterpret_cast<void*>(Detail::Mock_Amx_Get_Native);
+                    amx_exports_[PLUGIN_AMX_EXPORT_GetPublic] = reinterpret_cast<void*>(Detail::Mock_Amx_Get_Public);
+                    amx_exports_[PLUGIN_AMX_EXPORT_GetPubVar] = reinterpret_cast<void*>(Detail::Mock_Amx_Get_Pub_Var);
+                    amx_exports_[PLUGIN_AMX_EXPORT_GetString] = reinterpret_cast<void*>(Detail::Mock_Amx_Get_String);
+                    amx_exports_[PLUGIN_AMX_EXPORT_GetTag] = reinterpret_cast<void*>(Detail::Mock_Amx_Get_Tag);
+                    amx_exports_[PLUGIN_AMX_EXPORT_GetUserData] = reinterpret_cast<void*>(Detail::Mock_Amx_Get_User_Data);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Init] = reinterpret_cast<void*>(Detail::Mock_Amx_Init);
+                    amx_exports_[PLUGIN_AMX_EXPORT_InitJIT] = reinterpret_cast<void*>(Detail::Mock_Amx_Init_JIT);
+                    amx_exports_[PLUGIN_AMX_EXPORT_MemInfo] = reinterpret_cast<void*>(Detail::Mock_Amx_Mem_Info);
+                    amx_exports_[PLUGIN_AMX_EXPORT_NameLength] = reinterpret_cast<void*>(Detail::Mock_Amx_Name_Length);
+                    amx_exports_[PLUGIN_AMX_EXPORT_NativeInfo] = reinterpret_cast<void*>(Detail::Mock_Amx_Native_Info);
+                    amx_exports_[PLUGIN_AMX_EXPORT_NumNatives] = reinterpret_cast<void*>(Detail::Mock_Amx_Num_Natives);
+                    amx_exports_[PLUGIN_AMX_EXPORT_NumPublics] = reinterpret_cast<void*>(Detail::Mock_Amx_Num_Publics);
+                    amx_exports_[PLUGIN_AMX_EXPORT_NumPubVars] = reinterpret_cast<void*>(Detail::Mock_Amx_Num_Pub_Vars);
+                    amx_exports_[PLUGIN_AMX_EXPORT_NumTags] = reinterpret_cast<void*>(Detail::Mock_Amx_Num_Tags);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Push] = reinterpret_cast<void*>(Detail::Mock_Amx_Push);
+                    amx_exports_[PLUGIN_AMX_EXPORT_PushArray] = reinterpret_cast<void*>(Detail::Mock_Amx_Push_Array);
+                    amx_exports_[PLUGIN_AMX_EXPORT_PushString] = reinterpret_cast<void*>(Detail::Mock_Amx_Push_String);
+                    amx_exports_[PLUGIN_AMX_EXPORT_RaiseError] = reinterpret_cast<void*>(Detail::Mock_Amx_Raise_Error);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Register] = reinterpret_cast<void*>(Detail::Mock_Amx_Register);
+                    amx_exports_[PLUGIN_AMX_EXPORT_Release] = reinterpret_cast<void*>(Detail::Mock_Amx_Release);
+                    amx_exports_[PLUGIN_AMX_EXPORT_SetCallback] = reinterpret_cast<void*>(Detail::Mock_Amx_Set_Callback);
+                    amx_exports_[PLUGIN_AMX_EXPORT_SetDebugHook] = reinterpret_cast<void*>(Detail::Mock_Amx_Set_Debug_Hook);
+                    amx_exports_[PLUGIN_AMX_EXPORT_SetString] = reinterpret_cast<void*>(Detail::Mock_Amx_Set_String);
+                    amx_exports_[PLUGIN_AMX_EXPORT_SetUserData] = reinterpret_cast<void*>(Detail::Mock_Amx_Set_User_Data);
+                    amx_exports_[PLUGIN_AMX_EXPORT_StrLen] = reinterpret_cast<void*>(Detail::Mock_Amx_Str_Len);
+                    amx_exports_[PLUGIN_AMX_EXPORT_UTF8Check] = reinterpret_cast<void*>(Detail::Mock_Amx_UTF8_Check);
+                    amx_exports_[PLUGIN_AMX_EXPORT_UTF8Get] = reinterpret_cast<void*>(Detail::Mock_Amx_UTF8_Get);
+                    amx_exports_[PLUGIN_AMX_EXPORT_UTF8Len] = reinterpret_cast<void*>(Detail::Mock_Amx_UTF8_Len);
+                    amx_exports_[PLUGIN_AMX_EXPORT_UTF8Put] = reinterpret_cast<void*>(Detail::Mock_Amx_UTF8_Put);
+
+                    plugin_data_[PLUGIN_DATA_LOGPRINTF] = reinterpret_cast<void*>(Log_Printf);
+                    plugin_data_[PLUGIN_DATA_AMX_EXPORTS] = amx_exports_;
+                    plugin_data_[PLUGIN_DATA_CALLPUBLIC_FS] = reinterpret_cast<void*>(Call_Public_FS);
+                    plugin_data_[PLUGIN_DATA_CALLPUBLIC_GM] = reinterpret_cast<void*>(Call_Public_GM);
+                }
+                ~Mock_Host() = default;
+                Mock_Host(const Mock_Host&) = delete;
+                Mock_Host& operator=(const Mock_Host&) = delete;
+
+                struct Script_Slot {
+                    std::unique_ptr<AMX> amx;
+                    std::unique_ptr<cell[]> memory;
+                    std::unique_ptr<Detail::Mock_Script_Runtime> runtime;
+                };
+
+                struct Plugin_Slot {
+                    Mock_Plugin_Exports exports;
+                    unsigned int flags;
+                    std::unique_ptr<Samp_SDK::Detail::Dynamic_Library> library;
+                };
+
+                AMX* Attach_Amx(Script_Slot&& slot) {
+                    slot.amx = std::make_unique<AMX>();
+                    AMX* amx = slot.amx.get();
+
+                    if (Get_Export<amx::Init_t>(PLUGIN_AMX_EXPORT_Init)(amx, slot.memory.get()) != static_cast<int>(Amx_Error::None))
+                        return nullptr;
+
+                    scripts_.push_back(std::move(slot));
+
+                    for (auto& plugin : plugins_) {
+                        if ((plugin.flags & SUPPORTS_AMX_NATIVES) && plugin.exports.amx_load)
+                            plugin.exports.amx_load(amx);
+                    }
+
+                    return amx;
+                }
+
+                template<size_t N>
+                struct Argument_Frame {
+                    cell values[N ? N : 1];
+                    cell* ref_targets[N ? N : 1];
+                    cell ref_addresses[N ? N : 1];
+                    size_t ref_count = 0;
+
+                    void Write_Back(AMX* amx) {
+                        for (size_t i = 0; i < ref_count; ++i)
+                            *ref_targets[i] = *reinterpret_cast<cell*>(Detail::Mock_Data(amx) + ref_addresses[i]);
+                    }
+                };
+
+                template<size_t N>
+                bool Encode_Arguments(AMX*, Argument_Frame<N>&) {
+                    return true;
+                }
+
+                template<size_t N, typename First, typename... Rest>
+                bool Encode_Arguments(AMX* amx, Argument_Frame<N>& frame, First&& first, Rest&&... rest) {
+                    using Type = std::decay_t<First>;
+                    cell& value = frame.values[N - 1 - sizeof...(Rest)];
+
+                    if constexpr (std::is_same_v<Type, Mock_Ref>) {
+                        cell* physical;
+
+                        if (Detail::Mock_Amx_Allot(amx, 1, &value, &physical) != static_cast<int>(Amx_Error::None))
+                            return false;
+
+                        *physical = first.value;
+                        frame.ref_targets[frame.ref_count] = &first.value;
+                        frame.ref_addresses[frame.ref_count++] = value;
+                    }
+                    else if constexpr (std::is_same_v<Type, std::string> || std::is_same_v<Type, std::string_view> || std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>) {
+                        std::string text(first);
+                        cell* physical;
+
+                        if (Detail::Mock_Amx_Allot(amx, static_cast<int>(text.size() + 1), &value, &physical) != static_cast<int>(Amx_Error::None))
+                            return false;
+
+                        Detail::Mock_Amx_Set_String(physical, text.c_str(), 0, 0, text.size() + 1);
+                    }
+                    else if constexpr (std::is_floating_point_v<Type>)
+                        value = amx::AMX_FTOC(static_cast<float>(first));
+                    else
+                        value = static_cast<cell>(first);
+
+                    return Encode_Arguments(amx, frame, std::forward<Rest>(rest)...);
+                }
+
+                static void Log_Printf(const char* format, ...) {
+                    char buffer[1024];
+                    va_list args;
+                    va_start(args, format);
+                    std::vsnprintf(buffer, sizeof(buffer), format, args);
+                    va_end(args);
+
+                    Mock_Host& host = Instance();
+
+                    if (host.echo_log_)
+                        std::printf("%s\n", buffer);
+
+                    std::lock_guard<std::mutex> lock(host.log_mtx_);
+                    host.log_.emplace_back(buffer);
+                }
+
+                static int SAMP_SDK_CDECL Call_Public_FS(char* name) {
+                    return Call_Public_All(name);
+                }
+
+                static int SAMP_SDK_CDECL Call_Public_GM(char* name) {
+                    return Call_Public_All(name);
+                }
+
+                static int Call_Public_All(const char* name) {
+                    Mock_Host& host = Instance();
+                    cell retval = 0;
+
+                    for (auto& script : host.scripts_) {
+                        Mock_Call_Result result = host.Call_Public(script.amx.get(), name);
+
+                        if (result.Ok())
+                            retval = result.value;
+                    }
+
+                    return retval;
+                }
+
+                void* amx_exports_[PLUGIN_AMX_EXPORT_UTF8Put + 1] = {};
+                void* plugin_data_[256] = {};
+                std::vector<Script_Slot> scripts_;
+                std::vector<Plugin_Slot> plugins_;
+                std::vector<std::string> log_;
+                std::mutex log_mtx_;
+                bool echo_log_ = false;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,370 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#if !defined(SAMP_SDK_IMPLEMENTATION) || !defined(SAMP_SDK_WANT_AMX_EVENTS)
+    #error "sdk_benchmarks.hpp must be included by a translation unit that defines SAMP_SDK_IMPLEMENTATION and SAMP_SDK_WANT_AMX_EVENTS."
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+//
+#include "../samp_sdk.hpp"
+#include "benchmark.hpp"
+#include "mock_host.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        inline cell SAMP_SDK_CDECL Benchmark_Native_Sum(AMX* amx, cell* params) {
+            (void)amx;
+            cell sum = 0;
+
+            for (cell i = 1, count = params[0] / static_cast<cell>(sizeof(cell)); i <= count; ++i)
+                sum += params[i];
+
+            return sum;
+        }
+
+        inline cell SAMP_SDK_CDECL Benchmark_Native_String(AMX* amx, cell* params) {
+            int length = 0;
+            cell* phys_addr = nullptr;
+
+            if (amx::Get_Addr(amx, params[1], &phys_addr) != 0 || amx::STR_Len(phys_addr, &length) != 0)
+                return 0;
+
+            return length;
+        }
+
+        inline cell SAMP_SDK_CDECL Benchmark_Native_Ref(AMX* amx, cell* params) {
+            cell* phys_addr = nullptr;
+
+            if (amx::Get_Addr(amx, params[1], &phys_addr) != 0)
+                return 0;
+
+            *phys_addr += 1;
+
+            return 1;
+        }
+
+        class Benchmark_Environment {
+            public:
+                static Benchmark_Environment& Instance() {
+                    static Benchmark_Environment instance;
+
+                    return instance;
+                }
+
+                [[nodiscard]] AMX* Get_Amx() const {
+                    return amx_;
+                }
+
+                [[nodiscard]] cell Get_String_Addr() const {
+                    return string_addr_;
+                }
+
+                [[nodiscard]] cell Get_Ref_Addr() const {
+                    return ref_addr_;
+                }
+
+            private:
+                Benchmark_Environment() {
+                    Testing::Mock_Host& host = Testing::Mock_Host::Instance();
+                    host.Set_Log_Echo(false);
+
+                    Testing::Mock_Plugin_Exports exports;
+                    exports.supports = &::Supports;
+                    exports.load = &::Load;
+                    exports.unload = &::Unload;
+                    exports.amx_load = &::AmxLoad;
+                    exports.amx_unload = &::AmxUnload;
+#if defined(SAMP_SDK_WANT_PROCESS_TICK)
+                    exports.process_tick = &::ProcessTick;
+#endif
+
+                    if (!host.Attach_Plugin(exports)) {
+                        std::printf("Could not attach the benchmark plugin to the mock host.\n");
+
+                        return;
+                    }
+
+                    Testing::Mock_Script script;
+                    script.natives = {"Bench_Native0", "Bench_Native4", "Bench_Native8", "Bench_Native_String", "Bench_Native_Ref", "Bench_Hooked"};
+                    script.publics.push_back({"OnBenchScript", [](AMX*, cell* params) { return params[0] / static_cast<cell>(sizeof(cell)); }});
+                    script.publics.push_back({"OnBenchDispatch", [](AMX*, cell*) { return static_cast<cell>(1); }});
+                    script.publics.push_back({"OnBenchHooked", [](AMX* amx, cell*) { return Testing::Mock_Host::Instance().Call_Native(amx, "Bench_Hooked", 1, 2).value; }});
+
+                    amx_ = host.Create_Amx(script);
+
+                    if (!amx_) {
+                        std::printf("Could not create the benchmark AMX.\n");
+
+                        return;
+                    }
+
+                    static const AMX_NATIVE_INFO natives[] = {
+                        {"Bench_Native0", &Benchmark_Native_Sum},
+                        {"Bench_Native4", &Benchmark_Native_Sum},
+                        {"Bench_Native8", &Benchmark_Native_Sum},
+                        {"Bench_Native_String", &Benchmark_Native_String},
+                        {"Bench_Native_Ref", &Benchmark_Native_Ref},
+                        {"Bench_Hooked", &Benchmark_Native_Sum},
+                    };
+
+                    host.Register_Natives(amx_, natives, static_cast<int>(sizeof(natives) / sizeof(natives[0])));
+                    host.Exec_Main(amx_);
+
+                    cell* phys_addr = nullptr;
+                    const char text[] = "The quick brown fox jumps over the lazy dog";
+
+                    if (amx::Allot(amx_, static_cast<int>(sizeof(text)), &string_addr_, &phys_addr) == 0)
+                        amx::Set_String(phys_addr, text, sizeof(text));
+
+                    amx::Allot(amx_, 1, &ref_addr_, &phys_addr);
+                }
+
+                ~Benchmark_Environment() = default;
+                Benchmark_Environment(const Benchmark_Environment&) = delete;
+                Benchmark_Environment& operator=(const Benchmark_Environment&) = delete;
+
+                AMX* amx_ = nullptr;
+                cell string_addr_ = 0;
+                cell ref_addr_ = 0;
+        };
+    }
+}
+
+#if defined(SAMP_SDK_BENCHMARK_MAIN)
+bool OnLoad() {
+    return true;
+}
+
+void OnUnload() {}
+
+unsigned int GetSupportFlags() {
+    return SUPPORTS_VERSION;
+}
+
+void OnAmxLoad(AMX* amx) {
+    (void)amx;
+}
+
+void OnAmxUnload(AMX* amx) {
+    (void)amx;
+}
+
+#if defined(SAMP_SDK_WANT_PROCESS_TICK)
+void OnProcessTick() {}
+#endif
+#endif
+
+Plugin_Native(Bench_Plugin_Native, AMX* amx, cell* params) {
+    (void)amx;
+
+    return params[0] / static_cast<cell>(sizeof(cell));
+}
+
+Plugin_Public(OnBenchDispatch, int a, float b) {
+    Samp_SDK::Testing::Do_Not_Optimize(a);
+    Samp_SDK::Testing::Do_Not_Optimize(b);
+
+    return PUBLIC_CONTINUE;
+}
+
+Plugin_Native_Hook(Bench_Hooked, AMX* amx, cell* params) {
+    return Call_Original_Native(Bench_Hooked);
+}
+
+SAMP_SDK_BENCHMARK(Pawn_Native_0_Args) {
+    Samp_SDK::Detail::Benchmark_Environment::Instance();
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        auto result = Pawn_Native(Bench_Native0);
+        Samp_SDK::Testing::Do_Not_Optimize(result);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Pawn_Native_4_Args) {
+    Samp_SDK::Detail::Benchmark_Environment::Instance();
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        auto result = Pawn_Native(Bench_Native4, 1, 2, 3, 4);
+        Samp_SDK::Testing::Do_Not_Optimize(result);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Pawn_Native_8_Args) {
+    Samp_SDK::Detail::Benchmark_Environment::Instance();
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        auto result = Pawn_Native(Bench_Native8, 1, 2, 3, 4, 5, 6, 7, 8);
+        Samp_SDK::Testing::Do_Not_Optimize(result);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Pawn_Native_String_Arg) {
+    Samp_SDK::Detail::Benchmark_Environment::Instance();
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        auto result = Pawn_Native(Bench_Native_String, "The quick brown fox");
+        Samp_SDK::Testing::Do_Not_Optimize(result);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Pawn_Native_Ref_Arg) {
+    Samp_SDK::Detail::Benchmark_Environment::Instance();
+    int value = 0;
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        auto result = Pawn_Native(Bench_Native_Ref, value);
+        Samp_SDK::Testing::Do_Not_Optimize(result);
+    }
+
+    Samp_SDK::Testing::Do_Not_Optimize(value);
+}
+
+SAMP_SDK_BENCHMARK(Pawn_Public) {
+    Samp_SDK::Detail::Benchmark_Environment::Instance();
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        auto result = Pawn_Public(OnBenchScript, 1, 2.0f);
+        Samp_SDK::Testing::Do_Not_Optimize(result);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Plugin_Call) {
+    Samp_SDK::Detail::Benchmark_Environment::Instance();
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        auto result = Plugin_Call(Bench_Plugin_Native, 1, 2, 3, 4);
+        Samp_SDK::Testing::Do_Not_Optimize(result);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Plugin_Public_Dispatch) {
+    AMX* amx = Samp_SDK::Detail::Benchmark_Environment::Instance().Get_Amx();
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        auto result = Samp_SDK::Testing::Mock_Host::Instance().Call_Public(amx, "OnBenchDispatch", 1, 2.0f);
+        Samp_SDK::Testing::Do_Not_Optimize(result);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Host_Native_Unhooked) {
+    AMX* amx = Samp_SDK::Detail::Benchmark_Environment::Instance().Get_Amx();
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        auto result = Samp_SDK::Testing::Mock_Host::Instance().Call_Native(amx, "Bench_Native4", 1, 2);
+        Samp_SDK::Testing::Do_Not_Optimize(result);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Host_Native_Hooked) {
+    AMX* amx = Samp_SDK::Detail::Benchmark_Environment::Instance().Get_Amx();
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        auto result = Samp_SDK::Testing::Mock_Host::Instance().Call_Native(amx, "Bench_Hooked", 1, 2);
+        Samp_SDK::Testing::Do_Not_Optimize(result);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Native_Params_Get) {
+    const auto& environment = Samp_SDK::Detail::Benchmark_Environment::Instance();
+    cell params[] = {3 * sizeof(cell), 42, Samp_SDK::amx::AMX_FTOC(1.5f), environment.Get_Ref_Addr()};
+    Samp_SDK::Native_Params p(environment.Get_Amx(), params);
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        int value = p.Get<int>(0);
+        float real = p.Get<float>(1);
+        Samp_SDK::Testing::Do_Not_Optimize(value);
+        Samp_SDK::Testing::Do_Not_Optimize(real);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Native_Params_Get_REF) {
+    const auto& environment = Samp_SDK::Detail::Benchmark_Environment::Instance();
+    cell params[] = {1 * sizeof(cell), environment.Get_Ref_Addr()};
+    Samp_SDK::Native_Params p(environment.Get_Amx(), params);
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        int value = 0;
+        bool ok = p.Get_REF(0, value);
+        Samp_SDK::Testing::Do_Not_Optimize(ok);
+        Samp_SDK::Testing::Do_Not_Optimize(value);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Native_Params_Get_String) {
+    const auto& environment = Samp_SDK::Detail::Benchmark_Environment::Instance();
+    cell params[] = {1 * sizeof(cell), environment.Get_String_Addr()};
+    Samp_SDK::Native_Params p(environment.Get_Amx(), params);
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::string value = p.Get_String(0);
+        Samp_SDK::Testing::Do_Not_Optimize(value);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Get_String) {
+    const auto& environment = Samp_SDK::Detail::Benchmark_Environment::Instance();
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::string value = Samp_SDK::Get_String(environment.Get_Amx(), environment.Get_String_Addr());
+        Samp_SDK::Testing::Do_Not_Optimize(value);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Plugin_Format) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::string value = Plugin_Format("Player %s (id %d) at %.2f", "Alder", 7, 12.5f);
+        Samp_SDK::Testing::Do_Not_Optimize(value);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Plugin_Fmt) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::string value = Plugin_Fmt("Player {} (id {}) at {:.2f}", "Alder", 7, 12.5f);
+        Samp_SDK::Testing::Do_Not_Optimize(value);
+    }
+}
+
+SAMP_SDK_BENCHMARK(Plugin_Fmt_To) {
+    Samp_SDK::Format_Buffer<128> buffer;
+
+    for (uint64_t i = 0; i < iterations; ++i) {
+        buffer.Clear();
+        Plugin_Fmt_To(buffer, "Player {} (id {}) at {:.2f}", "Alder", 7, 12.5f);
+        Samp_SDK::Testing::Do_Not_Optimize(buffer);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,532 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+//
+#include "../amx/amx_defs.h"
+#include "../diagnostics/traffic_recorder.hpp"
+#include "mock_host.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        constexpr size_t REPLAY_MAX_NATIVES = 512;
+        constexpr size_t REPLAY_NO_RECORD = static_cast<size_t>(-1);
+
+        struct Replay_Record {
+            Traffic_Record_Type type;
+            uint8_t flags;
+            uint16_t depth;
+            uint64_t time_ns;
+            uint32_t hash;
+            uint32_t amx_id;
+            cell result;
+            std::vector<cell> args;
+            const unsigned char* regions;
+            uint32_t region_count;
+        };
+    }
+
+    namespace Testing {
+        struct Replay_Options {
+            double speed = 0.0;
+            bool process_ticks = true;
+        };
+
+        struct Replay_Report {
+            uint64_t publics = 0;
+            uint64_t natives = 0;
+            uint64_t ticks = 0;
+            uint64_t result_mismatches = 0;
+            uint64_t unmatched_calls = 0;
+            uint64_t skipped_records = 0;
+            double wall_seconds = 0.0;
+            double tick_p50_us = 0.0;
+            double tick_p99_us = 0.0;
+            double tick_max_us = 0.0;
+
+            void Print() const {
+                std::printf("replayed %llu public(s), %llu native(s), %llu tick(s) in %.2f s\n", static_cast<unsigned long long>(publics),
+                    static_cast<unsigned long long>(natives), static_cast<unsigned long long>(ticks), wall_seconds);
+                std::printf("result mismatches: %llu, calls with no matching record: %llu, records not reached: %llu\n", static_cast<unsigned long long>(result_mismatches),
+                    static_cast<unsigned long long>(unmatched_calls), static_cast<unsigned long long>(skipped_records));
+                std::printf("tick time (us): p50 %.1f, p99 %.1f, max %.1f\n", tick_p50_us, tick_p99_us, tick_max_us);
+            }
+        };
+
+        class Traffic_Replay {
+            public:
+                Traffic_Replay() = default;
+                ~Traffic_Replay() {
+                    if (Active() == this)
+                        Active() = nullptr;
+                }
+                Traffic_Replay(const Traffic_Replay&) = delete;
+                Traffic_Replay& operator=(const Traffic_Replay&) = delete;
+
+                bool Open(const std::string& path) {
+                    std::ifstream file(path, std::ios::binary);
+
+                    if (!file)
+                        return false;
+
+                    buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+                    Detail::Traffic_File_Header header;
+
+                    if (buffer_.size() < sizeof(header))
+                        return false;
+
+                    std::memcpy(&header, buffer_.data(), sizeof(header));
+
+                    if (std::memcmp(header.magic, Detail::TRAFFIC_LOG_MAGIC, sizeof(header.magic)) != 0 || header.version != Detail::TRAFFIC_LOG_VERSION)
+                        return false;
+
+                    records_.clear();
+                    names_.clear();
+                    amx_stp_.clear();
+                    invalid_records_ = 0;
+
+                    for (size_t offset = header.header_size; offset + sizeof(Detail::Traffic_Record_Header) <= buffer_.size();) {
+                        Detail::Traffic_Record_Header record_header;
+                        std::memcpy(&record_header, buffer_.data() + offset, sizeof(record_header));
+
+                        if (record_header.size < sizeof(record_header) || offset + record_header.size > buffer_.size())
+                            break;
+
+                        Parse_Record(record_header, buffer_.data() + offset + sizeof(record_header), record_header.size - sizeof(record_header));
+                        offset += record_header.size;
+                    }
+
+                    return true;
+                }
+
+                bool Attach() {
+                    Mock_Host& host = Mock_Host::Instance();
+
+                    for (const auto& entry : amx_stp_) {
+                        uint32_t amx_id = entry.first;
+                        Mock_Script script;
+                        std::vector<uint32_t> public_hashes;
+                        std::vector<uint32_t> native_hashes;
+
+                        for (const auto& record : records_) {
+                            if (record.amx_id != amx_id)
+                                continue;
+
+                            if (record.type == Detail::Traffic_Record_Type::Public && !(record.flags & Detail::TRAFFIC_FLAG_MAIN))
+                                public_hashes.push_back(record.hash);
+                            else if (record.type == Detail::Traffic_Record_Type::Native)
+                                native_hashes.push_back(record.hash);
+                        }
+
+                        Unique(public_hashes);
+                        Unique(native_hashes);
+
+                        for (uint32_t hash : public_hashes)
+                            script.publics.push_back({names_[hash], [this, hash](AMX*, cell*) { return Enter(Detail::Traffic_Record_Type::Public, hash); }});
+
+                        for (uint32_t hash : native_hashes)
+                            script.natives.push_back(names_[hash]);
+
+                        script.main = [this](AMX*, cell*) { return Enter(Detail::Traffic_Record_Type::Public, Main_Hash()); };
+                        script.data_cells = static_cast<size_t>(entry.second) / sizeof(cell) + 1;
+
+                        AMX* amx = host.Create_Amx(script);
+
+                        if (!amx)
+                            return false;
+
+                        std::vector<AMX_NATIVE_INFO> natives;
+
+                        if (next_stub_ + native_hashes.size() > Detail::REPLAY_MAX_NATIVES)
+                            return false;
+
+                        for (uint32_t hash : native_hashes) {
+                            stub_hashes_[next_stub_] = hash;
+                            natives.push_back({names_[hash].c_str(), Get_Stub(next_stub_++)});
+                        }
+
+                        if (!natives.empty())
+                            host.Register_Natives(amx, natives.data(), static_cast<int>(natives.size()));
+
+                        host.Get_Export<amx::Exec_t>(PLUGIN_AMX_EXPORT_Exec)(amx, nullptr, AMX_EXEC_CONT);
+                        amxs_[amx_id] = amx;
+                    }
+
+                    Active() = this;
+
+                    return true;
+                }
+
+                Replay_Report Run(const Replay_Options& options = Replay_Options()) {
+                    using Clock = std::chrono::steady_clock;
+
+                    report_ = Replay_Report();
+                    report_.skipped_records = invalid_records_;
+                    cursor_ = 0;
+                    pending_ = Detail::REPLAY_NO_RECORD;
+
+                    std::vector<double> tick_ns;
+                    double window_ns = 0.0;
+                    auto start = Clock::now();
+                    uint64_t first_time = records_.empty() ? 0 : records_.front().time_ns;
+
+                    while (cursor_ < records_.size()) {
+                        const Detail::Replay_Record& record = records_[cursor_];
+
+                        if (options.speed > 0.0)
+                            std::this_thread::sleep_until(start + std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(record.time_ns - first_time) / options.speed)));
+
+                        auto dispatch_start = Clock::now();
+
+                        if (record.type == Detail::Traffic_Record_Type::Tick) {
+                            ++cursor_;
+                            ++report_.ticks;
+
+                            if (report_.ticks > 1)
+                                tick_ns.push_back(window_ns);
+
+                            window_ns = 0.0;
+
+                            if (options.process_ticks)
+                                Mock_Host::Instance().Process_Tick();
+                        }
+                        else
+                            Dispatch_Next();
+
+                        window_ns += std::chrono::duration<double, std::nano>(Clock::now() - dispatch_start).count();
+                    }
+
+                    report_.wall_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+                    if (report_.ticks > 0)
+                        tick_ns.push_back(window_ns);
+
+                    if (!tick_ns.empty()) {
+                        std::sort(tick_ns.begin(), tick_ns.end());
+                        report_.tick_p50_us = tick_ns[(tick_ns.size() - 1) / 2] / 1000.0;
+                        report_.tick_p99_us = tick_ns[static_cast<size_t>(static_cast<double>(tick_ns.size() - 1) * 0.99)] / 1000.0;
+                        report_.tick_max_us = tick_ns.back() / 1000.0;
+                    }
+
+                    return report_;
+                }
+
+                [[nodiscard]] size_t Get_Record_Count() const {
+                    return records_.size();
+                }
+
+                [[nodiscard]] AMX* Get_Amx(uint32_t amx_id) const {
+                    auto it = amxs_.find(amx_id);
+
+                    return it != amxs_.end() ? it->second : nullptr;
+                }
+
+                static int Main(int argc, char** argv) {
+                    std::string plugin_path, log_path;
+                    Replay_Options options;
+
+                    for (int i = 1; i < argc; ++i) {
+                        std::string arg = argv[i];
+
+                        if (arg.compare(0, 9, "--plugin=") == 0)
+                            plugin_path = arg.substr(9);
+                        else if (arg.compare(0, 6, "--log=") == 0)
+                            log_path = arg.substr(6);
+                        else if (arg.compare(0, 8, "--speed=") == 0)
+                            options.speed = std::atof(arg.c_str() + 8);
+                        else if (arg == "--no-ticks")
+                            options.process_ticks = false;
+                        else {
+                            std::printf("Usage: %s --plugin=file --log=file [--speed=factor] [--no-ticks]\n", argv[0]);
+
+                            return 2;
+                        }
+                    }
+
+                    Mock_Host& host = Mock_Host::Instance();
+                    Traffic_Replay replay;
+
+                    if (!replay.Open(log_path)) {
+                        std::printf("Could not read traffic log '%s'.\n", log_path.c_str());
+
+                        return 1;
+                    }
+
+                    if (plugin_path.empty() || !host.Load_Plugin(plugin_path)) {
+                        std::printf("Could not load plugin '%s'.\n", plugin_path.c_str());
+
+                        return 1;
+                    }
+
+                    if (!replay.Attach()) {
+                        std::printf("Could not build the replay scripts.\n");
+                        host.Shutdown();
+
+                        return 1;
+                    }
+
+                    Replay_Report report = replay.Run(options);
+                    report.Print();
+                    host.Shutdown();
+
+                    return report.result_mismatches == 0 && report.unmatched_calls == 0 ? 0 : 3;
+                }
+
+            private:
+                static Traffic_Replay*& Active() {
+                    static Traffic_Replay* active = nullptr;
+
+                    return active;
+                }
+
+                static constexpr uint32_t Main_Hash() {
+                    return 0;
+                }
+
+                template<size_t Index>
+                static cell SAMP_SDK_CDECL Native_Stub(AMX*, cell*) {
+                    Traffic_Replay* replay = Active();
+
+                    return replay ? replay->Enter(Detail::Traffic_Record_Type::Native, replay->stub_hashes_[Index]) : 0;
+                }
+
+                template<size_t... Indices>
+                static AMX_NATIVE Get_Stub_Impl(size_t index, std::index_sequence<Indices...>) {
+                    static constexpr AMX_NATIVE stubs[] = {&Native_Stub<Indices>...};
+
+                    return stubs[index];
+                }
+
+                static AMX_NATIVE Get_Stub(size_t index) {
+                    return Get_Stub_Impl(index, std::make_index_sequence<Detail::REPLAY_MAX_NATIVES>());
+                }
+
+                static void Unique(std::vector<uint32_t>& values) {
+                    std::sort(values.begin(), values.end());
+                    values.erase(std::unique(values.begin(), values.end()), values.end());
+                }
+
+                void Parse_Record(const Detail::Traffic_Record_Header& header, const unsigned char* body, size_t size) {
+                    auto type = static_cast<Detail::Traffic_Record_Type>(header.type);
+
+                    if (type == Detail::Traffic_Record_Type::Name && size >= sizeof(uint32_t)) {
+                        uint32_t hash;
+                        std::memcpy(&hash, body, sizeof(hash));
+                        std::string name(reinterpret_cast<const char*>(body + sizeof(hash)), size - sizeof(hash));
+                        names_[hash] = std::move(name);
+                    }
+                    else if (type == Detail::Traffic_Record_Type::Amx && size >= sizeof(Detail::Traffic_Amx_Record)) {
+                        Detail::Traffic_Amx_Record amx_record;
+                        std::memcpy(&amx_record, body, sizeof(amx_record));
+                        amx_stp_[amx_record.amx_id] = amx_record.stp;
+                    }
+                    else if (type == Detail::Traffic_Record_Type::Tick)
+                        records_.push_back({type, header.flags, header.depth, header.time_ns, 0, 0, 0, {}, nullptr, 0});
+                    else if ((type == Detail::Traffic_Record_Type::Public || type == Detail::Traffic_Record_Type::Native) && size >= sizeof(Detail::Traffic_Call_Record)) {
+                        Detail::Traffic_Call_Record call;
+                        std::memcpy(&call, body, sizeof(call));
+
+                        if (call.arg_count > (size - sizeof(call)) / sizeof(cell) || !Validate_Regions(body + sizeof(call) + call.arg_count * sizeof(cell), size - sizeof(call) - call.arg_count * sizeof(cell), call.region_count)) {
+                            ++invalid_records_;
+
+                            return;
+                        }
+
+                        Detail::Replay_Record record{type, header.flags, header.depth, header.time_ns, call.hash, call.amx_id, call.result, std::vector<cell>(call.arg_count),
+                            body + sizeof(call) + call.arg_count * sizeof(cell), call.region_count};
+
+                        if (call.arg_count)
+                            std::memcpy(record.args.data(), body + sizeof(call), call.arg_count * sizeof(cell));
+
+                        if (header.flags & Detail::TRAFFIC_FLAG_MAIN)
+                            record.hash = Main_Hash();
+
+                        records_.push_back(std::move(record));
+                    }
+                }
+
+                static bool Validate_Regions(const unsigned char* cursor, size_t size, uint32_t region_count) {
+                    for (uint32_t i = 0; i < region_count; ++i) {
+                        Detail::Traffic_Region region;
+
+                        if (size < sizeof(region))
+                            return false;
+
+                        std::memcpy(&region, cursor, sizeof(region));
+                        cursor += sizeof(region);
+                        size -= sizeof(region);
+
+                        if (region.cell_count > size / sizeof(cell))
+                            return false;
+
+                        cursor += static_cast<size_t>(region.cell_count) * sizeof(cell);
+                        size -= static_cast<size_t>(region.cell_count) * sizeof(cell);
+                    }
+
+                    return true;
+                }
+
+                void Restore_Regions(AMX* amx, const Detail::Replay_Record& record) {
+                    const unsigned char* cursor = record.regions;
+                    unsigned char* data = Detail::Mock_Data(amx);
+
+                    for (uint32_t i = 0; i < record.region_count; ++i) {
+                        Detail::Traffic_Region region;
+                        std::memcpy(&region, cursor, sizeof(region));
+                        cursor += sizeof(region);
+
+                        size_t bytes = static_cast<size_t>(region.cell_count) * sizeof(cell);
+
+                        if (region.address >= 0 && static_cast<size_t>(region.address) + bytes <= static_cast<size_t>(amx->hea))
+                            std::memcpy(data + region.address, cursor, bytes);
+
+                        cursor += bytes;
+                    }
+                }
+
+                void Dispatch_Next() {
+                    size_t index = cursor_++;
+                    const Detail::Replay_Record& record = records_[index];
+                    AMX* amx = Get_Amx(record.amx_id);
+                    Mock_Host& host = Mock_Host::Instance();
+
+                    if (!amx)
+                        return;
+
+                    Restore_Regions(amx, record);
+
+                    size_t saved_pending = pending_;
+                    pending_ = index;
+                    Mock_Call_Result result;
+                    result.error = static_cast<int>(Amx_Error::NotFound);
+
+                    if (record.type == Detail::Traffic_Record_Type::Public) {
+                        ++report_.publics;
+
+                        if (record.flags & Detail::TRAFFIC_FLAG_MAIN)
+                            result.error = host.Exec_Main(amx, &result.value);
+                        else {
+                            int public_index;
+
+                            if (host.Get_Export<amx::Find_Public_t>(PLUGIN_AMX_EXPORT_FindPublic)(amx, names_[record.hash].c_str(), &public_index) == static_cast<int>(Amx_Error::None))
+                                result = host.Call_Public_Raw(amx, public_index, record.args.data(), record.args.size());
+                        }
+                    }
+                    else {
+                        ++report_.natives;
+                        int native_index;
+
+                        if (Detail::Mock_Amx_Find_Native(amx, names_[record.hash].c_str(), &native_index) == static_cast<int>(Amx_Error::None))
+                            result = host.Call_Native_Raw(amx, native_index, record.args.data(), record.args.size());
+                    }
+
+                    if (!result.Ok() || result.value != record.result)
+                        ++report_.result_mismatches;
+
+                    pending_ = saved_pending;
+
+                    while (cursor_ < records_.size() && records_[cursor_].type != Detail::Traffic_Record_Type::Tick && records_[cursor_].depth > record.depth)
+                        ++cursor_, ++report_.skipped_records;
+                }
+
+                cell Enter(Detail::Traffic_Record_Type type, uint32_t hash) {
+                    size_t index = Detail::REPLAY_NO_RECORD;
+                    bool has_pending = pending_ != Detail::REPLAY_NO_RECORD;
+
+                    if (cursor_ < records_.size() && records_[cursor_].type == type && records_[cursor_].hash == hash && (!has_pending || records_[cursor_].depth > records_[pending_].depth)) {
+                        index = cursor_++;
+
+                        if (type == Detail::Traffic_Record_Type::Public)
+                            ++report_.publics;
+                        else
+                            ++report_.natives;
+                    }
+                    else if (has_pending && records_[pending_].type == type && records_[pending_].hash == hash) {
+                        index = pending_;
+                        pending_ = Detail::REPLAY_NO_RECORD;
+                    }
+
+                    if (index == Detail::REPLAY_NO_RECORD)
+                        return (++report_.unmatched_calls, 0);
+
+                    size_t saved_pending = pending_;
+                    pending_ = Detail::REPLAY_NO_RECORD;
+
+                    while (cursor_ < records_.size() && records_[cursor_].type != Detail::Traffic_Record_Type::Tick && records_[cursor_].depth > records_[index].depth) {
+                        if (records_[cursor_].depth == records_[index].depth + 1)
+                            Dispatch_Next();
+                        else
+                            ++cursor_, ++report_.skipped_records;
+                    }
+
+                    pending_ = saved_pending;
+
+                    return records_[index].result;
+                }
+
+                std::vector<unsigned char> buffer_;
+                std::vector<Detail::Replay_Record> records_;
+                std::unordered_map<uint32_t, std::string> names_;
+                std::map<uint32_t, cell> amx_stp_;
+                std::map<uint32_t, AMX*> amxs_;
+                uint32_t stub_hashes_[Detail::REPLAY_MAX_NATIVES] = {};
+                size_t next_stub_ = 0;
+                uint64_t invalid_records_ = 0;
+                size_t cursor_ = 0;
+                size_t pending_ = Detail::REPLAY_NO_RECORD;
+                Replay_Report report_;
+        };
+    }
+}
+
+#if defined(SAMP_SDK_REPLAY_MAIN)
+int main(int argc, char** argv) {
+    return Samp_SDK::Testing::Traffic_Replay::Main(argc, argv);
+}
+#endif
\ No newline at end of file
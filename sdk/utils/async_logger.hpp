@@ -0,0 +1,329 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+//
+#include "../core/core.hpp"
+#include "../core/platform.hpp"
+
+namespace Samp_SDK {
+    namespace Detail {
+        constexpr size_t ASYNC_LOG_RECORD_SIZE = 512;
+
+        struct Async_Log_Record {
+            std::atomic<size_t> sequence{0};
+            uint32_t length = 0;
+            char text[ASYNC_LOG_RECORD_SIZE];
+        };
+    }
+
+    class Async_Logger {
+        public:
+            static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+            static Async_Logger& Instance() {
+                static Async_Logger instance;
+
+                return instance;
+            }
+
+            bool Start(size_t capacity = DEFAULT_CAPACITY, const std::string& file_path = "", std::chrono::milliseconds flush_interval = std::chrono::milliseconds(20)) {
+                std::lock_guard<std::mutex> lock(control_mtx_);
+
+                if (thread_.joinable())
+                    return true;
+
+                size_t rounded = 2;
+
+                while (rounded < capacity)
+                    rounded <<= 1;
+
+                std::FILE* file = nullptr;
+
+                if (!file_path.empty()) {
+                    file = std::fopen(file_path.c_str(), "a");
+
+                    if (!file) {
+                        Core::Instance().Log(("[SA-MP SDK] Error: Failed to open async log file '" + file_path + "'.").c_str());
+
+                        return false;
+                    }
+                }
+
+                if (!records_ || rounded != capacity_) {
+                    records_.reset(new Detail::Async_Log_Record[rounded]);
+                    capacity_ = rounded;
+                }
+
+                for (size_t i = 0; i < capacity_; ++i)
+                    records_[i].sequence.store(i, std::memory_order_relaxed);
+
+                enqueue_pos_.store(0, std::memory_order_relaxed);
+                dequeue_pos_ = 0;
+                flushed_pos_.store(0, std::memory_order_relaxed);
+                reported_drops_ = dropped_.load(std::memory_order_relaxed);
+                reported_truncations_ = truncated_.load(std::memory_order_relaxed);
+                file_ = file;
+                flush_interval_ = flush_interval;
+
+                {
+                    std::lock_guard<std::mutex> wake_lock(wake_mtx_);
+                    stop_requested_ = false;
+                }
+
+                enabled_.store(true, std::memory_order_release);
+                thread_ = std::thread(&Async_Logger::Run, this);
+
+                return true;
+            }
+
+            void Stop() {
+                std::lock_guard<std::mutex> lock(control_mtx_);
+
+                if (!thread_.joinable())
+                    return;
+
+                enabled_.store(false);
+
+                {
+                    std::lock_guard<std::mutex> wake_lock(wake_mtx_);
+                    stop_requested_ = true;
+                }
+
+                wake_cv_.notify_all();
+                thread_.join();
+
+                while (writers_.load(std::memory_order_acquire) != 0)
+                    std::this_thread::yield();
+
+                Drain();
+                Report_Drops();
+                Report_Truncations();
+
+                if (file_) {
+                    std::fclose(file_);
+                    file_ = nullptr;
+                }
+            }
+
+            void Flush() {
+                if (!Is_Enabled())
+                    return;
+
+                size_t target = enqueue_pos_.load(std::memory_order_acquire);
+                wake_cv_.notify_all();
+
+                while (Is_Enabled() && flushed_pos_.load(std::memory_order_acquire) < target)
+                    std::this_thread::yield();
+            }
+
+            [[nodiscard]] SAMP_SDK_FORCE_INLINE bool Is_Enabled() const {
+                return enabled_.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] uint64_t Get_Dropped_Count() const {
+                return dropped_.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] uint64_t Get_Truncated_Count() const {
+                return truncated_.load(std::memory_order_relaxed);
+            }
+
+            bool Push(const char* format, va_list args) {
+                writers_.fetch_add(1);
+
+                if (!enabled_.load()) {
+                    writers_.fetch_sub(1, std::memory_order_release);
+
+                    return false;
+                }
+
+                size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+                Detail::Async_Log_Record* record;
+
+                for (;;) {
+                    record = &records_[pos & (capacity_ - 1)];
+                    size_t sequence = record->sequence.load(std::memory_order_acquire);
+                    intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+                    if (diff == 0) {
+                        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if (diff < 0) {
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                        writers_.fetch_sub(1, std::memory_order_release);
+
+                        return false;
+                    }
+                    else
+                        pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+
+                int size = std::vsnprintf(record->text, Detail::ASYNC_LOG_RECORD_SIZE, format, args);
+
+                if (size < 0) {
+                    record->text[0] = '\0';
+                    size = 0;
+                }
+
+                if (size >= static_cast<int>(Detail::ASYNC_LOG_RECORD_SIZE)) {
+                    std::memcpy(record->text + Detail::ASYNC_LOG_RECORD_SIZE - 4, "...", 4);
+                    size = static_cast<int>(Detail::ASYNC_LOG_RECORD_SIZE) - 1;
+                    truncated_.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                record->length = static_cast<uint32_t>(size);
+                record->sequence.store(pos + 1, std::memory_order_release);
+                writers_.fetch_sub(1, std::memory_order_release);
+
+                return true;
+            }
+
+        private:
+            Async_Logger() = default;
+            ~Async_Logger() {
+                Stop();
+            }
+            Async_Logger(const Async_Logger&) = delete;
+            Async_Logger& operator=(const Async_Logger&) = delete;
+
+            void Run() {
+                std::unique_lock<std::mutex> lock(wake_mtx_);
+
+                while (!stop_requested_) {
+                    lock.unlock();
+                    Drain();
+                    Report_Drops();
+                    Report_Truncations();
+                    lock.lock();
+
+                    if (!stop_requested_)
+                        wake_cv_.wait_for(lock, flush_interval_);
+                }
+            }
+
+            void Drain() {
+                bool wrote = false;
+
+                for (;;) {
+                    Detail::Async_Log_Record& record = records_[dequeue_pos_ & (capacity_ - 1)];
+                    size_t sequence = record.sequence.load(std::memory_order_acquire);
+
+                    if (sequence != dequeue_pos_ + 1)
+                        break;
+
+                    Write(record.text, record.length);
+                    wrote = true;
+
+                    record.sequence.store(dequeue_pos_ + capacity_, std::memory_order_release);
+                    ++dequeue_pos_;
+                }
+
+                if (wrote && file_)
+                    std::fflush(file_);
+
+                flushed_pos_.store(dequeue_pos_, std::memory_order_release);
+            }
+
+            void Report_Drops() {
+                uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+
+                if (dropped == reported_drops_)
+                    return;
+
+                char message[128];
+                int length = std::snprintf(message, sizeof(message), "[SA-MP SDK] Warning: Async logger dropped %llu message(s), the ring buffer was full.", static_cast<unsigned long long>(dropped - reported_drops_));
+                reported_drops_ = dropped;
+
+                if (length > 0)
+                    Write(message, static_cast<uint32_t>(length < static_cast<int>(sizeof(message)) ? length : sizeof(message) - 1));
+            }
+
+            void Report_Truncations() {
+                uint64_t truncated = truncated_.load(std::memory_order_relaxed);
+
+                if (truncated == reported_truncations_)
+                    return;
+
+                char message[128];
+                int length = std::snprintf(message, sizeof(message), "[SA-MP SDK] Warning: Async logger truncated %llu message(s) longer than %u bytes.",
+                    static_cast<unsigned long long>(truncated - reported_truncations_), static_cast<unsigned>(Detail::ASYNC_LOG_RECORD_SIZE - 1));
+                reported_truncations_ = truncated;
+
+                if (length > 0)
+                    Write(message, static_cast<uint32_t>(length < static_cast<int>(sizeof(message)) ? length : sizeof(message) - 1));
+            }
+
+            void Write(const char* text, uint32_t length) {
+                if (file_) {
+                    std::fwrite(text, 1, length, file_);
+                    std::fputc('\n', file_);
+                }
+                else
+                    Core::Instance().Log(text);
+            }
+
+            std::unique_ptr<Detail::Async_Log_Record[]> records_;
+            size_t capacity_ = 0;
+            alignas(64) std::atomic<size_t> enqueue_pos_{0};
+            alignas(64) size_t dequeue_pos_ = 0;
+            std::atomic<size_t> flushed_pos_{0};
+            std::atomic<uint64_t> dropped_{0};
+            uint64_t reported_drops_ = 0;
+            std::atomic<uint64_t> truncated_{0};
+            uint64_t reported_truncations_ = 0;
+            std::atomic<bool> enabled_{false};
+            std::atomic<uint32_t> writers_{0};
+            std::FILE* file_ = nullptr;
+            std::chrono::milliseconds flush_interval_{20};
+            bool stop_requested_ = false;
+            std::thread thread_;
+            std::mutex control_mtx_;
+            std::mutex wake_mtx_;
+            std::condition_variable wake_cv_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,674 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+//
+#include "../amx/amx_api.hpp"
+#include "../amx/amx_defs.h"
+#include "../core/platform.hpp"
+
+namespace Samp_SDK {
+    struct Pawn_String {
+        const cell* data = nullptr;
+
+        static Pawn_String From(AMX* amx, cell amx_addr) {
+            cell* phys_addr = nullptr;
+
+            if (amx::Get_Addr(amx, amx_addr, &phys_addr) != 0)
+                return {nullptr};
+
+            return {phys_addr};
+        }
+    };
+
+    template<size_t N>
+    class Format_Buffer {
+        public:
+            static_assert(N > 0, "Format_Buffer requires a non-zero capacity.");
+
+            SAMP_SDK_FORCE_INLINE void Append(const char* data, size_t length) {
+                size_t available = N - 1 - size_;
+
+                if (length > available) {
+                    length = available;
+                    truncated_ = true;
+                }
+
+                std::memcpy(data_ + size_, data, length);
+                size_ += length;
+            }
+
+            SAMP_SDK_FORCE_INLINE void Append(char c) {
+                if (size_ + 1 >= N) {
+                    truncated_ = true;
+
+                    return;
+                }
+
+                data_[size_++] = c;
+            }
+
+            void Clear() {
+                size_ = 0;
+                truncated_ = false;
+            }
+
+            [[nodiscard]] const char* c_str() {
+                data_[size_] = '\0';
+
+                return data_;
+            }
+
+            [[nodiscard]] std::string_view View() const {
+                return std::string_view(data_, size_);
+            }
+
+            [[nodiscard]] size_t Size() const {
+                return size_;
+            }
+
+            [[nodiscard]] bool Is_Truncated() const {
+                return truncated_;
+            }
+
+        private:
+            char data_[N];
+            size_t size_ = 0;
+            bool truncated_ = false;
+    };
+
+    namespace Detail {
+        constexpr ucell PAWN_UNPACKED_MAX = (static_cast<ucell>(1) << ((sizeof(cell) - 1) * 8)) - 1;
+
+        struct Format_String_Tag {};
+
+        enum class Format_Arg_Kind : uint8_t {
+            None,
+            Integer,
+            Unsigned,
+            Floating,
+            Character,
+            Boolean,
+            String,
+            Pawn_String
+        };
+
+        enum class Format_Error : uint8_t {
+            None,
+            Unmatched_Brace,
+            Invalid_Spec,
+            Too_Few_Arguments,
+            Too_Many_Arguments,
+            Spec_Type_Mismatch
+        };
+
+        template<typename T>
+        constexpr Format_Arg_Kind Get_Format_Arg_Kind() {
+            using Type = std::decay_t<T>;
+
+            if constexpr (std::is_same_v<Type, bool>)
+                return Format_Arg_Kind::Boolean;
+            else if constexpr (std::is_same_v<Type, char>)
+                return Format_Arg_Kind::Character;
+            else if constexpr (std::is_enum_v<Type>)
+                return std::is_unsigned_v<std::underlying_type_t<Type>> ? Format_Arg_Kind::Unsigned : Format_Arg_Kind::Integer;
+            else if constexpr (std::is_integral_v<Type>)
+                return std::is_unsigned_v<Type> ? Format_Arg_Kind::Unsigned : Format_Arg_Kind::Integer;
+            else if constexpr (std::is_floating_point_v<Type>)
+                return Format_Arg_Kind::Floating;
+            else if constexpr (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*> || std::is_same_v<Type, std::string> || std::is_same_v<Type, std::string_view>)
+                return Format_Arg_Kind::String;
+            else if constexpr (std::is_same_v<Type, Pawn_String>)
+                return Format_Arg_Kind::Pawn_String;
+            else
+                return Format_Arg_Kind::None;
+        }
+
+        constexpr bool Is_Spec_Compatible(char type, Format_Arg_Kind kind) {
+            switch (type) {
+                case '\0':
+                    return true;
+                case 'd':
+                case 'x':
+                case 'X':
+                case 'c':
+                    return kind == Format_Arg_Kind::Integer || kind == Format_Arg_Kind::Unsigned || kind == Format_Arg_Kind::Character || kind == Format_Arg_Kind::Boolean;
+                case 'f':
+                case 'g':
+                    return kind == Format_Arg_Kind::Floating;
+                case 's':
+                    return kind == Format_Arg_Kind::String || kind == Format_Arg_Kind::Pawn_String || kind == Format_Arg_Kind::Boolean;
+                default:
+                    return false;
+            }
+        }
+
+        struct Format_Spec {
+            int precision = -1;
+            char type = '\0';
+        };
+
+        constexpr bool Parse_Format_Spec(std::string_view spec, Format_Spec& out) {
+            size_t i = 0;
+
+            if (i < spec.size() && spec[i] == '.') {
+                ++i;
+
+                if (i >= spec.size() || spec[i] < '0' || spec[i] > '9')
+                    return false;
+
+                int precision = 0;
+
+                while (i < spec.size() && spec[i] >= '0' && spec[i] <= '9') {
+                    precision = precision * 10 + (spec[i] - '0');
+
+                    if (precision > 99)
+                        return false;
+
+                    ++i;
+                }
+
+                out.precision = precision;
+            }
+
+            if (i < spec.size()) {
+                char type = spec[i++];
+
+                if (type != 'd' && type != 'x' && type != 'X' && type != 'c' && type != 'f' && type != 'g' && type != 's')
+                    return false;
+
+                out.type = type;
+            }
+
+            return i == spec.size();
+        }
+
+        constexpr Format_Error Validate_Format(std::string_view format, const Format_Arg_Kind* kinds, size_t count) {
+            size_t arg_index = 0;
+
+            for (size_t i = 0; i < format.size(); ++i) {
+                char c = format[i];
+
+                if (c == '}') {
+                    if (i + 1 < format.size() && format[i + 1] == '}') {
+                        ++i;
+
+                        continue;
+                    }
+
+                    return Format_Error::Unmatched_Brace;
+                }
+
+                if (c != '{')
+                    continue;
+
+                if (i + 1 < format.size() && format[i + 1] == '{') {
+                    ++i;
+
+                    continue;
+                }
+
+                size_t close = format.find('}', i + 1);
+
+                if (close == std::string_view::npos)
+                    return Format_Error::Unmatched_Brace;
+
+                std::string_view field = format.substr(i + 1, close - i - 1);
+                Format_Spec spec;
+
+                if (!field.empty()) {
+                    if (field[0] != ':' || !Parse_Format_Spec(field.substr(1), spec))
+                        return Format_Error::Invalid_Spec;
+                }
+
+                if (arg_index >= count)
+                    return Format_Error::Too_Few_Arguments;
+
+                if (!Is_Spec_Compatible(spec.type, kinds[arg_index]) || (spec.precision >= 0 && kinds[arg_index] != Format_Arg_Kind::Floating))
+                    return Format_Error::Spec_Type_Mismatch;
+
+                ++arg_index;
+                i = close;
+            }
+
+            return arg_index == count ? Format_Error::None : Format_Error::Too_Many_Arguments;
+        }
+
+        template<typename Format_String, typename... Args>
+        constexpr void Check_Format() {
+            static_assert(std::is_base_of_v<Format_String_Tag, Format_String>, "Format strings must be wrapped with SAMP_SDK_FORMAT_STRING (or use the Plugin_Fmt macros).");
+            static_assert(((Get_Format_Arg_Kind<Args>() != Format_Arg_Kind::None) && ...), "Unsupported argument type for the SDK formatter.");
+
+            constexpr Format_Arg_Kind kinds[] = {Get_Format_Arg_Kind<Args>()..., Format_Arg_Kind::None};
+            constexpr Format_Error error = Validate_Format(Format_String::Get(), kinds, sizeof...(Args));
+
+            static_assert(error != Format_Error::Unmatched_Brace, "Format string has an unmatched '{' or '}'.");
+            static_assert(error != Format_Error::Invalid_Spec, "Format string has an invalid replacement field specification.");
+            static_assert(error != Format_Error::Too_Few_Arguments, "Format string has more replacement fields than arguments.");
+            static_assert(error != Format_Error::Too_Many_Arguments, "Format string has fewer replacement fields than arguments.");
+            static_assert(error != Format_Error::Spec_Type_Mismatch, "Format specification does not match the argument type.");
+        }
+
+        struct Format_Arg {
+            Format_Arg_Kind kind;
+
+            union {
+                int64_t integer;
+                uint64_t unsigned_integer;
+                double floating;
+                std::string_view string;
+                const cell* pawn_string;
+            };
+
+            constexpr Format_Arg() : kind(Format_Arg_Kind::None), integer(0) {}
+        };
+
+        template<typename T>
+        SAMP_SDK_FORCE_INLINE Format_Arg Make_Format_Arg(const T& value) {
+            constexpr Format_Arg_Kind kind = Get_Format_Arg_Kind<T>();
+            Format_Arg arg;
+            arg.kind = kind;
+
+            if constexpr (kind == Format_Arg_Kind::Boolean || kind == Format_Arg_Kind::Character || kind == Format_Arg_Kind::Integer)
+                arg.integer = static_cast<int64_t>(value);
+            else if constexpr (kind == Format_Arg_Kind::Unsigned)
+                arg.unsigned_integer = static_cast<uint64_t>(value);
+            else if constexpr (kind == Format_Arg_Kind::Floating)
+                arg.floating = static_cast<double>(value);
+            else if constexpr (kind == Format_Arg_Kind::Pawn_String)
+                arg.pawn_string = value.data;
+            else if constexpr (std::is_array_v<T>)
+                arg.string = std::string_view(value);
+            else if constexpr (std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>)
+                arg.string = value ? std::string_view(value) : std::string_view();
+            else
+                arg.string = std::string_view(value);
+
+            return arg;
+        }
+
+        SAMP_SDK_FORCE_INLINE size_t Format_Decimal(char* end, uint64_t value) {
+            static constexpr char digits[] =
+                "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                "8081828384858687888990919293949596979899";
+            char* p = end;
+
+            while (value >= 100) {
+                unsigned index = static_cast<unsigned>(value % 100) * 2;
+                value /= 100;
+                *--p = digits[index + 1];
+                *--p = digits[index];
+            }
+
+            if (value >= 10) {
+                unsigned index = static_cast<unsigned>(value) * 2;
+                *--p = digits[index + 1];
+                *--p = digits[index];
+            }
+            else
+                *--p = static_cast<char>('0' + value);
+
+            return static_cast<size_t>(end - p);
+        }
+
+        SAMP_SDK_FORCE_INLINE size_t Format_Hex(char* end, uint64_t value, bool upper) {
+            const char* digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+            char* p = end;
+
+            do {
+                *--p = digits[value & 0xF];
+                value >>= 4;
+            } while (value);
+
+            return static_cast<size_t>(end - p);
+        }
+
+        template<typename Writer>
+        void Write_Integer(Writer& writer, const Format_Arg& arg, char type) {
+            char buffer[24];
+            char* end = buffer + sizeof(buffer);
+            bool negative = arg.kind != Format_Arg_Kind::Unsigned && arg.integer < 0;
+            uint64_t magnitude = arg.kind == Format_Arg_Kind::Unsigned ? arg.unsigned_integer : (negative ? (0 - static_cast<uint64_t>(arg.integer)) : static_cast<uint64_t>(arg.integer));
+
+            if (type == 'x' || type == 'X') {
+                uint64_t bits = arg.unsigned_integer;
+
+                if (arg.kind != Format_Arg_Kind::Unsigned && arg.integer >= INT32_MIN && arg.integer <= INT32_MAX)
+                    bits = static_cast<uint32_t>(arg.integer);
+
+                size_t length = Format_Hex(end, bits, type == 'X');
+                writer.Append(end - length, length);
+
+                return;
+            }
+
+            size_t length = Format_Decimal(end, magnitude);
+
+            if (negative)
+                writer.Append('-');
+
+            writer.Append(end - length, length);
+        }
+
+        template<typename Writer>
+        bool Write_Fixed(Writer& writer, double value, int precision, bool trim_zeros) {
+            static constexpr uint64_t powers[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+            if (precision < 0 || precision > 9)
+                return false;
+
+            bool negative = value < 0;
+            double magnitude = negative ? -value : value;
+            uint64_t scale = powers[precision];
+            double product = magnitude * static_cast<double>(scale);
+
+            if (!(product < 9007199254740992.0))
+                return false;
+
+            uint64_t scaled = static_cast<uint64_t>(product + 0.5);
+            uint64_t integer = scaled / scale;
+            uint64_t fraction = scaled % scale;
+
+            char buffer[48];
+            char* end = buffer + sizeof(buffer);
+            char* p = end;
+
+            if (precision > 0) {
+                int digits = precision;
+
+                if (trim_zeros) {
+                    while (digits > 0 && fraction % 10 == 0) {
+                        fraction /= 10;
+                        --digits;
+                    }
+                }
+
+                for (int i = 0; i < digits; ++i) {
+                    *--p = static_cast<char>('0' + fraction % 10);
+                    fraction /= 10;
+                }
+
+                if (digits > 0)
+                    *--p = '.';
+            }
+
+            p -= Format_Decimal(p, integer);
+
+            if (negative && scaled != 0)
+                *--p = '-';
+
+            writer.Append(p, static_cast<size_t>(end - p));
+
+            return true;
+        }
+
+        template<typename Writer>
+        void Write_Floating(Writer& writer, double value, const Format_Spec& spec) {
+            if (spec.type == 'g') {
+                char buffer[64];
+                int length = std::snprintf(buffer, sizeof(buffer), "%.*g", spec.precision < 0 ? 6 : spec.precision, value);
+
+                if (length > 0)
+                    writer.Append(buffer, static_cast<size_t>(length) < sizeof(buffer) ? static_cast<size_t>(length) : sizeof(buffer) - 1);
+
+                return;
+            }
+
+            bool shortest = spec.type == '\0' && spec.precision < 0;
+            double magnitude = value < 0 ? -value : value;
+
+            if (shortest && magnitude != 0 && magnitude < 1e-4) {
+                Format_Spec exponent;
+                exponent.type = 'g';
+                Write_Floating(writer, value, exponent);
+
+                return;
+            }
+
+            if (Write_Fixed(writer, value, shortest ? 6 : (spec.precision < 0 ? 6 : spec.precision), shortest))
+                return;
+
+            char buffer[512];
+            int length = std::snprintf(buffer, sizeof(buffer), shortest ? "%.*g" : "%.*f", spec.precision < 0 ? 6 : spec.precision, value);
+
+            if (length > 0)
+                writer.Append(buffer, static_cast<size_t>(length) < sizeof(buffer) ? static_cast<size_t>(length) : sizeof(buffer) - 1);
+        }
+
+        template<typename Writer>
+        void Write_Pawn_String(Writer& writer, const cell* data) {
+            if (!data)
+                return;
+
+            if (static_cast<ucell>(*data) > PAWN_UNPACKED_MAX) {
+                for (;; ++data) {
+                    ucell value = static_cast<ucell>(*data);
+
+                    for (int shift = (sizeof(cell) - 1) * 8; shift >= 0; shift -= 8) {
+                        char c = static_cast<char>((value >> shift) & 0xFF);
+
+                        if (c == '\0')
+                            return;
+
+                        writer.Append(c);
+                    }
+                }
+            }
+
+            for (; *data != 0; ++data)
+                writer.Append(static_cast<char>(*data));
+        }
+
+        template<typename Writer>
+        void Write_Format_Arg(Writer& writer, const Format_Arg& arg, const Format_Spec& spec) {
+            switch (arg.kind) {
+                case Format_Arg_Kind::Boolean:
+                    if (spec.type == '\0' || spec.type == 's') {
+                        if (arg.integer)
+                            writer.Append("true", 4);
+                        else
+                            writer.Append("false", 5);
+
+                        return;
+                    }
+
+                    Write_Integer(writer, arg, spec.type);
+
+                    return;
+                case Format_Arg_Kind::Character:
+                case Format_Arg_Kind::Integer:
+                case Format_Arg_Kind::Unsigned:
+                    if (spec.type == 'c' || (spec.type == '\0' && arg.kind == Format_Arg_Kind::Character))
+                        writer.Append(static_cast<char>(arg.integer));
+                    else
+                        Write_Integer(writer, arg, spec.type);
+
+                    return;
+                case Format_Arg_Kind::Floating:
+                    Write_Floating(writer, arg.floating, spec);
+
+                    return;
+                case Format_Arg_Kind::String:
+                    writer.Append(arg.string.data(), arg.string.size());
+
+                    return;
+                case Format_Arg_Kind::Pawn_String:
+                    Write_Pawn_String(writer, arg.pawn_string);
+
+                    return;
+                default:
+                    return;
+            }
+        }
+
+        template<typename Writer>
+        void Format_To_Writer(Writer& writer, std::string_view format, const Format_Arg* args) {
+            size_t literal_start = 0;
+            size_t arg_index = 0;
+
+            for (size_t i = 0; i < format.size(); ++i) {
+                char c = format[i];
+
+                if (c != '{' && c != '}')
+                    continue;
+
+                if (i > literal_start)
+                    writer.Append(format.data() + literal_start, i - literal_start);
+
+                if (c == '}' || format[i + 1] == '{') {
+                    writer.Append(c);
+                    literal_start = ++i + 1;
+
+                    continue;
+                }
+
+                size_t close = format.find('}', i + 1);
+                Format_Spec spec;
+
+                if (close > i + 1)
+                    Parse_Format_Spec(format.substr(i + 2, close - i - 2), spec);
+
+                Write_Format_Arg(writer, args[arg_index++], spec);
+                i = close;
+                literal_start = close + 1;
+            }
+
+            if (literal_start < format.size())
+                writer.Append(format.data() + literal_start, format.size() - literal_start);
+        }
+
+        class String_Format_Writer {
+            public:
+                explicit String_Format_Writer(std::string& output) : output_(output) {}
+
+                SAMP_SDK_FORCE_INLINE void Append(const char* data, size_t length) {
+                    output_.append(data, length);
+                }
+
+                SAMP_SDK_FORCE_INLINE void Append(char c) {
+                    output_.push_back(c);
+                }
+
+            private:
+                std::string& output_;
+        };
+
+        class Amx_Format_Writer {
+            public:
+                Amx_Format_Writer(cell* dest, size_t size) : dest_(dest), capacity_(size ? size - 1 : 0) {}
+
+                SAMP_SDK_FORCE_INLINE void Append(const char* data, size_t length) {
+                    for (size_t i = 0; i < length; ++i)
+                        Append(data[i]);
+                }
+
+                SAMP_SDK_FORCE_INLINE void Append(char c) {
+                    if (length_ < capacity_)
+                        dest_[length_++] = static_cast<cell>(static_cast<unsigned char>(c));
+                }
+
+                size_t Finish() {
+                    if (capacity_ || length_)
+                        dest_[length_] = 0;
+
+                    return length_;
+                }
+
+            private:
+                cell* dest_;
+                size_t capacity_;
+                size_t length_ = 0;
+        };
+    }
+
+    template<typename Format_String, typename... Args>
+    inline std::string Format_To_String(Format_String, const Args&... args) {
+        Detail::Check_Format<Format_String, Args...>();
+
+        const Detail::Format_Arg packed[] = {Detail::Make_Format_Arg(args)..., Detail::Format_Arg()};
+        constexpr std::string_view format = Format_String::Get();
+
+        std::string output;
+        output.reserve(format.size() + sizeof...(Args) * 8);
+
+        Detail::String_Format_Writer writer(output);
+        Detail::Format_To_Writer(writer, format, packed);
+
+        return output;
+    }
+
+    template<size_t N, typename Format_String, typename... Args>
+    inline std::string_view Format_To(Format_Buffer<N>& buffer, Format_String, const Args&... args) {
+        Detail::Check_Format<Format_String, Args...>();
+
+        const Detail::Format_Arg packed[] = {Detail::Make_Format_Arg(args)..., Detail::Format_Arg()};
+
+        Detail::Format_To_Writer(buffer, Format_String::Get(), packed);
+
+        return buffer.View();
+    }
+
+    template<typename Format_String, typename... Args>
+    inline int Format_To_Amx(AMX* amx, cell amx_addr, size_t size, Format_String, const Args&... args) {
+        Detail::Check_Format<Format_String, Args...>();
+
+        cell* phys_addr = nullptr;
+
+        if (size == 0 || amx::Get_Addr(amx, amx_addr, &phys_addr) != 0)
+            return -1;
+
+        const Detail::Format_Arg packed[] = {Detail::Make_Format_Arg(args)..., Detail::Format_Arg()};
+        Detail::Amx_Format_Writer writer(phys_addr, size);
+
+        Detail::Format_To_Writer(writer, Format_String::Get(), packed);
+
+        return static_cast<int>(writer.Finish());
+    }
+}
+
+#define SAMP_SDK_FORMAT_STRING(format) \
+    [] { \
+        struct Format_String_Literal : Samp_SDK::Detail::Format_String_Tag { \
+            static constexpr std::string_view Get() { return format; } \
+        }; \
+        return Format_String_Literal{}; \
+    }()
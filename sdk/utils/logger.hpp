@@ -32,17 +32,30 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdarg>
+#include <cstdint>
 #include <cstdio>
+#include <mutex>
 #include <string>
+#include <vector>
 //
 #include "../core/core.hpp"
+#include "async_logger.hpp"
+#include "hash.hpp"
 
 namespace Samp_SDK {
     inline void Log(const char* format, ...) {
         va_list args;
         va_start(args, format);
 
+        if (Async_Logger::Instance().Is_Enabled()) {
+            Async_Logger::Instance().Push(format, args);
+            va_end(args);
+
+            return;
+        }
+
         va_list args_copy;
         va_copy(args_copy, args);
         int size = std::vsnprintf(nullptr, 0, format, args_copy);
@@ -57,4 +70,179 @@ namespace Samp_SDK {
 
         va_end(args);
     }
-}
\ No newline at end of file
+
+    namespace Detail {
+        struct Log_Site {
+            std::mutex mtx;
+            bool registered = false;
+            double tokens = 0.0;
+            uint64_t last_refill_ns = 0;
+            uint64_t last_emit_ns = 0;
+            uint32_t last_hash = 0;
+            size_t last_length = 0;
+            std::string last_message;
+            uint64_t repeated = 0;
+            uint64_t rate_limited = 0;
+        };
+
+        template<typename Site_Tag>
+        SAMP_SDK_FORCE_INLINE Log_Site& Get_Log_Site(Site_Tag) {
+            static Log_Site site;
+
+            return site;
+        }
+    }
+
+    class Log_Limiter {
+        public:
+            static Log_Limiter& Instance() {
+                static Log_Limiter instance;
+
+                return instance;
+            }
+
+            void Configure(uint32_t burst, double refill_per_second, std::chrono::milliseconds repeat_summary_interval = std::chrono::milliseconds(10000)) {
+                std::lock_guard<std::mutex> lock(mtx_);
+
+                burst_ = burst ? burst : 1;
+                refill_per_ns_ = refill_per_second / 1e9;
+                summary_interval_ns_ = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(repeat_summary_interval).count());
+            }
+
+            void Log(Detail::Log_Site& site, const char* format, va_list args) {
+                char message[512];
+                int length = std::vsnprintf(message, sizeof(message), format, args);
+
+                if (length < 0)
+                    return;
+
+                size_t size = static_cast<size_t>(length) < sizeof(message) ? static_cast<size_t>(length) : sizeof(message) - 1;
+                uint32_t hash = Detail::FNV1a_Hash(message);
+                uint64_t now_ns = Now();
+                uint32_t burst;
+                double refill_per_ns;
+                uint64_t summary_interval_ns;
+
+                {
+                    std::lock_guard<std::mutex> lock(mtx_);
+
+                    burst = burst_;
+                    refill_per_ns = refill_per_ns_;
+                    summary_interval_ns = summary_interval_ns_;
+                }
+
+                std::lock_guard<std::mutex> lock(site.mtx);
+
+                if (!site.registered) {
+                    site.registered = true;
+                    site.tokens = burst;
+                    site.last_refill_ns = now_ns;
+                    Register(site);
+                }
+
+                site.tokens += static_cast<double>(now_ns - site.last_refill_ns) * refill_per_ns;
+                site.last_refill_ns = now_ns;
+
+                if (site.tokens > burst)
+                    site.tokens = burst;
+
+                bool is_repeat = site.last_emit_ns != 0 && hash == site.last_hash && size == site.last_length;
+                bool interval_elapsed = now_ns - site.last_emit_ns >= summary_interval_ns;
+
+                if (is_repeat && (site.repeated != 0 || !interval_elapsed || site.tokens < 1.0)) {
+                    ++site.repeated;
+
+                    if (interval_elapsed) {
+                        Emit_Summary(site);
+                        site.last_emit_ns = now_ns;
+                    }
+
+                    return;
+                }
+
+                Emit_Summary(site);
+
+                if (site.tokens < 1.0) {
+                    ++site.rate_limited;
+
+                    return;
+                }
+
+                if (site.rate_limited != 0) {
+                    Samp_SDK::Log("[SA-MP SDK] Warning: %llu message(s) from this call site were suppressed by rate limiting.", static_cast<unsigned long long>(site.rate_limited));
+                    site.rate_limited = 0;
+                }
+
+                site.tokens -= 1.0;
+                site.last_emit_ns = now_ns;
+                site.last_hash = hash;
+                site.last_length = size;
+                site.last_message.assign(message, size);
+
+                Samp_SDK::Log("%s", message);
+            }
+
+            void Flush() {
+                std::vector<Detail::Log_Site*> sites;
+
+                {
+                    std::lock_guard<std::mutex> lock(sites_mtx_);
+                    sites = sites_;
+                }
+
+                for (Detail::Log_Site* site : sites) {
+                    std::lock_guard<std::mutex> site_lock(site->mtx);
+
+                    Emit_Summary(*site);
+
+                    if (site->rate_limited != 0) {
+                        Samp_SDK::Log("[SA-MP SDK] Warning: %llu message(s) from this call site were suppressed by rate limiting.", static_cast<unsigned long long>(site->rate_limited));
+                        site->rate_limited = 0;
+                    }
+                }
+            }
+
+        private:
+            Log_Limiter() = default;
+            ~Log_Limiter() = default;
+            Log_Limiter(const Log_Limiter&) = delete;
+            Log_Limiter& operator=(const Log_Limiter&) = delete;
+
+            static uint64_t Now() {
+                return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+
+            void Register(Detail::Log_Site& site) {
+                std::lock_guard<std::mutex> lock(sites_mtx_);
+
+                sites_.push_back(&site);
+            }
+
+            static void Emit_Summary(Detail::Log_Site& site) {
+                if (site.repeated == 0)
+                    return;
+
+                Samp_SDK::Log("[SA-MP SDK] Message repeated %llu time(s): %s", static_cast<unsigned long long>(site.repeated), site.last_message.c_str());
+                site.repeated = 0;
+            }
+
+            std::mutex mtx_;
+            std::mutex sites_mtx_;
+            std::vector<Detail::Log_Site*> sites_;
+            uint32_t burst_ = 10;
+            double refill_per_ns_ = 1.0 / 1e9;
+            uint64_t summary_interval_ns_ = 10000000000ull;
+    };
+
+    namespace Detail {
+        inline void Log_Limited(Log_Site& site, const char* format, ...) {
+            va_list args;
+            va_start(args, format);
+            Log_Limiter::Instance().Log(site, format, args);
+            va_end(args);
+        }
+    }
+}
+
+#define SAMP_SDK_LOG_LIMITED(...) \
+    Samp_SDK::Detail::Log_Limited(Samp_SDK::Detail::Get_Log_Site([] {}), __VA_ARGS__)
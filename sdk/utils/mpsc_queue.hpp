@@ -0,0 +1,93 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <atomic>
+
+namespace Samp_SDK {
+    namespace Detail {
+        template<typename Node>
+        class Mpsc_Queue {
+            public:
+                Mpsc_Queue() : head_(&stub_), tail_(&stub_) {}
+                Mpsc_Queue(const Mpsc_Queue&) = delete;
+                Mpsc_Queue& operator=(const Mpsc_Queue&) = delete;
+
+                void Push(Node* node) {
+                    node->next.store(nullptr, std::memory_order_relaxed);
+                    Node* previous = head_.exchange(node, std::memory_order_acq_rel);
+                    previous->next.store(node, std::memory_order_release);
+                }
+
+                Node* Pop() {
+                    Node* tail = tail_;
+                    Node* next = tail->next.load(std::memory_order_acquire);
+
+                    if (tail == &stub_) {
+                        if (!next)
+                            return nullptr;
+
+                        tail_ = next;
+                        tail = next;
+                        next = next->next.load(std::memory_order_acquire);
+                    }
+
+                    if (next) {
+                        tail_ = next;
+
+                        return tail;
+                    }
+
+                    if (tail != head_.load(std::memory_order_acquire))
+                        return nullptr;
+
+                    Push(&stub_);
+                    next = tail->next.load(std::memory_order_acquire);
+
+                    if (next) {
+                        tail_ = next;
+
+                        return tail;
+                    }
+
+                    return nullptr;
+                }
+
+            private:
+                Node stub_;
+                alignas(64) std::atomic<Node*> head_;
+                alignas(64) Node* tail_;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,264 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+//
+#include "../sdk/amx/amx_defs.h"
+#include "../sdk/amx/amx_opcodes.hpp"
+
+namespace Samp_SDK {
+    namespace Testing {
+        class Amx_Image_Builder {
+            public:
+                Amx_Image_Builder& Label(const std::string& name) {
+                    labels_[name] = static_cast<cell>(cells_.size() * sizeof(cell));
+
+                    return *this;
+                }
+
+                Amx_Image_Builder& Op(Amx_Opcode opcode) {
+                    cells_.push_back(static_cast<cell>(opcode));
+
+                    return *this;
+                }
+
+                Amx_Image_Builder& Op(Amx_Opcode opcode, cell operand) {
+                    return Op(opcode).Value(operand);
+                }
+
+                Amx_Image_Builder& Branch(Amx_Opcode opcode, const std::string& label) {
+                    return Op(opcode).Ref(label);
+                }
+
+                Amx_Image_Builder& Value(cell value) {
+                    cells_.push_back(value);
+
+                    return *this;
+                }
+
+                Amx_Image_Builder& Ref(const std::string& label) {
+                    fixups_.push_back({cells_.size(), label});
+                    cells_.push_back(0);
+
+                    return *this;
+                }
+
+                Amx_Image_Builder& Public(const std::string& name, const std::string& label) {
+                    publics_.push_back({name, label});
+
+                    return *this;
+                }
+
+                Amx_Image_Builder& Native(const std::string& name) {
+                    natives_.push_back(name);
+
+                    return *this;
+                }
+
+                Amx_Image_Builder& Main(const std::string& label) {
+                    main_ = label;
+
+                    return *this;
+                }
+
+                Amx_Image_Builder& Data(std::vector<cell> data) {
+                    data_ = std::move(data);
+
+                    return *this;
+                }
+
+                Amx_Image_Builder& Stack_Size(int32_t bytes) {
+                    stack_size_ = bytes;
+
+                    return *this;
+                }
+
+                size_t Get_Code_Cells() const {
+                    return cells_.size();
+                }
+
+                std::vector<std::string> Get_Public_Names() const {
+                    std::vector<std::string> names;
+
+                    for (const auto& entry : publics_)
+                        names.push_back(entry.first);
+
+                    std::sort(names.begin(), names.end());
+
+                    return names;
+                }
+
+                std::vector<unsigned char> Build(bool compact = false) const {
+                    std::vector<cell> code = cells_;
+
+                    for (const auto& fixup : fixups_)
+                        code[fixup.first] = Get_Label(fixup.second);
+
+                    std::vector<std::pair<std::string, std::string>> publics = publics_;
+                    std::sort(publics.begin(), publics.end());
+
+                    int32_t publics_offset = static_cast<int32_t>(sizeof(AMX_HEADER));
+                    int32_t natives_offset = publics_offset + static_cast<int32_t>(publics.size() * sizeof(AMX_FUNCSTUBNT));
+                    int32_t table_end = natives_offset + static_cast<int32_t>(natives_.size() * sizeof(AMX_FUNCSTUBNT));
+
+                    std::vector<unsigned char> names;
+                    std::vector<uint32_t> name_offsets;
+                    uint16_t max_name = 0;
+                    int32_t names_offset = table_end + static_cast<int32_t>(sizeof(uint16_t));
+
+                    auto add_name = [&](const std::string& name) {
+                        name_offsets.push_back(static_cast<uint32_t>(names_offset + static_cast<int32_t>(names.size())));
+                        names.insert(names.end(), name.begin(), name.end());
+                        names.push_back(0);
+                        max_name = std::max<uint16_t>(max_name, static_cast<uint16_t>(name.size()));
+                    };
+
+                    for (const auto& entry : publics)
+                        add_name(entry.first);
+
+                    for (const auto& name : natives_)
+                        add_name(name);
+
+                    int32_t cod = (names_offset + static_cast<int32_t>(names.size()) + 3) & ~3;
+                    std::vector<unsigned char> body = compact ? Encode_Compact(code) : Encode_Plain(code);
+                    std::vector<unsigned char> data = compact ? Encode_Compact(data_) : Encode_Plain(data_);
+                    int32_t dat = cod + static_cast<int32_t>(code.size() * sizeof(cell));
+                    int32_t hea = dat + static_cast<int32_t>(data_.size() * sizeof(cell));
+
+                    AMX_HEADER hdr{};
+                    hdr.size = cod + static_cast<int32_t>(body.size() + data.size());
+                    hdr.magic = AMX_MAGIC;
+                    hdr.file_version = 8;
+                    hdr.amx_version = 8;
+                    hdr.flags = static_cast<int16_t>(compact ? AMX_FLAG_COMPACT : 0);
+                    hdr.defsize = static_cast<int16_t>(sizeof(AMX_FUNCSTUBNT));
+                    hdr.cod = cod;
+                    hdr.dat = dat;
+                    hdr.hea = hea;
+                    hdr.stp = hea + stack_size_;
+                    hdr.cip = main_.empty() ? -1 : Get_Label(main_);
+                    hdr.publics = publics_offset;
+                    hdr.natives = natives_offset;
+                    hdr.libraries = table_end;
+                    hdr.pubvars = table_end;
+                    hdr.tags = table_end;
+                    hdr.nametable = table_end;
+
+                    std::vector<unsigned char> image(sizeof(hdr));
+                    std::memcpy(image.data(), &hdr, sizeof(hdr));
+
+                    size_t name_index = 0;
+
+                    for (const auto& entry : publics)
+                        Append_Stub(image, static_cast<ucell>(Get_Label(entry.second)), name_offsets[name_index++]);
+
+                    for (size_t i = 0; i < natives_.size(); ++i)
+                        Append_Stub(image, 0, name_offsets[name_index++]);
+
+                    image.push_back(static_cast<unsigned char>(max_name & 0xFF));
+                    image.push_back(static_cast<unsigned char>(max_name >> 8));
+                    image.insert(image.end(), names.begin(), names.end());
+                    image.resize(static_cast<size_t>(cod), 0);
+                    image.insert(image.end(), body.begin(), body.end());
+                    image.insert(image.end(), data.begin(), data.end());
+
+                    return image;
+                }
+
+                cell Get_Label(const std::string& name) const {
+                    auto it = labels_.find(name);
+
+                    return it != labels_.end() ? it->second : -1;
+                }
+
+            private:
+                static void Append_Stub(std::vector<unsigned char>& image, ucell address, uint32_t name_offset) {
+                    AMX_FUNCSTUBNT stub{address, name_offset};
+                    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&stub);
+
+                    image.insert(image.end(), bytes, bytes + sizeof(stub));
+                }
+
+                static std::vector<unsigned char> Encode_Plain(const std::vector<cell>& cells) {
+                    std::vector<unsigned char> out(cells.size() * sizeof(cell));
+
+                    if (!cells.empty())
+                        std::memcpy(out.data(), cells.data(), out.size());
+
+                    return out;
+                }
+
+                static std::vector<unsigned char> Encode_Compact(const std::vector<cell>& cells) {
+                    std::vector<unsigned char> out;
+
+                    for (cell value : cells) {
+                        unsigned char groups[6];
+                        int count = 0;
+                        int64_t v = value;
+
+                        while (true) {
+                            groups[count++] = static_cast<unsigned char>(v & 0x7F);
+                            v >>= 7;
+
+                            if ((v == 0 && !(groups[count - 1] & 0x40)) || (v == -1 && (groups[count - 1] & 0x40)))
+                                break;
+                        }
+
+                        while (count > 1)
+                            out.push_back(static_cast<unsigned char>(groups[--count] | 0x80));
+
+                        out.push_back(groups[0]);
+                    }
+
+                    return out;
+                }
+
+                std::vector<cell> cells_;
+                std::vector<std::pair<size_t, std::string>> fixups_;
+                std::map<std::string, cell> labels_;
+                std::vector<std::pair<std::string, std::string>> publics_;
+                std::vector<std::string> natives_;
+                std::vector<cell> data_;
+                std::string main_;
+                int32_t stack_size_ = 4096;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+//
+#include "../sdk/utils/logger.hpp"
+#include "test_check.hpp"
+
+namespace {
+    const char* const LOG_PATH = "async_logger_test.log";
+
+    std::vector<std::string> Read_Lines(const char* path) {
+        std::ifstream file(path);
+        std::vector<std::string> lines;
+
+        for (std::string line; std::getline(file, line);)
+            lines.push_back(line);
+
+        return lines;
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+
+    std::remove(LOG_PATH);
+
+    Samp_SDK::Async_Logger& logger = Samp_SDK::Async_Logger::Instance();
+    SAMP_SDK_CHECK(logger.Start(64, LOG_PATH));
+
+    std::string long_text(2000, 'x');
+    Samp_SDK::Log("long %s", long_text.c_str());
+    Samp_SDK::Log("short %d", 42);
+    logger.Flush();
+    logger.Stop();
+
+    SAMP_SDK_CHECK(logger.Get_Truncated_Count() == 1);
+
+    std::vector<std::string> lines = Read_Lines(LOG_PATH);
+    SAMP_SDK_CHECK(lines.size() == 3);
+
+    if (lines.size() == 3) {
+        SAMP_SDK_CHECK(lines[0].size() == Samp_SDK::Detail::ASYNC_LOG_RECORD_SIZE - 1);
+        SAMP_SDK_CHECK(lines[0].compare(0, 5, "long ") == 0);
+        SAMP_SDK_CHECK(lines[0].compare(lines[0].size() - 4, 4, "x...") == 0);
+        SAMP_SDK_CHECK(lines[1] == "short 42");
+        SAMP_SDK_CHECK(lines[2].find("truncated 1 message(s)") != std::string::npos);
+    }
+
+    std::remove(LOG_PATH);
+
+    return Test_Result("async_logger_test");
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#define SAMP_SDK_WANT_PROCESS_TICK
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+//
+#include "../sdk/samp_sdk.hpp"
+#include "../sdk/testing/mock_host.hpp"
+#include "test_check.hpp"
+
+namespace {
+    std::atomic<int> calls{0};
+    std::atomic<int> bad_arguments{0};
+    std::thread::id server_thread;
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+    Samp_SDK::Core::Instance().Load(host.Get_Plugin_Data());
+    server_thread = std::this_thread::get_id();
+
+    Mock_Script script;
+    script.publics.push_back({"OnAsyncEvent", [](AMX* amx, cell* params) {
+        char text[32] = {};
+        cell* physical = nullptr;
+
+        Samp_SDK::Detail::Mock_Amx_Get_Addr(amx, params[3], &physical);
+        Samp_SDK::Detail::Mock_Amx_Get_String(text, physical, 0, sizeof(text));
+
+        if (std::this_thread::get_id() != server_thread || params[0] != 3 * static_cast<cell>(sizeof(cell)) ||
+            Samp_SDK::amx::AMX_CTOF(params[2]) != 1.5f || std::string(text) != "literal")
+            ++bad_arguments;
+
+        ++calls;
+
+        return params[1] * 2;
+    }});
+
+    AMX* amx = host.Create_Amx(script);
+    SAMP_SDK_CHECK(amx != nullptr);
+
+    if (!amx)
+        return Samp_SDK::Testing::Test_Result("async_public_test");
+
+    Samp_SDK::Amx_Manager::Instance().Add_Amx(amx);
+
+    cell stk = amx->stk;
+    cell hea = amx->hea;
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([] {
+            for (int i = 0; i < 1000; ++i)
+                Pawn_Public_Async(OnAsyncEvent, i, 1.5f, "literal");
+        });
+    }
+
+    std::future<Samp_SDK::Callback_Result> future;
+    std::thread waiter([&future] { future = Pawn_Public_Future(OnAsyncEvent, 21, 1.5, std::string("literal")); });
+    waiter.join();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while (calls < 4001 && std::chrono::steady_clock::now() < deadline)
+        Samp_SDK::Detail::Async_Public_Queue::Instance().Process();
+
+    for (auto& worker : workers)
+        worker.join();
+
+    Samp_SDK::Detail::Async_Public_Queue::Instance().Process();
+
+    SAMP_SDK_CHECK(calls == 4001);
+    SAMP_SDK_CHECK(bad_arguments == 0);
+    SAMP_SDK_CHECK(future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+
+    Samp_SDK::Callback_Result result = future.get();
+    SAMP_SDK_CHECK(result.Success() && result.Value() == 42);
+    SAMP_SDK_CHECK(Samp_SDK::Detail::Async_Public_Queue::Instance().Get_Pending_Count() == 0);
+    SAMP_SDK_CHECK(amx->stk == stk && amx->hea == hea);
+
+    std::future<Samp_SDK::Callback_Result> missing = Pawn_Public_Future(OnMissingPublic, 1);
+    Samp_SDK::Detail::Async_Public_Queue::Instance().Process();
+    SAMP_SDK_CHECK(!missing.get().Success());
+
+    Samp_SDK::Amx_Manager::Instance().Remove_Amx(amx);
+    Samp_SDK::Detail::Async_Public_Queue::Instance().Clear();
+    host.Shutdown();
+
+    return Samp_SDK::Testing::Test_Result("async_public_test");
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+
+#define SAMP_SDK_WANT_PROCESS_TICK
+#define SAMP_SDK_WANT_COROUTINES
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+//
+#include "../sdk/samp_sdk.hpp"
+#include "../sdk/testing/mock_host.hpp"
+#include "test_check.hpp"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Frame_Guard {
+        int& destroyed;
+
+        ~Frame_Guard() {
+            ++destroyed;
+        }
+    };
+
+    void Tick() {
+        Samp_SDK::Timer_Service::Instance().Process();
+        Samp_SDK::Detail::Main_Thread_Queue::Instance().Process();
+        Samp_SDK::Detail::Coroutine_Scheduler::Instance().Process();
+    }
+
+    template<typename Predicate>
+    bool Tick_Until(Predicate predicate) {
+        Clock::time_point deadline = Clock::now() + std::chrono::seconds(5);
+
+        while (!predicate()) {
+            if (Clock::now() > deadline)
+                return false;
+
+            Tick();
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+
+        return true;
+    }
+
+    void Dispatch_Spawn(AMX* amx, cell playerid) {
+        cell stk = amx->stk;
+        cell result = 0;
+
+        Samp_SDK::Detail::Mock_Amx_Push(amx, playerid);
+        Samp_SDK::Detail::Public_Dispatcher::Instance().Dispatch(Samp_SDK::Detail::FNV1a_Hash("OnPlayerSpawn"), amx, result);
+        amx->stk = stk;
+    }
+
+    Samp_SDK::Coroutine Count_Ticks(AMX* amx, int& steps) {
+        (void)amx;
+        ++steps;
+        co_await Samp_SDK::Next_Tick();
+        ++steps;
+        co_await Samp_SDK::Next_Tick();
+        ++steps;
+    }
+
+    Samp_SDK::Coroutine Sleep(AMX* amx, Clock::time_point& woke_at) {
+        (void)amx;
+        co_await Samp_SDK::Delay(std::chrono::milliseconds(20));
+        woke_at = Clock::now();
+    }
+
+    Samp_SDK::Coroutine Wait_Spawn(AMX* amx, int& spawned) {
+        (void)amx;
+        auto [playerid] = co_await Samp_SDK::Wait_For_Public<int>("OnPlayerSpawn", [](int id) { return id == 7; });
+        spawned = playerid;
+    }
+
+    Samp_SDK::Coroutine Offload(AMX* amx, std::thread::id& worker_id, std::thread::id& resumed_id, int& value) {
+        (void)amx;
+        value = co_await Samp_SDK::Run_On_Worker([&worker_id] { worker_id = std::this_thread::get_id(); return 6 * 7; });
+        resumed_id = std::this_thread::get_id();
+    }
+
+    Samp_SDK::Coroutine Cancelled(AMX* amx, int& destroyed, bool& continued) {
+        (void)amx;
+        Frame_Guard guard{destroyed};
+        co_await Samp_SDK::Delay(std::chrono::milliseconds(50));
+        continued = true;
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+    Samp_SDK::Core::Instance().Load(host.Get_Plugin_Data());
+
+    Mock_Script script;
+    AMX* amx = host.Create_Amx(script);
+    AMX* other = host.Create_Amx(script);
+    SAMP_SDK_CHECK(amx != nullptr && other != nullptr);
+
+    if (!amx || !other)
+        return Test_Result("coroutine_test");
+
+    int steps = 0;
+    Count_Ticks(amx, steps);
+    SAMP_SDK_CHECK(steps == 1);
+    Tick();
+    SAMP_SDK_CHECK(steps == 2);
+    Tick();
+    SAMP_SDK_CHECK(steps == 3);
+
+    Clock::time_point slept_at = Clock::now(), woke_at;
+    Sleep(amx, woke_at);
+    SAMP_SDK_CHECK(Tick_Until([&] { return woke_at != Clock::time_point(); }));
+    SAMP_SDK_CHECK(woke_at - slept_at >= std::chrono::milliseconds(20));
+
+    int spawned = -1;
+    Wait_Spawn(amx, spawned);
+    Dispatch_Spawn(amx, 3);
+    SAMP_SDK_CHECK(spawned == -1);
+    Dispatch_Spawn(amx, 7);
+    SAMP_SDK_CHECK(spawned == 7);
+    Tick();
+    SAMP_SDK_CHECK(!Samp_SDK::Detail::Public_Dispatcher::Instance().Has_Handler(Samp_SDK::Detail::FNV1a_Hash("OnPlayerSpawn")));
+
+    std::thread::id worker_id, resumed_id;
+    int value = 0;
+    Offload(amx, worker_id, resumed_id, value);
+    SAMP_SDK_CHECK(Tick_Until([&] { return value == 42; }));
+    SAMP_SDK_CHECK(worker_id != std::this_thread::get_id() && resumed_id == std::this_thread::get_id());
+
+    int destroyed = 0;
+    bool continued = false;
+    Cancelled(other, destroyed, continued);
+    Samp_SDK::Detail::Coroutine_Scheduler::Instance().Cancel_Amx(other);
+    SAMP_SDK_CHECK(destroyed == 1);
+
+    for (int i = 0; i < 40; ++i) {
+        Tick();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    SAMP_SDK_CHECK(!continued && Samp_SDK::Timer_Service::Instance().Get_Active_Count() == 0);
+
+    Samp_SDK::Detail::Coroutine_Scheduler::Instance().Cancel_All();
+    Samp_SDK::Thread_Pool::Instance().Stop();
+    host.Shutdown();
+
+    return Test_Result("coroutine_test");
+}
\ No newline at end of file
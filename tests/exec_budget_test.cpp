@@ -0,0 +1,139 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#include <string>
+#include <vector>
+//
+#include "../sdk/samp_sdk.hpp"
+#include "../sdk/testing/mock_host.hpp"
+#include "amx_fixture.hpp"
+#include "test_check.hpp"
+
+namespace {
+    int breaks = 0;
+
+    int SAMP_SDK_CDECL Count_Breaks(AMX* amx) {
+        (void)amx;
+        ++breaks;
+
+        return 0;
+    }
+
+    bool Log_Contains(const char* first, const char* second) {
+        for (const std::string& line : Samp_SDK::Testing::Mock_Host::Instance().Get_Log()) {
+            if (line.find(first) != std::string::npos && line.find(second) != std::string::npos)
+                return true;
+        }
+
+        return false;
+    }
+
+    Samp_SDK::Testing::Amx_Image_Builder Make_Script() {
+        using Samp_SDK::Amx_Opcode;
+
+        Samp_SDK::Testing::Amx_Image_Builder builder;
+
+        builder.Op(Amx_Opcode::Halt, 0);
+        builder.Label("main").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Const_Pri, 7).Op(Amx_Opcode::Retn);
+        builder.Label("Count").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_C, 0);
+        builder.Label("Count_Loop").Op(Amx_Opcode::Break).Op(Amx_Opcode::Load_S_Pri, -4).Op(Amx_Opcode::Load_S_Alt, 12).Branch(Amx_Opcode::Jsgeq, "Count_Done")
+            .Op(Amx_Opcode::Inc_S, -4).Branch(Amx_Opcode::Jump, "Count_Loop");
+        builder.Label("Count_Done").Op(Amx_Opcode::Stack, 4).Op(Amx_Opcode::Retn);
+        builder.Label("Spin").Op(Amx_Opcode::Proc);
+        builder.Label("Spin_Loop").Op(Amx_Opcode::Break).Branch(Amx_Opcode::Jump, "Spin_Loop");
+
+        builder.Main("main").Public("Count", "Count").Public("Spin", "Spin");
+
+        return builder;
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+    using Samp_SDK::Exec_Budget;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+    Samp_SDK::Core::Instance().Load(host.Get_Plugin_Data());
+    Samp_SDK::Detail::Interceptor_Manager::Instance().Activate();
+
+    std::vector<unsigned char> image = Make_Script().Build();
+    AMX* amx = host.Load_Amx_Image(image.data(), image.size());
+    SAMP_SDK_CHECK(amx != nullptr);
+
+    if (!amx)
+        return Test_Result("exec_budget_test");
+
+    Samp_SDK::Amx_Manager::Instance().Add_Amx(amx);
+    amx->debug = &Count_Breaks;
+
+    Mock_Call_Result unbounded = host.Call_Public(amx, "Count", 50);
+    SAMP_SDK_CHECK(unbounded.Ok() && unbounded.value == 50 && breaks == 51);
+
+    Exec_Budget::Instance().Enable(100);
+
+    cell stk = amx->stk;
+    cell hea = amx->hea;
+
+    breaks = 0;
+    Mock_Call_Result within = host.Call_Public(amx, "Count", 50);
+    SAMP_SDK_CHECK(within.Ok() && within.value == 50 && breaks == 51);
+    SAMP_SDK_CHECK(amx->debug != &Count_Breaks);
+
+    Mock_Call_Result spin = host.Call_Public(amx, "Spin");
+    SAMP_SDK_CHECK(spin.error == static_cast<int>(Amx_Error::Exit));
+    SAMP_SDK_CHECK(Log_Contains("instruction budget", "'Spin'"));
+    SAMP_SDK_CHECK(amx->stk == stk && amx->hea == hea);
+
+    SAMP_SDK_CHECK(host.Call_Public(amx, "Count", 150).error == static_cast<int>(Amx_Error::Exit));
+
+    Exec_Budget::Instance().Set_Limit(amx, 200);
+    Mock_Call_Result raised = host.Call_Public(amx, "Count", 150);
+    SAMP_SDK_CHECK(raised.Ok() && raised.value == 150);
+
+    Exec_Budget::Instance().Enable(100, Amx_Error::Sleep);
+    Exec_Budget::Instance().Set_Limit(amx, 10);
+    SAMP_SDK_CHECK(host.Call_Public(amx, "Spin").error == static_cast<int>(Amx_Error::Exit));
+
+    Exec_Budget::Instance().Disable();
+    Exec_Budget::Instance().Release(amx);
+    SAMP_SDK_CHECK(amx->debug == &Count_Breaks);
+
+    breaks = 0;
+    SAMP_SDK_CHECK(host.Call_Public(amx, "Count", 150).value == 150 && breaks == 151);
+
+    Samp_SDK::Detail::Interceptor_Manager::Instance().Deactivate();
+    host.Shutdown();
+
+    return Test_Result("exec_budget_test");
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#include <string>
+//
+#include "../sdk/utils/format.hpp"
+#include "test_check.hpp"
+
+#define FORMAT(format, ...) Samp_SDK::Format_To_String(SAMP_SDK_FORMAT_STRING(format), __VA_ARGS__)
+
+int main() {
+    SAMP_SDK_CHECK(FORMAT("{} {} {}", 1, "two", 3.5) == "1 two 3.5");
+    SAMP_SDK_CHECK(FORMAT("{:.2f}", -3.14159) == "-3.14");
+    SAMP_SDK_CHECK(FORMAT("{}", 0.1) == "0.1");
+    SAMP_SDK_CHECK(FORMAT("{}", 123456.0) == "123456");
+
+    SAMP_SDK_CHECK(FORMAT("{}", 5e13) == "5e+13");
+    SAMP_SDK_CHECK(FORMAT("{:.9f}", 1e12) == "1000000000000.000000000");
+    SAMP_SDK_CHECK(FORMAT("{:.2f}", 1e15 - 1) == "999999999999999.00");
+    SAMP_SDK_CHECK(FORMAT("{:.2f}", -1e15 + 1) == "-999999999999999.00");
+    SAMP_SDK_CHECK(FORMAT("{:.3f}", 9007199254740.5) == "9007199254740.500");
+
+    return Samp_SDK::Testing::Test_Result("format_test");
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#define SAMP_SDK_WANT_PROCESS_TICK
+
+#include <string>
+#include <vector>
+//
+#include "../sdk/samp_sdk.hpp"
+#include "../sdk/testing/mock_host.hpp"
+#include "amx_fixture.hpp"
+#include "test_check.hpp"
+
+namespace {
+    const char* const MODULE_PATH = "modules";
+
+    Samp_SDK::amx::Register_t mock_register = nullptr;
+
+    int SAMP_SDK_CDECL Register_Detour(AMX* amx, const AMX_NATIVE_INFO* nativelist, int number) {
+        Samp_SDK::Detail::Interceptor_Manager::Instance().Update_Native_Cache(nativelist, number);
+
+        return mock_register(amx, nativelist, number);
+    }
+
+    bool Log_Contains(const std::string& text) {
+        for (const std::string& line : Samp_SDK::Testing::Mock_Host::Instance().Get_Log()) {
+            if (line.find(text) != std::string::npos)
+                return true;
+        }
+
+        return false;
+    }
+
+    Samp_SDK::Testing::Amx_Image_Builder Make_Script() {
+        using Samp_SDK::Amx_Opcode;
+
+        Samp_SDK::Testing::Amx_Image_Builder builder;
+
+        builder.Op(Amx_Opcode::Halt, 0);
+        builder.Label("main").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Const_Pri, 7).Op(Amx_Opcode::Retn);
+        builder.Label("Scale").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_S, 12).Op(Amx_Opcode::Push_C, 4).Op(Amx_Opcode::Sysreq_C, 0)
+            .Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Retn);
+
+        builder.Main("main").Public("Scale", "Scale").Native("Delta_Native");
+
+        return builder;
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+    using Samp_SDK::Detail::Module_Manager;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+
+    void** plugin_data = host.Get_Plugin_Data();
+    void** amx_exports = static_cast<void**>(plugin_data[PLUGIN_DATA_AMX_EXPORTS]);
+    mock_register = reinterpret_cast<Samp_SDK::amx::Register_t>(amx_exports[PLUGIN_AMX_EXPORT_Register]);
+    amx_exports[PLUGIN_AMX_EXPORT_Register] = reinterpret_cast<void*>(&Register_Detour);
+    Samp_SDK::Core::Instance().Load(plugin_data);
+
+    Module_Manager& manager = Module_Manager::Instance();
+
+    SAMP_SDK_CHECK(manager.Load_Module("delta", MODULE_PATH, "", plugin_data));
+    SAMP_SDK_CHECK(!manager.Reload_Module("absent"));
+
+    std::vector<unsigned char> image = Make_Script().Build();
+    AMX* amx = host.Load_Amx_Image(image.data(), image.size());
+    SAMP_SDK_CHECK(amx != nullptr);
+
+    if (amx) {
+        Samp_SDK::Amx_Manager::Instance().Add_Amx(amx);
+        manager.Forward_AmxLoad(amx);
+
+        SAMP_SDK_CHECK(Samp_SDK::Amx_Sysreq_Rewriter::Instance().Rewrite(amx, nullptr) == 1);
+        SAMP_SDK_CHECK(host.Call_Public(amx, "Scale", 3).value == 6);
+        SAMP_SDK_CHECK(host.Call_Public(amx, "Scale", 4).value == 8);
+
+        host.Clear_Log();
+        SAMP_SDK_CHECK(manager.Reload_Module("delta", std::string(MODULE_PATH) + "/v2"));
+        SAMP_SDK_CHECK(!Log_Contains("reloaded"));
+
+        manager.Forward_ProcessTick();
+        SAMP_SDK_CHECK(Log_Contains("test module delta: unload"));
+        SAMP_SDK_CHECK(Log_Contains("test module delta: restored 2"));
+        SAMP_SDK_CHECK(Log_Contains("Module 'delta' reloaded in"));
+
+        Mock_Call_Result reloaded = host.Call_Public(amx, "Scale", 3);
+        SAMP_SDK_CHECK(reloaded.Ok() && reloaded.value == 21);
+
+        host.Clear_Log();
+        SAMP_SDK_CHECK(manager.Reload_Module("delta", std::string(MODULE_PATH) + "/v3"));
+        manager.Forward_ProcessTick();
+        SAMP_SDK_CHECK(Log_Contains("test module delta: restored 3"));
+        SAMP_SDK_CHECK(Log_Contains("Native 'Delta_Native' is no longer provided"));
+        SAMP_SDK_CHECK(host.Call_Public(amx, "Scale", 3).error == static_cast<int>(Amx_Error::NotFound));
+    }
+
+    host.Clear_Log();
+    manager.Unload_All_Modules();
+    SAMP_SDK_CHECK(Log_Contains("test module delta: unload"));
+
+    host.Shutdown();
+
+    return Test_Result("hot_reload_test");
+}
\ No newline at end of file
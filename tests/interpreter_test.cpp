@@ -0,0 +1,156 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#include <vector>
+//
+#include "../sdk/testing/mock_host.hpp"
+#include "amx_fixture.hpp"
+#include "test_check.hpp"
+
+namespace {
+    int breaks = 0;
+
+    cell SAMP_SDK_CDECL Twice(AMX* amx, cell* params) {
+        (void)amx;
+
+        return params[1] * 2;
+    }
+
+    int SAMP_SDK_CDECL Count_Breaks(AMX* amx) {
+        (void)amx;
+        ++breaks;
+
+        return 0;
+    }
+
+    Samp_SDK::Testing::Amx_Image_Builder Make_Script() {
+        using Samp_SDK::Amx_Opcode;
+
+        Samp_SDK::Testing::Amx_Image_Builder builder;
+
+        builder.Op(Amx_Opcode::Halt, 0);
+        builder.Label("main").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Const_Pri, 7).Op(Amx_Opcode::Retn);
+
+        builder.Label("Sum").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_C, 0).Op(Amx_Opcode::Push_C, 1);
+        builder.Label("Sum_Loop").Op(Amx_Opcode::Break).Op(Amx_Opcode::Load_S_Pri, -8).Op(Amx_Opcode::Load_S_Alt, 12).Branch(Amx_Opcode::Jsgrtr, "Sum_Done")
+            .Op(Amx_Opcode::Load_S_Pri, -4).Op(Amx_Opcode::Load_S_Alt, -8).Op(Amx_Opcode::Add).Op(Amx_Opcode::Stor_S_Pri, -4)
+            .Op(Amx_Opcode::Inc_S, -8).Branch(Amx_Opcode::Jump, "Sum_Loop");
+        builder.Label("Sum_Done").Op(Amx_Opcode::Push_S, -4).Op(Amx_Opcode::Push_C, 4).Op(Amx_Opcode::Sysreq_C, 0)
+            .Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Retn);
+
+        builder.Label("Div").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Load_S_Pri, 12).Op(Amx_Opcode::Load_S_Alt, 16).Op(Amx_Opcode::Sdiv).Op(Amx_Opcode::Retn);
+
+        builder.Label("Sw").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Load_S_Pri, 12).Branch(Amx_Opcode::Switch, "Sw_Table");
+        builder.Label("Sw_1").Op(Amx_Opcode::Const_Pri, 100).Op(Amx_Opcode::Retn);
+        builder.Label("Sw_5").Op(Amx_Opcode::Const_Pri, 200).Op(Amx_Opcode::Retn);
+        builder.Label("Sw_Default").Op(Amx_Opcode::Const_Pri, -1).Op(Amx_Opcode::Retn);
+        builder.Label("Sw_Table").Op(Amx_Opcode::Casetbl, 2).Ref("Sw_Default").Value(1).Ref("Sw_1").Value(5).Ref("Sw_5");
+
+        builder.Label("Call").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_S, 12).Op(Amx_Opcode::Push_C, 4).Branch(Amx_Opcode::Call, "Sum").Op(Amx_Opcode::Retn);
+
+        builder.Main("main").Public("Call", "Call").Public("Div", "Div").Public("Sum", "Sum").Public("Sw", "Sw").Native("Twice").Data(std::vector<cell>(4, 0));
+
+        return builder;
+    }
+
+    void Run(const std::vector<unsigned char>& image) {
+        using namespace Samp_SDK::Testing;
+
+        Mock_Host& host = Mock_Host::Instance();
+        AMX* amx = host.Load_Amx_Image(image.data(), image.size());
+        SAMP_SDK_CHECK(amx != nullptr);
+
+        if (!amx)
+            return;
+
+        cell result = 0;
+        SAMP_SDK_CHECK(host.Exec_Main(amx, &result) == static_cast<int>(Amx_Error::NotFound));
+
+        static const AMX_NATIVE_INFO natives[] = {{"Twice", &Twice}};
+        SAMP_SDK_CHECK(host.Register_Natives(amx, natives, 1) == 0);
+
+        cell stk = amx->stk;
+        cell hea = amx->hea;
+
+        SAMP_SDK_CHECK(host.Exec_Main(amx, &result) == 0 && result == 7);
+
+        Mock_Call_Result sum = host.Call_Public(amx, "Sum", 10);
+        SAMP_SDK_CHECK(sum.Ok() && sum.value == 110);
+
+        Mock_Call_Result call = host.Call_Public(amx, "Call", 4);
+        SAMP_SDK_CHECK(call.Ok() && call.value == 20);
+
+        Mock_Call_Result div = host.Call_Public(amx, "Div", -7, 2);
+        SAMP_SDK_CHECK(div.Ok() && div.value == -4);
+        SAMP_SDK_CHECK(host.Call_Public(amx, "Div", 7, 0).error == static_cast<int>(Amx_Error::Divide));
+
+        SAMP_SDK_CHECK(host.Call_Public(amx, "Sw", 1).value == 100);
+        SAMP_SDK_CHECK(host.Call_Public(amx, "Sw", 5).value == 200);
+        SAMP_SDK_CHECK(host.Call_Public(amx, "Sw", 3).value == -1);
+        SAMP_SDK_CHECK(amx->stk == stk && amx->hea == hea);
+
+        amx->debug = &Count_Breaks;
+        breaks = 0;
+        host.Call_Public(amx, "Sum", 3);
+        SAMP_SDK_CHECK(breaks == 4);
+        amx->debug = nullptr;
+
+        host.Destroy_Amx(amx);
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+
+    Amx_Image_Builder builder = Make_Script();
+    std::vector<unsigned char> plain = builder.Build();
+    std::vector<unsigned char> compact = builder.Build(true);
+
+    SAMP_SDK_CHECK(compact.size() < plain.size());
+
+    Run(plain);
+    Run(compact);
+
+    AMX* amx = host.Load_Amx_Image(plain.data(), plain.size());
+    SAMP_SDK_CHECK(amx != nullptr && host.Register_Native_Stubs(amx) == 1);
+
+    if (amx)
+        SAMP_SDK_CHECK(host.Call_Public(amx, "Sum", 10).value == 0);
+
+    host.Shutdown();
+
+    return Test_Result("interpreter_test");
+}
\ No newline at end of file
@@ -0,0 +1,586 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+//
+#include "../sdk/amx/amx_jit.hpp"
+#include "../sdk/amx/amx_sysreq.hpp"
+#include "../sdk/testing/amx_interpreter.hpp"
+#include "amx_fixture.hpp"
+#include "test_check.hpp"
+
+namespace {
+    using Samp_SDK::Amx_Opcode;
+
+    constexpr cell GLOBAL_ARRAY = 16 * sizeof(cell);
+    constexpr int GLOBAL_CELLS = 64;
+    constexpr int RANDOM_FUNCTIONS = 200;
+    constexpr cell BENCH_ITERATIONS = 2000000;
+
+    class Random {
+        public:
+            explicit Random(uint32_t seed) : state_(seed ? seed : 1) {}
+
+            uint32_t Next() {
+                state_ ^= state_ << 13;
+                state_ ^= state_ >> 17;
+                state_ ^= state_ << 5;
+
+                return state_;
+            }
+
+            int Range(int low, int high) {
+                return low + static_cast<int>(Next() % static_cast<uint32_t>(high - low + 1));
+            }
+
+            double Unit() {
+                return static_cast<double>(Next()) / 4294967296.0;
+            }
+
+            template<typename T, size_t N>
+            T Pick(const T (&values)[N]) {
+                return values[Next() % N];
+            }
+
+        private:
+            uint32_t state_;
+    };
+
+    bool nap_sleep = false;
+    int failures_reported = 0;
+    std::vector<std::string> publics;
+    cell fake_opcodes[Samp_SDK::AMX_OPCODE_COUNT];
+    Samp_SDK::Detail::Jit_Meter unlimited{INT64_MAX, 0, static_cast<cell>(Amx_Error::Exit)};
+
+    cell SAMP_SDK_CDECL Twice(AMX* amx, cell* params) {
+        (void)amx;
+
+        return params[1] * 2;
+    }
+
+    cell SAMP_SDK_CDECL Nap(AMX* amx, cell* params) {
+        if (nap_sleep)
+            amx->error = static_cast<int>(Amx_Error::Sleep);
+
+        return params[1] + 1;
+    }
+
+    int SAMP_SDK_CDECL Native_Callback(AMX* amx, cell index, cell* result, cell* params) {
+        auto* hdr = reinterpret_cast<AMX_HEADER*>(amx->base);
+        auto* natives = reinterpret_cast<AMX_FUNCSTUBNT*>(amx->base + hdr->natives);
+
+        amx->error = 0;
+        *result = reinterpret_cast<AMX_NATIVE>(natives[index].address)(amx, params);
+
+        return amx->error;
+    }
+
+    cell Random_Immediate(Random& random, Amx_Opcode opcode) {
+        static const cell sizes[] = {1, 2, 4};
+        static const cell alignments[] = {1, 2, 3, 4};
+
+        switch (opcode) {
+            case Amx_Opcode::Lodb_I:
+            case Amx_Opcode::Strb_I:
+                return random.Pick(sizes);
+            case Amx_Opcode::Lctrl:
+                return random.Range(0, 6);
+            case Amx_Opcode::Align_Pri:
+            case Amx_Opcode::Align_Alt:
+                return random.Pick(alignments);
+            case Amx_Opcode::Lidx_B:
+            case Amx_Opcode::Idxaddr_B:
+                return random.Range(0, 3);
+            case Amx_Opcode::Bounds:
+                return random.Range(0, 70);
+            default:
+                break;
+        }
+
+        const cell values[] = {0, 1, -1, 2, 3, 4, 7, 8, 12, 31, 100, -5, INT32_MAX, INT32_MIN, random.Range(-1000, 1000), random.Range(0, GLOBAL_CELLS - 1) * 4};
+
+        return random.Pick(values);
+    }
+
+    void Emit_Random_Function(Samp_SDK::Testing::Amx_Image_Builder& builder, Random& random, int index, int& next_label) {
+        static const Amx_Opcode plain[] = {
+            Amx_Opcode::Add, Amx_Opcode::Sub, Amx_Opcode::Sub_Alt, Amx_Opcode::And, Amx_Opcode::Or, Amx_Opcode::Xor, Amx_Opcode::Not, Amx_Opcode::Neg,
+            Amx_Opcode::Invert, Amx_Opcode::Smul, Amx_Opcode::Umul, Amx_Opcode::Shl, Amx_Opcode::Shr, Amx_Opcode::Sshr, Amx_Opcode::Zero_Pri, Amx_Opcode::Zero_Alt,
+            Amx_Opcode::Sign_Pri, Amx_Opcode::Sign_Alt, Amx_Opcode::Eq, Amx_Opcode::Neq, Amx_Opcode::Less, Amx_Opcode::Leq, Amx_Opcode::Grtr, Amx_Opcode::Geq,
+            Amx_Opcode::Sless, Amx_Opcode::Sleq, Amx_Opcode::Sgrtr, Amx_Opcode::Sgeq, Amx_Opcode::Inc_Pri, Amx_Opcode::Inc_Alt, Amx_Opcode::Dec_Pri, Amx_Opcode::Dec_Alt,
+            Amx_Opcode::Move_Pri, Amx_Opcode::Move_Alt, Amx_Opcode::Xchg, Amx_Opcode::Sdiv, Amx_Opcode::Sdiv_Alt, Amx_Opcode::Udiv, Amx_Opcode::Udiv_Alt, Amx_Opcode::Nop,
+            Amx_Opcode::Load_I, Amx_Opcode::Stor_I, Amx_Opcode::Lidx, Amx_Opcode::Idxaddr, Amx_Opcode::Inc_I, Amx_Opcode::Dec_I
+        };
+        static const Amx_Opcode immediate[] = {
+            Amx_Opcode::Const_Pri, Amx_Opcode::Const_Alt, Amx_Opcode::Add_C, Amx_Opcode::Smul_C, Amx_Opcode::Eq_C_Pri, Amx_Opcode::Eq_C_Alt, Amx_Opcode::Shl_C_Pri,
+            Amx_Opcode::Shl_C_Alt, Amx_Opcode::Shr_C_Pri, Amx_Opcode::Shr_C_Alt, Amx_Opcode::Bounds, Amx_Opcode::Align_Pri, Amx_Opcode::Align_Alt, Amx_Opcode::Lidx_B,
+            Amx_Opcode::Idxaddr_B, Amx_Opcode::Lodb_I, Amx_Opcode::Strb_I, Amx_Opcode::Lctrl
+        };
+        static const Amx_Opcode global[] = {
+            Amx_Opcode::Load_Pri, Amx_Opcode::Load_Alt, Amx_Opcode::Stor_Pri, Amx_Opcode::Stor_Alt, Amx_Opcode::Zero, Amx_Opcode::Inc, Amx_Opcode::Dec, Amx_Opcode::Push
+        };
+        static const Amx_Opcode local[] = {
+            Amx_Opcode::Load_S_Pri, Amx_Opcode::Load_S_Alt, Amx_Opcode::Stor_S_Pri, Amx_Opcode::Stor_S_Alt, Amx_Opcode::Inc_S, Amx_Opcode::Dec_S, Amx_Opcode::Zero_S,
+            Amx_Opcode::Push_S, Amx_Opcode::Push_Adr, Amx_Opcode::Addr_Pri, Amx_Opcode::Addr_Alt
+        };
+        static const Amx_Opcode branches[] = {
+            Amx_Opcode::Jzer, Amx_Opcode::Jnz, Amx_Opcode::Jeq, Amx_Opcode::Jneq, Amx_Opcode::Jless, Amx_Opcode::Jleq, Amx_Opcode::Jgrtr, Amx_Opcode::Jgeq,
+            Amx_Opcode::Jsless, Amx_Opcode::Jsleq, Amx_Opcode::Jsgrtr, Amx_Opcode::Jsgeq, Amx_Opcode::Jump
+        };
+        static const Amx_Opcode pops[] = {Amx_Opcode::Pop_Pri, Amx_Opcode::Pop_Alt, Amx_Opcode::Swap_Pri, Amx_Opcode::Swap_Alt};
+        static const Amx_Opcode indexing[] = {Amx_Opcode::Lidx, Amx_Opcode::Idxaddr};
+        static const Amx_Opcode blocks[] = {Amx_Opcode::Cmps, Amx_Opcode::Fill};
+        static const cell frame_offsets[] = {12, 16, -4, -8};
+        static const cell index_offsets[] = {12, 16, -4};
+        static const cell block_sizes[] = {4, 8, 16};
+
+        std::string name = "R" + std::to_string(index);
+        std::vector<std::string> pending;
+
+        publics.push_back(name);
+        builder.Public(name, name).Label(name).Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_C, 0).Op(Amx_Opcode::Push_C, 0);
+
+        for (int count = random.Range(5, 40); count > 0; --count) {
+            double roll = random.Unit();
+
+            if (roll < 0.35)
+                builder.Op(random.Pick(plain));
+            else if (roll < 0.6) {
+                Amx_Opcode opcode = random.Pick(immediate);
+                builder.Op(opcode, Random_Immediate(random, opcode));
+            }
+            else if (roll < 0.8) {
+                Amx_Opcode opcode;
+
+                if (roll < 0.7)
+                    builder.Op(opcode = random.Pick(global), random.Range(0, GLOBAL_CELLS - 1) * 4);
+                else
+                    builder.Op(opcode = random.Pick(local), random.Pick(frame_offsets));
+
+                if (opcode == Amx_Opcode::Push || opcode == Amx_Opcode::Push_S || opcode == Amx_Opcode::Push_Adr)
+                    builder.Op(random.Unit() < 0.5 ? Amx_Opcode::Pop_Pri : Amx_Opcode::Pop_Alt);
+            }
+            else if (roll < 0.85) {
+                builder.Op(Amx_Opcode::Load_S_Pri, random.Pick(index_offsets)).Op(Amx_Opcode::Bounds, random.Range(0, 20))
+                    .Op(Amx_Opcode::Const_Alt, random.Range(0, GLOBAL_CELLS - 1) * 4).Op(random.Pick(indexing));
+
+                if (random.Unit() < 0.5)
+                    builder.Op(Amx_Opcode::Move_Alt).Op(Amx_Opcode::Const_Pri, random.Range(-9, 9)).Op(Amx_Opcode::Stor_I);
+            }
+            else if (roll < 0.9) {
+                builder.Op(random.Unit() < 0.5 ? Amx_Opcode::Push_Pri : Amx_Opcode::Push_Alt);
+
+                Amx_Opcode pop = random.Pick(pops);
+                builder.Op(pop);
+
+                if (pop == Amx_Opcode::Swap_Pri || pop == Amx_Opcode::Swap_Alt)
+                    builder.Op(Amx_Opcode::Pop_Alt);
+            }
+            else if (roll < 0.95) {
+                pending.push_back("F" + std::to_string(++next_label));
+                builder.Branch(random.Pick(branches), pending.back());
+            }
+            else
+                builder.Op(random.Unit() < 0.5 ? Amx_Opcode::Movs : random.Pick(blocks), random.Pick(block_sizes));
+
+            if (!pending.empty() && random.Unit() < 0.3) {
+                builder.Label(pending.front());
+                pending.erase(pending.begin());
+            }
+        }
+
+        for (const auto& label : pending)
+            builder.Label(label);
+
+        builder.Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Retn);
+    }
+
+    Samp_SDK::Testing::Amx_Image_Builder Make_Program(uint32_t seed) {
+        Samp_SDK::Testing::Amx_Image_Builder builder;
+        Random random(seed);
+        int next_label = 0;
+
+        builder.Op(Amx_Opcode::Halt, 0);
+        builder.Label("main").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Const_Pri, 7).Op(Amx_Opcode::Retn);
+
+        builder.Label("Sum").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_C, 0).Op(Amx_Opcode::Push_C, 1);
+        builder.Label("Sum_Loop").Op(Amx_Opcode::Break).Op(Amx_Opcode::Load_S_Pri, -8).Op(Amx_Opcode::Load_S_Alt, 12).Branch(Amx_Opcode::Jsgrtr, "Sum_Done")
+            .Op(Amx_Opcode::Load_S_Pri, -4).Op(Amx_Opcode::Load_S_Alt, -8).Op(Amx_Opcode::Add).Op(Amx_Opcode::Stor_S_Pri, -4)
+            .Op(Amx_Opcode::Inc_S, -8).Branch(Amx_Opcode::Jump, "Sum_Loop");
+        builder.Label("Sum_Done").Op(Amx_Opcode::Push_S, -4).Op(Amx_Opcode::Push_C, 4).Op(Amx_Opcode::Sysreq_C, 0)
+            .Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Retn);
+
+        builder.Label("Div").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Load_S_Pri, 12).Op(Amx_Opcode::Load_S_Alt, 16).Op(Amx_Opcode::Sdiv).Op(Amx_Opcode::Retn);
+
+        builder.Label("Sw").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Load_S_Pri, 12).Branch(Amx_Opcode::Switch, "Sw_Table");
+        builder.Label("Sw_1").Op(Amx_Opcode::Const_Pri, 100).Op(Amx_Opcode::Retn);
+        builder.Label("Sw_5").Op(Amx_Opcode::Const_Pri, 200).Op(Amx_Opcode::Retn);
+        builder.Label("Sw_Default").Op(Amx_Opcode::Const_Pri, -1).Op(Amx_Opcode::Retn);
+        builder.Label("Sw_Table").Op(Amx_Opcode::Casetbl, 2).Ref("Sw_Default").Value(1).Ref("Sw_1").Value(5).Ref("Sw_5");
+
+        builder.Label("Call").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_S, 12).Op(Amx_Opcode::Push_C, 4).Branch(Amx_Opcode::Call, "Sum").Op(Amx_Opcode::Retn);
+
+        builder.Label("Arr").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Load_S_Pri, 12).Op(Amx_Opcode::Bounds, 7).Op(Amx_Opcode::Const_Alt, GLOBAL_ARRAY)
+            .Op(Amx_Opcode::Lidx).Op(Amx_Opcode::Retn);
+
+        builder.Label("ArrSet").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Load_S_Pri, 12).Op(Amx_Opcode::Bounds, 7).Op(Amx_Opcode::Const_Alt, GLOBAL_ARRAY)
+            .Op(Amx_Opcode::Idxaddr).Op(Amx_Opcode::Move_Alt).Op(Amx_Opcode::Load_S_Pri, 16).Op(Amx_Opcode::Stor_I).Op(Amx_Opcode::Retn);
+
+        builder.Label("Bench").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_C, 0).Op(Amx_Opcode::Push_C, 0);
+        builder.Label("Bench_Loop").Op(Amx_Opcode::Load_S_Pri, -8).Op(Amx_Opcode::Load_S_Alt, 12).Branch(Amx_Opcode::Jsgeq, "Bench_Done")
+            .Op(Amx_Opcode::Load_S_Pri, -8).Op(Amx_Opcode::Const_Alt, 7).Op(Amx_Opcode::And).Op(Amx_Opcode::Bounds, 7).Op(Amx_Opcode::Const_Alt, GLOBAL_ARRAY)
+            .Op(Amx_Opcode::Lidx).Op(Amx_Opcode::Load_S_Alt, -4).Op(Amx_Opcode::Add).Op(Amx_Opcode::Stor_S_Pri, -4).Op(Amx_Opcode::Inc_S, -8)
+            .Branch(Amx_Opcode::Jump, "Bench_Loop");
+        builder.Label("Bench_Done").Op(Amx_Opcode::Load_S_Pri, -4).Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Retn);
+
+        builder.Label("Sleepy").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Load_S_Pri, 12).Op(Amx_Opcode::Push_Pri).Op(Amx_Opcode::Push_C, 4).Op(Amx_Opcode::Sysreq_C, 1)
+            .Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Add_C, 5).Op(Amx_Opcode::Push_Pri).Op(Amx_Opcode::Push_C, 4).Op(Amx_Opcode::Sysreq_C, 0)
+            .Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Retn);
+
+        builder.Label("Rec").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Load_S_Pri, 12).Branch(Amx_Opcode::Jzer, "Rec_Zero").Op(Amx_Opcode::Add_C, -1)
+            .Op(Amx_Opcode::Push_Pri).Op(Amx_Opcode::Push_C, 4).Branch(Amx_Opcode::Call, "Rec").Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Load_S_Alt, 12)
+            .Op(Amx_Opcode::Add).Op(Amx_Opcode::Retn);
+        builder.Label("Rec_Zero").Op(Amx_Opcode::Retn);
+
+        builder.Label("Str").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Const_Pri, 0).Op(Amx_Opcode::Const_Alt, 32 * 4).Op(Amx_Opcode::Movs, 16)
+            .Op(Amx_Opcode::Const_Pri, 0).Op(Amx_Opcode::Const_Alt, 32 * 4).Op(Amx_Opcode::Cmps, 16).Op(Amx_Opcode::Push_Pri)
+            .Op(Amx_Opcode::Const_Pri, 0x55).Op(Amx_Opcode::Const_Alt, 40 * 4).Op(Amx_Opcode::Fill, 12).Op(Amx_Opcode::Const_Pri, 40 * 4)
+            .Op(Amx_Opcode::Const_Alt, 0).Op(Amx_Opcode::Cmps, 8).Op(Amx_Opcode::Pop_Alt).Op(Amx_Opcode::Add).Op(Amx_Opcode::Retn);
+
+        builder.Label("Heap").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Heap, 16).Op(Amx_Opcode::Move_Pri).Op(Amx_Opcode::Move_Alt).Op(Amx_Opcode::Load_S_Pri, 12)
+            .Op(Amx_Opcode::Stor_I).Op(Amx_Opcode::Load_I).Op(Amx_Opcode::Heap, -16).Op(Amx_Opcode::Retn);
+
+        builder.Label("Jp").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_C, 0).Op(Amx_Opcode::Load_S_Pri, 12).Op(Amx_Opcode::Call_Pri).Op(Amx_Opcode::Retn);
+
+        publics = {"Sum", "Div", "Sw", "Call", "Arr", "ArrSet", "Bench", "Sleepy", "Rec", "Str", "Heap", "Jp"};
+
+        for (const auto& name : publics)
+            builder.Public(name, name);
+
+        for (int i = 0; i < RANDOM_FUNCTIONS; ++i)
+            Emit_Random_Function(builder, random, i, next_label);
+
+        std::vector<cell> data(GLOBAL_CELLS);
+
+        for (auto& value : data)
+            value = random.Range(-50, 50);
+
+        builder.Main("main").Native("Twice").Native("Nap").Data(data);
+        publics = builder.Get_Public_Names();
+
+        return builder;
+    }
+
+    struct Instance {
+        std::vector<unsigned char> image;
+        AMX amx;
+
+        unsigned char* Data() {
+            return image.data() + reinterpret_cast<AMX_HEADER*>(image.data())->dat;
+        }
+
+        void Init(const std::vector<unsigned char>& source) {
+            image = source;
+            image.resize(static_cast<size_t>(reinterpret_cast<const AMX_HEADER*>(source.data())->stp) + 64);
+
+            auto* hdr = reinterpret_cast<AMX_HEADER*>(image.data());
+            SAMP_SDK_CHECK(Samp_SDK::Detail::Amx_Interpreter_Prepare(hdr) == 0);
+
+            std::memset(&amx, 0, sizeof(amx));
+            amx.base = image.data();
+            amx.callback = &Native_Callback;
+            amx.flags = hdr->flags | AMX_FLAG_NTVREG;
+            amx.hea = hdr->hea - hdr->dat;
+            amx.hlw = amx.hea;
+            amx.stp = hdr->stp - hdr->dat - static_cast<cell>(sizeof(cell));
+            amx.stk = amx.stp;
+            amx.reset_stk = amx.stk;
+            amx.reset_hea = amx.hea;
+
+            auto* natives = reinterpret_cast<AMX_FUNCSTUBNT*>(amx.base + hdr->natives);
+            natives[0].address = static_cast<ucell>(reinterpret_cast<uintptr_t>(&Twice));
+            natives[1].address = static_cast<ucell>(reinterpret_cast<uintptr_t>(&Nap));
+        }
+
+        void Relocate() {
+            auto* hdr = reinterpret_cast<AMX_HEADER*>(image.data());
+            cell* code = reinterpret_cast<cell*>(image.data() + hdr->cod);
+            size_t cells = static_cast<size_t>(hdr->dat - hdr->cod) / sizeof(cell);
+            cell base = static_cast<cell>(reinterpret_cast<uintptr_t>(code));
+
+            for (int i = 0; i < Samp_SDK::AMX_OPCODE_COUNT; ++i)
+                fake_opcodes[i] = 0x40000000 + i * 32;
+
+            for (size_t cip = 0; cip < cells;) {
+                auto opcode = static_cast<Amx_Opcode>(code[cip]);
+                int size = Samp_SDK::Get_Amx_Instruction_Cells(code, cells, cip);
+
+                switch (opcode) {
+                    case Amx_Opcode::Call:
+                    case Amx_Opcode::Jump:
+                    case Amx_Opcode::Jzer:
+                    case Amx_Opcode::Jnz:
+                    case Amx_Opcode::Jeq:
+                    case Amx_Opcode::Jneq:
+                    case Amx_Opcode::Jless:
+                    case Amx_Opcode::Jleq:
+                    case Amx_Opcode::Jgrtr:
+                    case Amx_Opcode::Jgeq:
+                    case Amx_Opcode::Jsless:
+                    case Amx_Opcode::Jsleq:
+                    case Amx_Opcode::Jsgrtr:
+                    case Amx_Opcode::Jsgeq:
+                    case Amx_Opcode::Switch:
+                        code[cip + 1] += base;
+                        break;
+                    case Amx_Opcode::Casetbl:
+                        for (cell k = 0; k <= code[cip + 1]; ++k)
+                            code[cip + 2 + 2 * k] += base;
+                        break;
+                    default:
+                        break;
+                }
+
+                code[cip] = fake_opcodes[static_cast<int>(opcode)];
+                cip += static_cast<size_t>(size);
+            }
+
+            amx.flags |= AMX_FLAG_RELOC;
+        }
+
+        void Push(cell value) {
+            amx.stk -= static_cast<cell>(sizeof(cell));
+            std::memcpy(Data() + amx.stk, &value, sizeof(value));
+            amx.paramcount++;
+        }
+    };
+
+    void Report(const char* what, int index, cell a, cell b, long long interpreted, long long compiled) {
+        ++Samp_SDK::Testing::Test_Failures();
+
+        if (++failures_reported < 30)
+            std::printf("mismatch (%s) in %s a=%d b=%d: interpreter %lld, jit %lld\n", what, index >= 0 ? publics[static_cast<size_t>(index)].c_str() : "main",
+                static_cast<int>(a), static_cast<int>(b), interpreted, compiled);
+    }
+
+    int Find(const char* name) {
+        for (size_t i = 0; i < publics.size(); ++i) {
+            if (publics[i] == name)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    double Elapsed_Ms(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+int main(int argc, char** argv) {
+    using namespace Samp_SDK;
+    using namespace Samp_SDK::Detail;
+    using Clock = std::chrono::steady_clock;
+
+    uint32_t seed = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1;
+    std::vector<unsigned char> image = Make_Program(seed).Build();
+    static const cell arguments[] = {0, 1, -1, 2, 3, 5, 7, 8, 9, -100, 100, INT32_MAX, INT32_MIN};
+    int runs = 0;
+
+    for (int mode = 0; mode < 4; ++mode) {
+        Instance interpreted, compiled;
+        interpreted.Init(image);
+        compiled.Init(image);
+
+        if (mode >= 2)
+            compiled.Relocate();
+
+        if (mode == 3)
+            std::printf("sysreq sites rewritten: %d\n", Amx_Sysreq_Rewriter::Instance().Rewrite(&compiled.amx, fake_opcodes));
+
+        int error = 0;
+        Jit_Compiler compiler(&compiled.amx, mode >= 2 ? fake_opcodes : nullptr, mode != 0, true);
+        std::unique_ptr<Jit_Program> program = compiler.Compile(&error);
+
+        SAMP_SDK_CHECK(program != nullptr);
+
+        if (!program) {
+            std::printf("compile failed in mode %d with error %d\n", mode, error);
+
+            continue;
+        }
+
+        std::printf("mode %d: %zu bytes of code, %zu folded checks\n", mode, static_cast<size_t>(program->Get_Code_Size()), static_cast<size_t>(compiler.Get_Folded_Checks()));
+
+        cell r1 = 0, r2 = 0;
+        int e1 = Amx_Interpreter_Exec(&interpreted.amx, &r1, AMX_EXEC_MAIN);
+        int e2 = program->Exec(&compiled.amx, &r2, AMX_EXEC_MAIN, &unlimited);
+
+        if (e1 != e2 || r1 != r2)
+            Report("main", -1, 0, 0, e1 * 1000LL + r1, e2 * 1000LL + r2);
+
+        auto* hdr = reinterpret_cast<AMX_HEADER*>(interpreted.image.data());
+        auto* stubs = reinterpret_cast<AMX_FUNCSTUBNT*>(interpreted.image.data() + hdr->publics);
+        size_t data_size = static_cast<size_t>(hdr->stp - hdr->dat);
+        int count = static_cast<int>(publics.size());
+
+        for (int p = 0; p < count; ++p) {
+            const std::string& name = publics[static_cast<size_t>(p)];
+
+            if (name == "Bench" || name == "Sleepy")
+                continue;
+
+            for (cell a : arguments) {
+                for (cell b : arguments) {
+                    cell argument = a;
+
+                    if (name == "Jp")
+                        argument = static_cast<cell>(stubs[static_cast<unsigned>(a & 0xFF) % static_cast<unsigned>(count)].address) + (b == 3 ? 4 : 0);
+
+                    if ((name == "Sum" || name == "Call" || name == "Rec") && (a < 0 || a > 100))
+                        continue;
+
+                    interpreted.Push(b);
+                    interpreted.Push(argument);
+                    compiled.Push(b);
+                    compiled.Push(argument);
+
+                    r1 = r2 = 0x1234;
+                    e1 = Amx_Interpreter_Exec(&interpreted.amx, &r1, p);
+                    e2 = program->Exec(&compiled.amx, &r2, p, &unlimited);
+                    ++runs;
+
+                    if (e1 != e2)
+                        Report("error", p, argument, b, e1, e2);
+                    else if (e1 == 0 && r1 != r2)
+                        Report("return value", p, argument, b, r1, r2);
+
+                    if (interpreted.amx.frm != compiled.amx.frm) {
+                        Report("frm", p, argument, b, interpreted.amx.frm, compiled.amx.frm);
+                        compiled.amx.frm = interpreted.amx.frm;
+                    }
+
+                    if (interpreted.amx.stk != compiled.amx.stk || interpreted.amx.hea != compiled.amx.hea)
+                        Report("stk/hea", p, argument, b, interpreted.amx.stk, compiled.amx.stk);
+
+                    if (std::memcmp(interpreted.Data(), compiled.Data(), data_size) != 0) {
+                        Report("memory", p, argument, b, e1, e2);
+                        std::memcpy(compiled.Data(), interpreted.Data(), data_size);
+                    }
+                }
+            }
+        }
+
+        int sleepy = Find("Sleepy");
+
+        for (int way = 0; way < 2; ++way) {
+            interpreted.Push(3);
+            compiled.Push(3);
+            nap_sleep = true;
+            e1 = Amx_Interpreter_Exec(&interpreted.amx, &r1, sleepy);
+            e2 = program->Exec(&compiled.amx, &r2, sleepy, &unlimited);
+
+            if (e1 != static_cast<int>(Amx_Error::Sleep) || e2 != e1 || interpreted.amx.pri != compiled.amx.pri || interpreted.amx.cip != compiled.amx.cip || interpreted.amx.stk != compiled.amx.stk)
+                Report("sleep", sleepy, way, 0, interpreted.amx.pri * 1000LL + e1, compiled.amx.pri * 1000LL + e2);
+
+            nap_sleep = false;
+            r1 = r2 = 0;
+
+            if (way == 0 && mode < 2) {
+                e1 = program->Exec(&interpreted.amx, &r1, AMX_EXEC_CONT, &unlimited);
+                e2 = Amx_Interpreter_Exec(&compiled.amx, &r2, AMX_EXEC_CONT);
+            }
+            else {
+                e1 = Amx_Interpreter_Exec(&interpreted.amx, &r1, AMX_EXEC_CONT);
+                e2 = program->Exec(&compiled.amx, &r2, AMX_EXEC_CONT, &unlimited);
+            }
+
+            if (e1 || e2 || r1 != 18 || r2 != 18 || interpreted.amx.stk != compiled.amx.stk || interpreted.amx.stk != interpreted.amx.stp)
+                Report("continue", sleepy, way, 0, r1 * 1000LL + e1, r2 * 1000LL + e2);
+        }
+
+        int bench = Find("Bench");
+        interpreted.Push(BENCH_ITERATIONS);
+        auto t0 = Clock::now();
+        e1 = Amx_Interpreter_Exec(&interpreted.amx, &r1, bench);
+        auto t1 = Clock::now();
+        compiled.Push(BENCH_ITERATIONS);
+        e2 = program->Exec(&compiled.amx, &r2, bench, &unlimited);
+        auto t2 = Clock::now();
+
+        if (e1 || e2 || r1 != r2)
+            Report("bench", bench, 0, 0, r1, r2);
+
+        std::printf("mode %d: bench interpreter %.1f ms, jit %.1f ms\n", mode, Elapsed_Ms(t0, t1), Elapsed_Ms(t1, t2));
+    }
+
+    Instance metered;
+    metered.Init(image);
+
+    int error = 0;
+    Jit_Compiler compiler(&metered.amx, nullptr, true, true);
+    std::unique_ptr<Jit_Program> program = compiler.Compile(&error);
+    SAMP_SDK_CHECK(program != nullptr);
+
+    if (program) {
+        int bench = Find("Bench");
+        cell result = 0;
+
+        for (int k = 0; k < 3; ++k) {
+            Jit_Meter meter{k == 2 ? INT64_MAX : 5000, 0, static_cast<cell>(Amx_Error::Exit)};
+            metered.Push(BENCH_ITERATIONS);
+            int e = program->Exec(&metered.amx, &result, bench, &meter);
+
+            if (k < 2)
+                SAMP_SDK_CHECK(e == static_cast<int>(Amx_Error::Exit) && meter.remaining < 0 && metered.amx.stk == metered.amx.stp);
+            else
+                SAMP_SDK_CHECK(e == 0);
+        }
+
+        Jit_Meter meter{5000, 0, static_cast<cell>(Amx_Error::Exit)};
+        metered.Push(BENCH_ITERATIONS);
+        program->Exec(&metered.amx, &result, bench, &meter);
+        metered.Push(1);
+        SAMP_SDK_CHECK(program->Exec(&metered.amx, &result, bench, &meter) == static_cast<int>(Amx_Error::Exit));
+    }
+
+    std::printf("%d differential runs\n", runs);
+
+    return Samp_SDK::Testing::Test_Result("jit_differential_test");
+}
\ No newline at end of file
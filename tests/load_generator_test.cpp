@@ -0,0 +1,134 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#include <cstring>
+#include <string>
+//
+#include "../sdk/testing/load_generator.hpp"
+#include "test_check.hpp"
+
+namespace {
+    int connects = 0;
+    int updates = 0;
+    int commands = 0;
+    int bad_players = 0;
+    std::string last_command;
+
+    unsigned int SAMP_SDK_CALL Test_Supports() {
+        return SUPPORTS_VERSION | SUPPORTS_AMX_NATIVES | SUPPORTS_PROCESS_TICK;
+    }
+
+    bool SAMP_SDK_CALL Test_Load(void**) {
+        return true;
+    }
+
+    void SAMP_SDK_CALL Test_Unload() {}
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+
+    Mock_Plugin_Exports exports;
+    exports.supports = &Test_Supports;
+    exports.load = &Test_Load;
+    exports.unload = &Test_Unload;
+    SAMP_SDK_CHECK(host.Attach_Plugin(exports));
+
+    Mock_Script script;
+    script.publics.push_back({"OnPlayerConnect", [](AMX*, cell*) { return static_cast<cell>(++connects > 0); }});
+    script.publics.push_back({"OnPlayerUpdate", [](AMX*, cell* params) {
+        if (params[1] < 0 || params[1] >= 100)
+            ++bad_players;
+
+        ++updates;
+
+        return static_cast<cell>(1);
+    }});
+    script.publics.push_back({"OnPlayerCommandText", [](AMX* amx, cell* params) {
+        cell* text = nullptr;
+        char buffer[64];
+
+        Samp_SDK::Detail::Mock_Amx_Get_Addr(amx, params[2], &text);
+        Samp_SDK::Detail::Mock_Amx_Get_String(buffer, text, 0, sizeof(buffer));
+        last_command = buffer;
+        ++commands;
+
+        return static_cast<cell>(1);
+    }});
+
+    AMX* amx = host.Create_Amx(Load_Generator::Make_Script(script));
+    SAMP_SDK_CHECK(amx != nullptr);
+
+    if (!amx)
+        return Test_Result("load_generator_test");
+
+    host.Exec_Main(amx);
+
+    cell stk = amx->stk;
+    cell hea = amx->hea;
+
+    Load_Profile profile;
+    profile.players = 100;
+    profile.ticks = 500;
+    profile.seed = 7;
+
+    Load_Report first = Load_Generator(amx, profile).Run();
+
+    SAMP_SDK_CHECK(first.players == 100);
+    SAMP_SDK_CHECK(first.ticks == 500);
+    SAMP_SDK_CHECK(first.callbacks > 0);
+    SAMP_SDK_CHECK(connects == 100);
+    SAMP_SDK_CHECK(bad_players == 0);
+    SAMP_SDK_CHECK(updates > 0 && static_cast<uint64_t>(updates) == first.stats[static_cast<size_t>(Load_Callback::Player_Update)].calls);
+    SAMP_SDK_CHECK(static_cast<uint64_t>(commands) == first.stats[static_cast<size_t>(Load_Callback::Command_Text)].calls);
+    SAMP_SDK_CHECK(commands == 0 || last_command.compare(0, 1, "/") == 0);
+    SAMP_SDK_CHECK(amx->stk == stk && amx->hea == hea);
+
+    for (const auto& entry : first.stats)
+        SAMP_SDK_CHECK(entry.errors == 0);
+
+    Load_Report second = Load_Generator(amx, profile).Run();
+
+    SAMP_SDK_CHECK(second.stats.size() == first.stats.size());
+
+    for (size_t i = 0; i < first.stats.size() && i < second.stats.size(); ++i)
+        SAMP_SDK_CHECK(first.stats[i].calls == second.stats[i].calls);
+
+    first.Print();
+    host.Shutdown();
+
+    return Test_Result("load_generator_test");
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#define SAMP_SDK_WANT_PROCESS_TICK
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+//
+#include "../sdk/scheduling/main_thread.hpp"
+#include "test_check.hpp"
+
+namespace {
+    std::atomic<int> live_tasks{0};
+
+    struct Tracked {
+        Tracked() {
+            ++live_tasks;
+        }
+
+        Tracked(const Tracked&) {
+            ++live_tasks;
+        }
+
+        ~Tracked() {
+            --live_tasks;
+        }
+    };
+}
+
+int main() {
+    using Samp_SDK::Detail::Main_Thread_Queue;
+
+    Main_Thread_Queue& queue = Main_Thread_Queue::Instance();
+    std::vector<int> order;
+
+    Samp_SDK::Main_Thread::Post([&order] { order.push_back(1); });
+    Samp_SDK::Main_Thread::Post([tracked = Tracked()] { throw std::runtime_error("task failure"); });
+    Samp_SDK::Main_Thread::Post([&order] { order.push_back(2); });
+    Samp_SDK::Main_Thread::Post([&order] { order.push_back(3); });
+
+    SAMP_SDK_CHECK(Samp_SDK::Main_Thread::Get_Pending_Count() == 4);
+
+    queue.Process();
+
+    SAMP_SDK_CHECK((order == std::vector<int>{1, 2, 3}));
+    SAMP_SDK_CHECK(Samp_SDK::Main_Thread::Get_Pending_Count() == 0);
+    SAMP_SDK_CHECK(live_tasks == 0);
+
+    std::atomic<int> executed{0};
+    std::vector<std::thread> producers;
+
+    for (int t = 0; t < 4; ++t) {
+        producers.emplace_back([&executed] {
+            for (int i = 0; i < 10000; ++i)
+                Samp_SDK::Main_Thread::Post([&executed] { ++executed; });
+        });
+    }
+
+    while (executed < 40000) {
+        queue.Process();
+        std::this_thread::yield();
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+
+    queue.Process();
+    SAMP_SDK_CHECK(executed == 40000);
+    SAMP_SDK_CHECK(Samp_SDK::Main_Thread::Get_Pending_Count() == 0);
+
+    Samp_SDK::Main_Thread::Set_Budget(std::chrono::microseconds(1000));
+
+    for (int i = 0; i < 100; ++i)
+        Samp_SDK::Main_Thread::Post([] { std::this_thread::sleep_for(std::chrono::microseconds(200)); });
+
+    queue.Process();
+    size_t left = Samp_SDK::Main_Thread::Get_Pending_Count();
+    SAMP_SDK_CHECK(left > 0 && left < 100);
+
+    queue.Clear();
+    SAMP_SDK_CHECK(Samp_SDK::Main_Thread::Get_Pending_Count() == 0);
+
+    return Samp_SDK::Testing::Test_Result("main_thread_test");
+}
\ No newline at end of file
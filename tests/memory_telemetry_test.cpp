@@ -0,0 +1,137 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#include <string>
+#include <vector>
+//
+#include "../sdk/samp_sdk.hpp"
+#include "../sdk/testing/mock_host.hpp"
+#include "amx_fixture.hpp"
+#include "test_check.hpp"
+
+namespace {
+    bool Log_Contains(const char* first, const char* second) {
+        for (const std::string& line : Samp_SDK::Testing::Mock_Host::Instance().Get_Log()) {
+            if (line.find(first) != std::string::npos && line.find(second) != std::string::npos)
+                return true;
+        }
+
+        return false;
+    }
+
+    Samp_SDK::Testing::Amx_Image_Builder Make_Script() {
+        using Samp_SDK::Amx_Opcode;
+
+        Samp_SDK::Testing::Amx_Image_Builder builder;
+
+        builder.Op(Amx_Opcode::Halt, 0);
+        builder.Label("main").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Const_Pri, 7).Op(Amx_Opcode::Retn);
+        builder.Label("Small").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Const_Pri, 1).Op(Amx_Opcode::Retn);
+        builder.Label("Deep").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Stack, -400).Op(Amx_Opcode::Addr_Alt, -400).Op(Amx_Opcode::Const_Pri, 1)
+            .Op(Amx_Opcode::Fill, 400).Op(Amx_Opcode::Stack, 400).Op(Amx_Opcode::Retn);
+        builder.Label("Heap").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Heap, 64).Op(Amx_Opcode::Const_Pri, 1).Op(Amx_Opcode::Fill, 64)
+            .Op(Amx_Opcode::Heap, -64).Op(Amx_Opcode::Retn);
+
+        builder.Main("main").Public("Deep", "Deep").Public("Heap", "Heap").Public("Small", "Small");
+
+        return builder;
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+    using Samp_SDK::Amx_Memory_Stats;
+    using Samp_SDK::Memory_Telemetry;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+    Samp_SDK::Core::Instance().Load(host.Get_Plugin_Data());
+    Samp_SDK::Detail::Interceptor_Manager::Instance().Activate();
+
+    std::vector<unsigned char> image = Make_Script().Build();
+    AMX* amx = host.Load_Amx_Image(image.data(), image.size());
+    SAMP_SDK_CHECK(amx != nullptr);
+
+    if (!amx)
+        return Test_Result("memory_telemetry_test");
+
+    Samp_SDK::Amx_Manager::Instance().Add_Amx(amx);
+
+    Memory_Telemetry& telemetry = Memory_Telemetry::Instance();
+    Amx_Memory_Stats stats;
+
+    SAMP_SDK_CHECK(host.Call_Public(amx, "Small").Ok());
+    SAMP_SDK_CHECK(!telemetry.Get_Stats(amx, stats));
+
+    telemetry.Start();
+
+    SAMP_SDK_CHECK(host.Call_Public(amx, "Small").Ok());
+    SAMP_SDK_CHECK(telemetry.Get_Stats(amx, stats));
+    SAMP_SDK_CHECK(stats.amx == amx && stats.calls == 1);
+    SAMP_SDK_CHECK(stats.stack_heap_size == amx->stp - amx->hlw);
+    SAMP_SDK_CHECK(stats.stack_peak < 400 && stats.heap_peak < 64);
+
+    SAMP_SDK_CHECK(host.Call_Public(amx, "Deep").Ok());
+    SAMP_SDK_CHECK(host.Call_Public(amx, "Heap").Ok());
+    SAMP_SDK_CHECK(telemetry.Get_Stats(amx, stats));
+    SAMP_SDK_CHECK(stats.calls == 3);
+    SAMP_SDK_CHECK(stats.stack_peak >= 400 && stats.heap_peak >= 64);
+
+    telemetry.Check_Leaks();
+    SAMP_SDK_CHECK(telemetry.Get_Stats(amx, stats) && stats.heap_leaks == 0);
+
+    cell address = 0;
+    cell* physical = nullptr;
+    SAMP_SDK_CHECK(host.Get_Export<Samp_SDK::amx::Allot_t>(PLUGIN_AMX_EXPORT_Allot)(amx, 4, &address, &physical) == 0);
+
+    telemetry.Tick();
+    telemetry.Check_Leaks();
+    SAMP_SDK_CHECK(telemetry.Get_Stats(amx, stats));
+    SAMP_SDK_CHECK(stats.heap_leaks == 1 && stats.leaked_bytes == 16 && stats.last_leak == "Heap");
+    SAMP_SDK_CHECK(Log_Contains("still holds 16 heap bytes", "'Heap'"));
+
+    host.Get_Export<Samp_SDK::amx::Release_t>(PLUGIN_AMX_EXPORT_Release)(amx, address);
+
+    telemetry.Log_Summary();
+    SAMP_SDK_CHECK(Log_Contains("Memory:", "suggested #pragma dynamic"));
+    SAMP_SDK_CHECK(Log_Contains("Memory:", "leaked heap 1 time(s)"));
+
+    telemetry.Stop();
+    telemetry.Release(amx);
+    SAMP_SDK_CHECK(!telemetry.Get_Stats(amx, stats));
+
+    Samp_SDK::Detail::Interceptor_Manager::Instance().Deactivate();
+    host.Shutdown();
+
+    return Test_Result("memory_telemetry_test");
+}
\ No newline at end of file
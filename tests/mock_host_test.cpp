@@ -0,0 +1,191 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#define SAMP_SDK_IMPLEMENTATION
+#define SAMP_SDK_WANT_AMX_EVENTS
+#define SAMP_SDK_WANT_PROCESS_TICK
+
+#include <cstring>
+#include <string>
+//
+#include "../sdk/samp_sdk.hpp"
+#include "../sdk/testing/mock_host.hpp"
+#include "test_check.hpp"
+
+namespace {
+    int loads = 0;
+    int amx_loads = 0;
+    int amx_unloads = 0;
+    int ticks = 0;
+    int connects = 0;
+    int hooked_calls = 0;
+    std::string last_text;
+
+    cell SAMP_SDK_CDECL Host_Add(AMX* amx, cell* params) {
+        (void)amx;
+
+        return params[1] + params[2];
+    }
+
+    cell SAMP_SDK_CDECL Host_Length(AMX* amx, cell* params) {
+        return static_cast<cell>(Samp_SDK::Get_String(amx, params[1]).size());
+    }
+}
+
+bool OnLoad() {
+    ++loads;
+
+    return true;
+}
+
+void OnUnload() {}
+
+unsigned int GetSupportFlags() {
+    return SUPPORTS_VERSION;
+}
+
+void OnAmxLoad(AMX* amx) {
+    (void)amx;
+    ++amx_loads;
+}
+
+void OnAmxUnload(AMX* amx) {
+    (void)amx;
+    ++amx_unloads;
+}
+
+void OnProcessTick() {
+    ++ticks;
+}
+
+Plugin_Native(Test_Multiply, AMX* amx, cell* params) {
+    int a = 0, b = 0;
+    Register_Parameters(a, b);
+
+    return a * b;
+}
+
+Plugin_Public(OnPlayerConnect, int playerid) {
+    connects += playerid;
+
+    return PUBLIC_CONTINUE;
+}
+
+Plugin_Public(OnPlayerText, int playerid, std::string text) {
+    (void)playerid;
+    last_text = text;
+
+    return PUBLIC_CONTINUE;
+}
+
+Plugin_Native_Hook(Host_Add, AMX* amx, cell* params) {
+    ++hooked_calls;
+
+    return Call_Original_Native(Host_Add) + 1000;
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+
+    Mock_Plugin_Exports exports;
+    exports.supports = &::Supports;
+    exports.load = &::Load;
+    exports.unload = &::Unload;
+    exports.amx_load = &::AmxLoad;
+    exports.amx_unload = &::AmxUnload;
+    exports.process_tick = &::ProcessTick;
+
+    SAMP_SDK_CHECK(host.Attach_Plugin(exports));
+    SAMP_SDK_CHECK(loads == 1);
+
+    Mock_Script script;
+    script.natives = {"Host_Add", "Host_Length", "Test_Multiply"};
+    script.publics.push_back({"OnPlayerConnect", [](AMX*, cell* params) { return params[1] * 2; }});
+    script.publics.push_back({"OnPlayerText", [](AMX*, cell*) { return static_cast<cell>(1); }});
+    script.publics.push_back({"OnScriptAdd", [](AMX* amx, cell* params) { return Mock_Host::Instance().Call_Native(amx, "Host_Add", params[1], params[2]).value; }});
+    script.publics.push_back({"OnScriptMultiply", [](AMX* amx, cell* params) { return Mock_Host::Instance().Call_Native(amx, "Test_Multiply", params[1], params[2]).value; }});
+
+    AMX* amx = host.Create_Amx(script);
+    SAMP_SDK_CHECK(amx != nullptr);
+    SAMP_SDK_CHECK(amx_loads == 1);
+
+    if (!amx)
+        return Test_Result("mock_host_test");
+
+    static const AMX_NATIVE_INFO natives[] = {
+        {"Host_Add", &Host_Add},
+        {"Host_Length", &Host_Length},
+    };
+
+    SAMP_SDK_CHECK(host.Register_Natives(amx, natives, 2) == 0);
+    SAMP_SDK_CHECK(host.Exec_Main(amx) == static_cast<int>(Amx_Error::None));
+
+    cell stk = amx->stk;
+    cell hea = amx->hea;
+
+    Mock_Call_Result connect = host.Call_Public(amx, "OnPlayerConnect", 21);
+    SAMP_SDK_CHECK(connect.Ok() && connect.value == 42);
+    SAMP_SDK_CHECK(connects == 21);
+
+    SAMP_SDK_CHECK(host.Call_Public(amx, "OnPlayerText", 3, "hello world").Ok());
+    SAMP_SDK_CHECK(last_text == "hello world");
+
+    Mock_Call_Result add = host.Call_Public(amx, "OnScriptAdd", 2, 3);
+    SAMP_SDK_CHECK(add.Ok() && add.value == 1005);
+    SAMP_SDK_CHECK(hooked_calls == 1);
+
+    Mock_Call_Result multiply = host.Call_Public(amx, "OnScriptMultiply", 6, 7);
+    SAMP_SDK_CHECK(multiply.Ok() && multiply.value == 42);
+
+    SAMP_SDK_CHECK(Pawn_Native(Host_Length, "abcdef").Value() == 6);
+    SAMP_SDK_CHECK(Pawn_Native(Host_Add, 40, 2).Value() == 1042);
+    SAMP_SDK_CHECK(hooked_calls == 2);
+    SAMP_SDK_CHECK(Pawn_Public(OnPlayerConnect, 5).Value() == 10);
+    SAMP_SDK_CHECK(Plugin_Call(Test_Multiply, 3, 4) == 12);
+
+    SAMP_SDK_CHECK(!host.Call_Public(amx, "OnMissingPublic").Ok());
+    SAMP_SDK_CHECK(amx->stk == stk && amx->hea == hea);
+
+    for (int i = 0; i < 10; ++i)
+        host.Process_Tick();
+
+    SAMP_SDK_CHECK(ticks == 10);
+
+    host.Shutdown();
+    SAMP_SDK_CHECK(amx_unloads == 1);
+
+    return Test_Result("mock_host_test");
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+
+#include <string>
+#include <vector>
+//
+#include "../sdk/samp_sdk.hpp"
+#include "../sdk/testing/mock_host.hpp"
+#include "test_check.hpp"
+
+namespace {
+    const char* const MODULE_PATH = "modules";
+
+    Samp_SDK::amx::Register_t mock_register = nullptr;
+
+    int SAMP_SDK_CDECL Register_Detour(AMX* amx, const AMX_NATIVE_INFO* nativelist, int number) {
+        Samp_SDK::Detail::Interceptor_Manager::Instance().Update_Native_Cache(nativelist, number);
+
+        return mock_register(amx, nativelist, number);
+    }
+
+    int Find_Log_Line(const std::string& text) {
+        std::vector<std::string> log = Samp_SDK::Testing::Mock_Host::Instance().Get_Log();
+
+        for (size_t i = 0; i < log.size(); ++i) {
+            if (log[i].find(text) != std::string::npos)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+    using Samp_SDK::Detail::Module_Manager;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+
+    void** plugin_data = host.Get_Plugin_Data();
+    void** amx_exports = static_cast<void**>(plugin_data[PLUGIN_DATA_AMX_EXPORTS]);
+    mock_register = reinterpret_cast<Samp_SDK::amx::Register_t>(amx_exports[PLUGIN_AMX_EXPORT_Register]);
+    amx_exports[PLUGIN_AMX_EXPORT_Register] = reinterpret_cast<void*>(&Register_Detour);
+    Samp_SDK::Core::Instance().Load(plugin_data);
+
+    Module_Manager& manager = Module_Manager::Instance();
+
+    manager.Declare_Module("beta", MODULE_PATH, {"alpha"});
+    manager.Declare_Module("alpha", MODULE_PATH);
+    manager.Declare_Module("orphan", MODULE_PATH, {"missing"});
+
+    SAMP_SDK_CHECK(!manager.Load_Declared_Modules(plugin_data));
+    SAMP_SDK_CHECK(Find_Log_Line("test module alpha: load") >= 0);
+    SAMP_SDK_CHECK(Find_Log_Line("test module alpha: load") < Find_Log_Line("test module beta: load"));
+    SAMP_SDK_CHECK(Find_Log_Line("'orphan' was not loaded because its dependency 'missing'") >= 0);
+    SAMP_SDK_CHECK(Find_Log_Line("test module orphan: load") < 0);
+
+    SAMP_SDK_CHECK(manager.Declare_Lazy_Module("gamma", MODULE_PATH, {"Gamma_Native"}, plugin_data));
+    SAMP_SDK_CHECK(manager.Declare_Lazy_Module("absent", MODULE_PATH, {"Absent_Native"}, plugin_data));
+
+    Mock_Script script;
+    script.natives = {"Gamma_Native", "Absent_Native"};
+    AMX* amx = host.Create_Amx(script);
+    SAMP_SDK_CHECK(amx != nullptr);
+
+    if (amx) {
+        Samp_SDK::Amx_Manager::Instance().Add_Amx(amx);
+        manager.Forward_AmxLoad(amx);
+
+        SAMP_SDK_CHECK(Find_Log_Line("test module gamma: load") < 0);
+
+        Mock_Call_Result first = host.Call_Native(amx, "Gamma_Native", 7);
+        SAMP_SDK_CHECK(first.Ok() && first.value == 35);
+        SAMP_SDK_CHECK(Find_Log_Line("test module gamma: load") >= 0);
+
+        Mock_Call_Result second = host.Call_Native(amx, "Gamma_Native", 8);
+        SAMP_SDK_CHECK(second.Ok() && second.value == 40);
+
+        Mock_Call_Result absent = host.Call_Native(amx, "Absent_Native", 1);
+        SAMP_SDK_CHECK(absent.error == static_cast<int>(Amx_Error::NotFound));
+        SAMP_SDK_CHECK(Find_Log_Line("Lazy module 'absent' could not be loaded") >= 0);
+    }
+
+    host.Clear_Log();
+    manager.Unload_All_Modules();
+
+    SAMP_SDK_CHECK(Find_Log_Line("test module gamma: unload") >= 0);
+    SAMP_SDK_CHECK(Find_Log_Line("test module beta: unload") >= 0);
+    SAMP_SDK_CHECK(Find_Log_Line("test module beta: unload") < Find_Log_Line("test module alpha: unload"));
+
+    host.Shutdown();
+
+    return Test_Result("module_manager_test");
+}
\ No newline at end of file
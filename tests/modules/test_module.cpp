@@ -0,0 +1,108 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+//
+#include "../../sdk/amx/amx_defs.h"
+#include "../../sdk/core/platform.hpp"
+#include "../../sdk/core/plugin_defs.h"
+
+namespace {
+    using Logprintf_t = void (*)(const char* format, ...);
+    using Register_t = int (SAMP_SDK_CDECL *)(AMX* amx, const AMX_NATIVE_INFO* nativelist, int number);
+
+    struct State_Writer {
+        void* context;
+        void (SAMP_SDK_CDECL* write)(void* context, const void* data, uint32_t size);
+    };
+
+    void** plugin_data = nullptr;
+    cell calls = 0;
+
+    void Module_Log(const char* event) {
+        reinterpret_cast<Logprintf_t>(plugin_data[PLUGIN_DATA_LOGPRINTF])("test module %s: %s", TEST_MODULE_NAME, event);
+    }
+
+    cell SAMP_SDK_CDECL Module_Native(AMX* amx, cell* params) {
+        (void)amx;
+        ++calls;
+
+        return params[1] * TEST_MODULE_FACTOR;
+    }
+}
+
+SAMP_SDK_EXPORT unsigned int SAMP_SDK_CALL Supports() {
+    return SUPPORTS_VERSION | SUPPORTS_AMX_NATIVES;
+}
+
+SAMP_SDK_EXPORT bool SAMP_SDK_CALL Load(void** ppData) {
+    plugin_data = ppData;
+    Module_Log("load");
+
+    return true;
+}
+
+SAMP_SDK_EXPORT void SAMP_SDK_CALL Unload() {
+    Module_Log("unload");
+}
+
+SAMP_SDK_EXPORT void SAMP_SDK_CALL AmxLoad(AMX* amx) {
+    static const AMX_NATIVE_INFO natives[] = {{TEST_MODULE_NATIVE, &Module_Native}};
+    auto exports = static_cast<void**>(plugin_data[PLUGIN_DATA_AMX_EXPORTS]);
+
+    reinterpret_cast<Register_t>(exports[PLUGIN_AMX_EXPORT_Register])(amx, natives, 1);
+}
+
+SAMP_SDK_EXPORT int SAMP_SDK_CALL Save_State(const void* writer) {
+    const auto* state_writer = static_cast<const State_Writer*>(writer);
+
+    state_writer->write(state_writer->context, &calls, sizeof(calls));
+
+    return 1;
+}
+
+SAMP_SDK_EXPORT int SAMP_SDK_CALL Restore_State(const void* data, uint32_t size) {
+    if (size != sizeof(calls))
+        return 0;
+
+    char event[32];
+
+    std::memcpy(&calls, data, sizeof(calls));
+    std::snprintf(event, sizeof(event), "restored %d", static_cast<int>(calls));
+    Module_Log(event);
+
+    return 1;
+}
\ No newline at end of file
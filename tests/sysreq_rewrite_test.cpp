@@ -0,0 +1,131 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#include <unordered_map>
+#include <vector>
+//
+#include "../sdk/amx/amx_sysreq.hpp"
+#include "../sdk/testing/mock_host.hpp"
+#include "amx_fixture.hpp"
+#include "test_check.hpp"
+
+namespace {
+    cell SAMP_SDK_CDECL Twice(AMX* amx, cell* params) {
+        (void)amx;
+
+        return params[1] * 2;
+    }
+
+    cell SAMP_SDK_CDECL Thrice(AMX* amx, cell* params) {
+        (void)amx;
+
+        return params[1] * 3;
+    }
+
+    Samp_SDK::Testing::Amx_Image_Builder Make_Script() {
+        using Samp_SDK::Amx_Opcode;
+
+        Samp_SDK::Testing::Amx_Image_Builder builder;
+
+        builder.Op(Amx_Opcode::Halt, 0);
+        builder.Label("main").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Const_Pri, 7).Op(Amx_Opcode::Retn);
+        builder.Label("Double").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_S, 12).Op(Amx_Opcode::Push_C, 4).Op(Amx_Opcode::Sysreq_C, 0)
+            .Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Retn);
+        builder.Label("Quad").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_S, 12).Op(Amx_Opcode::Push_C, 4).Op(Amx_Opcode::Sysreq_C, 0)
+            .Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Push_Pri).Op(Amx_Opcode::Push_C, 4).Op(Amx_Opcode::Sysreq_C, 0)
+            .Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Retn);
+        builder.Label("Missing").Op(Amx_Opcode::Proc).Op(Amx_Opcode::Push_S, 12).Op(Amx_Opcode::Push_C, 4).Op(Amx_Opcode::Sysreq_C, 5)
+            .Op(Amx_Opcode::Stack, 8).Op(Amx_Opcode::Retn);
+
+        builder.Main("main").Public("Double", "Double").Public("Missing", "Missing").Public("Quad", "Quad").Native("Twice");
+
+        return builder;
+    }
+
+    void Run(const std::vector<unsigned char>& image) {
+        using namespace Samp_SDK;
+        using namespace Samp_SDK::Testing;
+
+        Mock_Host& host = Mock_Host::Instance();
+        Amx_Sysreq_Rewriter& rewriter = Amx_Sysreq_Rewriter::Instance();
+        AMX* amx = host.Load_Amx_Image(image.data(), image.size());
+        SAMP_SDK_CHECK(amx != nullptr);
+
+        if (!amx)
+            return;
+
+        static const AMX_NATIVE_INFO natives[] = {{"Twice", &Twice}};
+        SAMP_SDK_CHECK(host.Register_Natives(amx, natives, 1) == 0);
+
+        SAMP_SDK_CHECK(host.Call_Public(amx, "Double", 21).value == 42);
+        SAMP_SDK_CHECK(amx->sysreq_d == 0);
+
+        SAMP_SDK_CHECK(rewriter.Rewrite(amx, nullptr) == 3);
+        SAMP_SDK_CHECK(amx->sysreq_d != 0);
+        SAMP_SDK_CHECK(rewriter.Rewrite(amx, nullptr) == 0);
+
+        Mock_Call_Result twice = host.Call_Public(amx, "Double", 21);
+        SAMP_SDK_CHECK(twice.Ok() && twice.value == 42);
+
+        Mock_Call_Result quad = host.Call_Public(amx, "Quad", 5);
+        SAMP_SDK_CHECK(quad.Ok() && quad.value == 20);
+        SAMP_SDK_CHECK(!host.Call_Public(amx, "Missing", 1).Ok());
+
+        SAMP_SDK_CHECK(rewriter.Repoint(amx, nullptr, {}) == 0);
+
+        std::unordered_map<ucell, ucell> moved{{static_cast<ucell>(reinterpret_cast<uintptr_t>(&Twice)), static_cast<ucell>(reinterpret_cast<uintptr_t>(&Thrice))}};
+        SAMP_SDK_CHECK(rewriter.Repoint(amx, nullptr, moved) == 3);
+
+        Mock_Call_Result thrice = host.Call_Public(amx, "Double", 21);
+        SAMP_SDK_CHECK(thrice.Ok() && thrice.value == 63);
+        SAMP_SDK_CHECK(host.Call_Public(amx, "Quad", 5).value == 45);
+
+        host.Destroy_Amx(amx);
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+
+    Amx_Image_Builder builder = Make_Script();
+
+    Run(builder.Build());
+    Run(builder.Build(true));
+
+    host.Shutdown();
+
+    return Test_Result("sysreq_rewrite_test");
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+
+#define SAMP_SDK_WANT_PROCESS_TICK
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+//
+#include "../sdk/scheduling/thread_pool.hpp"
+#include "test_check.hpp"
+
+namespace {
+    template<typename Predicate>
+    bool Wait_Until(Predicate predicate) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+        while (!predicate()) {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+
+            Samp_SDK::Detail::Main_Thread_Queue::Instance().Process();
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        return true;
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+
+    Samp_SDK::Thread_Pool& pool = Samp_SDK::Thread_Pool::Instance();
+    SAMP_SDK_CHECK(pool.Start(4));
+    SAMP_SDK_CHECK(pool.Is_Running() && pool.Get_Thread_Count() == 4);
+    SAMP_SDK_CHECK(!Samp_SDK::Thread_Pool::Is_Worker_Thread());
+
+    std::atomic<int> counter{0};
+
+    for (int i = 0; i < 10000; ++i)
+        SAMP_SDK_CHECK(pool.Submit([&counter] { ++counter; }));
+
+    SAMP_SDK_CHECK(Wait_Until([&] { return counter.load() == 10000; }));
+
+    std::mutex ids_mtx;
+    std::set<std::thread::id> stolen_by;
+    std::atomic<int> spawned_done{0};
+    bool spawned_on_worker = false;
+
+    pool.Submit([&] {
+        spawned_on_worker = Samp_SDK::Thread_Pool::Is_Worker_Thread();
+
+        for (int i = 0; i < 64; ++i) {
+            Samp_SDK::Thread_Pool::Instance().Submit([&] {
+                {
+                    std::lock_guard<std::mutex> lock(ids_mtx);
+                    stolen_by.insert(std::this_thread::get_id());
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                ++spawned_done;
+            });
+        }
+    });
+
+    SAMP_SDK_CHECK(Wait_Until([&] { return spawned_done.load() == 64; }));
+    SAMP_SDK_CHECK(spawned_on_worker);
+    SAMP_SDK_CHECK(stolen_by.size() >= 2);
+
+    std::atomic<bool> after_throw{false};
+    pool.Submit([] { throw std::runtime_error("task failure"); });
+    pool.Submit([&after_throw] { after_throw = true; });
+    SAMP_SDK_CHECK(Wait_Until([&] { return after_throw.load(); }));
+
+    std::thread::id main_id = std::this_thread::get_id();
+    std::thread::id work_id, callback_id;
+    std::string result;
+    bool void_done = false;
+
+    Samp_SDK::Async([&work_id] { work_id = std::this_thread::get_id(); return std::string("computed"); })
+        .Then_On_Main([&](std::string value) { callback_id = std::this_thread::get_id(), result = std::move(value); });
+    Samp_SDK::Async([] {}).Then_On_Main([&void_done] { void_done = true; });
+
+    SAMP_SDK_CHECK(Wait_Until([&] { return result == "computed" && void_done; }));
+    SAMP_SDK_CHECK(work_id != main_id && callback_id == main_id);
+
+    std::atomic<int> drained{0};
+
+    for (int i = 0; i < 100; ++i)
+        pool.Submit([&drained] { std::this_thread::sleep_for(std::chrono::microseconds(100)), ++drained; });
+
+    pool.Stop();
+    SAMP_SDK_CHECK(drained.load() == 100);
+    SAMP_SDK_CHECK(!pool.Is_Running());
+
+    std::atomic<bool> restarted{false};
+    SAMP_SDK_CHECK(pool.Submit([&restarted] { restarted = true; }));
+    SAMP_SDK_CHECK(Wait_Until([&] { return restarted.load(); }));
+    pool.Stop();
+
+    return Test_Result("thread_pool_test");
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+
+#include <chrono>
+#include <string>
+#include <thread>
+//
+#include "../sdk/samp_sdk.hpp"
+#include "../sdk/testing/mock_host.hpp"
+#include "test_check.hpp"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    int pawn_calls = 0;
+    cell pawn_value = 0;
+    std::string pawn_text;
+
+    void Run_For(std::chrono::milliseconds duration) {
+        Clock::time_point end = Clock::now() + duration;
+
+        while (Clock::now() < end) {
+            Samp_SDK::Timer_Service::Instance().Process();
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+    Samp_SDK::Core::Instance().Load(host.Get_Plugin_Data());
+
+    Samp_SDK::Timer_Service& timers = Samp_SDK::Timer_Service::Instance();
+
+    int once = 0, repeated = 0, self_killed = 0, nested = 0, long_fired = 0, killed = 0;
+    Clock::time_point long_start = Clock::now(), long_fired_at;
+    Samp_SDK::Timer_Id self_id = Samp_SDK::INVALID_TIMER_ID;
+
+    Samp_SDK::Timer_Id once_id = timers.Set_Timer(5, false, [&] { ++once; });
+    Samp_SDK::Timer_Id repeat_id = timers.Set_Timer(10, true, [&] { ++repeated; });
+    self_id = timers.Set_Timer(2, true, [&] {
+        if (++self_killed == 3)
+            timers.Kill_Timer(self_id);
+    });
+    timers.Set_Timer(4, false, [&] { timers.Set_Timer(4, false, [&] { ++nested; }); });
+    timers.Set_Timer(300, false, [&] { ++long_fired, long_fired_at = Clock::now(); });
+    Samp_SDK::Timer_Id doomed_id = timers.Set_Timer(50, false, [&] { ++killed; });
+
+    SAMP_SDK_CHECK(timers.Is_Valid(once_id) && timers.Is_Valid(doomed_id));
+    SAMP_SDK_CHECK(timers.Kill_Timer(doomed_id));
+    SAMP_SDK_CHECK(!timers.Is_Valid(doomed_id) && !timers.Kill_Timer(doomed_id));
+
+    Samp_SDK::Timer_Id reused_id = timers.Set_Timer(1000, false, [] {});
+    SAMP_SDK_CHECK(reused_id != doomed_id && !timers.Is_Valid(doomed_id));
+    timers.Kill_Timer(reused_id);
+
+    Run_For(std::chrono::milliseconds(400));
+
+    SAMP_SDK_CHECK(once == 1 && !timers.Is_Valid(once_id));
+    SAMP_SDK_CHECK(repeated >= 5 && repeated <= 41 && timers.Is_Valid(repeat_id));
+    SAMP_SDK_CHECK(self_killed == 3 && !timers.Is_Valid(self_id));
+    SAMP_SDK_CHECK(nested == 1);
+    SAMP_SDK_CHECK(killed == 0);
+    SAMP_SDK_CHECK(long_fired == 1 && long_fired_at - long_start >= std::chrono::milliseconds(300));
+
+    SAMP_SDK_CHECK(timers.Kill_Timer(repeat_id));
+    SAMP_SDK_CHECK(timers.Get_Active_Count() == 0);
+
+    Mock_Script script;
+    script.publics.push_back({"OnPawnTimer", [](AMX* amx, cell* params) {
+        char text[32] = {};
+        cell* physical = nullptr;
+
+        Samp_SDK::Detail::Mock_Amx_Get_Addr(amx, params[2], &physical);
+        Samp_SDK::Detail::Mock_Amx_Get_String(text, physical, 0, sizeof(text));
+        ++pawn_calls;
+        pawn_value = params[1];
+        pawn_text = text;
+
+        return 1;
+    }});
+
+    AMX* amx = host.Create_Amx(script);
+    SAMP_SDK_CHECK(amx != nullptr);
+
+    if (amx) {
+        Samp_SDK::Detail::Public_Packet packet;
+        packet.Push_All(77, "tick");
+
+        Samp_SDK::Timer_Id pawn_id = timers.Set_Pawn_Timer(amx, "OnPawnTimer", 5, true, std::move(packet));
+        Run_For(std::chrono::milliseconds(30));
+
+        SAMP_SDK_CHECK(pawn_calls >= 1 && pawn_value == 77 && pawn_text == "tick");
+
+        timers.Kill_Amx_Timers(amx);
+        SAMP_SDK_CHECK(!timers.Is_Valid(pawn_id) && timers.Get_Active_Count() == 0);
+
+        int calls_after_kill = pawn_calls;
+        Run_For(std::chrono::milliseconds(20));
+        SAMP_SDK_CHECK(pawn_calls == calls_after_kill);
+    }
+
+    host.Shutdown();
+
+    return Test_Result("timer_service_test");
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+//
+#include "../sdk/diagnostics/tracer.hpp"
+#include "test_check.hpp"
+
+namespace {
+    const char* const TRACE_PATH = "tracer_test.json";
+
+    size_t Count_Written_Events() {
+        Samp_SDK::Tracer::Instance().Write(TRACE_PATH);
+
+        std::ifstream file(TRACE_PATH);
+        std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        size_t count = 0;
+
+        for (size_t at = text.find("\"ph\":\"X\""); at != std::string::npos; at = text.find("\"ph\":\"X\"", at + 1))
+            ++count;
+
+        return count;
+    }
+
+    void Record_Events(int count) {
+        Samp_SDK::Tracer& tracer = Samp_SDK::Tracer::Instance();
+
+        for (int i = 0; i < count; ++i)
+            tracer.Record(Samp_SDK::Trace_Category::Native, "TraceNative", tracer.Now());
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+
+    Samp_SDK::Tracer& tracer = Samp_SDK::Tracer::Instance();
+
+    SAMP_SDK_CHECK(tracer.Start(4));
+    SAMP_SDK_CHECK(!tracer.Start(64));
+    Record_Events(10);
+    SAMP_SDK_CHECK(Count_Written_Events() == 4);
+    tracer.Stop();
+
+    SAMP_SDK_CHECK(tracer.Start(16));
+    SAMP_SDK_CHECK(Count_Written_Events() == 0);
+    Record_Events(10);
+    SAMP_SDK_CHECK(Count_Written_Events() == 10);
+    tracer.Stop();
+
+    std::atomic<bool> running{true};
+    std::thread worker([&running] {
+        while (running.load(std::memory_order_relaxed)) {
+            if (Samp_SDK::Tracer::Instance().Is_Enabled())
+                Record_Events(8);
+        }
+    });
+
+    for (int round = 0; round < 200; ++round) {
+        SAMP_SDK_CHECK(tracer.Start(static_cast<size_t>(4) << (round % 4)));
+        std::this_thread::yield();
+        tracer.Stop();
+    }
+
+    running.store(false, std::memory_order_relaxed);
+    worker.join();
+
+    SAMP_SDK_CHECK(Count_Written_Events() <= 32);
+    std::remove(TRACE_PATH);
+
+    return Test_Result("tracer_test");
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+//
+#include "../sdk/testing/traffic_replay.hpp"
+#include "../sdk/utils/hash.hpp"
+#include "test_check.hpp"
+
+namespace {
+    const char* const LOG_PATH = "traffic_replay_test.log";
+    const char* const CORRUPT_LOG_PATH = "traffic_replay_test_corrupt.log";
+    const char* const FULL_LOG_PATH = "traffic_replay_test_full.log";
+    const char* const LONG_NATIVE_NAME = "A_Native_With_A_Name_Long_Enough_To_Overflow_The_Small_Log_X";
+
+    std::vector<unsigned char> Read_File(const char* path) {
+        std::ifstream file(path, std::ios::binary);
+
+        return std::vector<unsigned char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    void Write_File(const char* path, const std::vector<unsigned char>& bytes) {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    std::vector<size_t> Find_Native_Records(const std::vector<unsigned char>& bytes) {
+        std::vector<size_t> offsets;
+
+        for (size_t offset = sizeof(Samp_SDK::Detail::Traffic_File_Header); offset + sizeof(Samp_SDK::Detail::Traffic_Record_Header) <= bytes.size();) {
+            Samp_SDK::Detail::Traffic_Record_Header header;
+            std::memcpy(&header, bytes.data() + offset, sizeof(header));
+
+            if (header.size < sizeof(header) || offset + header.size > bytes.size())
+                break;
+
+            if (header.type == static_cast<uint8_t>(Samp_SDK::Detail::Traffic_Record_Type::Native))
+                offsets.push_back(offset + sizeof(header));
+
+            offset += header.size;
+        }
+
+        return offsets;
+    }
+
+    cell SAMP_SDK_CDECL Message_Original(AMX* amx, cell* params) {
+        (void)amx;
+
+        return params[1] * 10;
+    }
+
+    cell SAMP_SDK_CDECL Message_Hook(AMX* amx, cell* params) {
+        Samp_SDK::Detail::Traffic_Scope scope(amx, Samp_SDK::Detail::FNV1a_Hash("SendClientMessage"), "SendClientMessage", params);
+
+        return scope.Finish(Message_Original(amx, params));
+    }
+
+    cell Call_Recorded(AMX* amx, int index, cell playerid) {
+        cell hea = amx->hea;
+        cell address = 0;
+        cell* physical = nullptr;
+        cell result = 0;
+
+        Samp_SDK::Detail::Mock_Amx_Allot(amx, 8, &address, &physical);
+        Samp_SDK::Detail::Mock_Amx_Set_String(physical, "hello", 0, 0, 8);
+        Samp_SDK::Detail::Mock_Amx_Push(amx, address);
+        Samp_SDK::Detail::Mock_Amx_Push(amx, playerid);
+
+        {
+            Samp_SDK::Detail::Traffic_Scope scope(amx, Samp_SDK::Detail::FNV1a_Hash("OnPlayerText"), "OnPlayerText", &result, false);
+            Samp_SDK::Detail::Mock_Amx_Exec(amx, &result, index);
+        }
+
+        amx->hea = hea;
+
+        return result;
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+
+    Mock_Script script;
+    script.natives = {"SendClientMessage"};
+    script.publics.push_back({"OnPlayerText", [](AMX* amx, cell* params) {
+        return Mock_Host::Instance().Call_Native(amx, "SendClientMessage", params[1], -1, "reply").value + 1;
+    }});
+
+    AMX* amx = host.Create_Amx(script);
+    SAMP_SDK_CHECK(amx != nullptr);
+
+    if (!amx)
+        return Test_Result("traffic_replay_test");
+
+    static const AMX_NATIVE_INFO natives[] = {{"SendClientMessage", &Message_Hook}};
+    host.Register_Natives(amx, natives, 1);
+
+    int index = -1;
+    Samp_SDK::Detail::Mock_Amx_Find_Public(amx, "OnPlayerText", &index);
+
+    Samp_SDK::Traffic_Recorder::Instance().Declare_References("SendClientMessage", {3});
+    SAMP_SDK_CHECK(Samp_SDK::Traffic_Recorder::Instance().Start(LOG_PATH, 1 << 20));
+
+    for (cell tick = 0; tick < 3; ++tick) {
+        Samp_SDK::Traffic_Recorder::Instance().Record_Tick();
+        SAMP_SDK_CHECK(Call_Recorded(amx, index, tick + 3) == (tick + 3) * 10 + 1);
+    }
+
+    SAMP_SDK_CHECK(Samp_SDK::Traffic_Recorder::Instance().Get_Used_Bytes() > 0);
+    Samp_SDK::Traffic_Recorder::Instance().Stop();
+
+    SAMP_SDK_CHECK(Samp_SDK::Traffic_Recorder::Instance().Start(FULL_LOG_PATH, sizeof(Samp_SDK::Detail::Traffic_File_Header) + 72));
+
+    {
+        cell params[1] = {0};
+        Samp_SDK::Detail::Traffic_Scope scope(amx, Samp_SDK::Detail::FNV1a_Hash(LONG_NATIVE_NAME), LONG_NATIVE_NAME, params);
+    }
+
+    SAMP_SDK_CHECK(Samp_SDK::Traffic_Recorder::Instance().Get_Dropped_Count() == 1);
+    Samp_SDK::Traffic_Recorder::Instance().Stop();
+    host.Shutdown();
+
+    {
+        Traffic_Replay full_replay;
+        SAMP_SDK_CHECK(full_replay.Open(FULL_LOG_PATH));
+        SAMP_SDK_CHECK(full_replay.Get_Record_Count() == 0);
+    }
+
+    std::vector<unsigned char> bytes = Read_File(LOG_PATH);
+    std::vector<size_t> native_records = Find_Native_Records(bytes);
+    SAMP_SDK_CHECK(native_records.size() == 3);
+
+    for (size_t offset : native_records) {
+        Samp_SDK::Detail::Traffic_Call_Record call;
+        std::memcpy(&call, bytes.data() + offset, sizeof(call));
+        SAMP_SDK_CHECK(call.arg_count == 3 && call.region_count == 1);
+
+        if (call.arg_count != 3 || call.region_count != 1)
+            continue;
+
+        cell message = 0;
+        Samp_SDK::Detail::Traffic_Region region;
+        std::memcpy(&message, bytes.data() + offset + sizeof(call) + 2 * sizeof(cell), sizeof(message));
+        std::memcpy(&region, bytes.data() + offset + sizeof(call) + 3 * sizeof(cell), sizeof(region));
+        SAMP_SDK_CHECK(region.address == message && region.cell_count == 6);
+
+        call.region_count = 0x7FFFFFFF;
+        std::memcpy(bytes.data() + offset, &call, sizeof(call));
+    }
+
+    Write_File(CORRUPT_LOG_PATH, bytes);
+
+    Traffic_Replay replay;
+    SAMP_SDK_CHECK(replay.Open(LOG_PATH));
+    SAMP_SDK_CHECK(replay.Get_Record_Count() > 0);
+    SAMP_SDK_CHECK(replay.Attach());
+
+    Replay_Report report = replay.Run();
+    report.Print();
+
+    SAMP_SDK_CHECK(report.publics == 3);
+    SAMP_SDK_CHECK(report.natives == 3);
+    SAMP_SDK_CHECK(report.ticks == 3);
+    SAMP_SDK_CHECK(report.result_mismatches == 0);
+    SAMP_SDK_CHECK(report.unmatched_calls == 0);
+    SAMP_SDK_CHECK(report.skipped_records == 0);
+
+    host.Shutdown();
+
+    {
+        Traffic_Replay corrupt_replay;
+        SAMP_SDK_CHECK(corrupt_replay.Open(CORRUPT_LOG_PATH));
+        SAMP_SDK_CHECK(corrupt_replay.Attach());
+
+        Replay_Report corrupt_report = corrupt_replay.Run();
+
+        SAMP_SDK_CHECK(corrupt_report.publics == 3);
+        SAMP_SDK_CHECK(corrupt_report.natives == 0);
+        SAMP_SDK_CHECK(corrupt_report.skipped_records == 3);
+        SAMP_SDK_CHECK(corrupt_report.result_mismatches == 0);
+    }
+
+    host.Shutdown();
+    std::remove(LOG_PATH);
+    std::remove(CORRUPT_LOG_PATH);
+    std::remove(FULL_LOG_PATH);
+
+    return Test_Result("traffic_replay_test");
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+/* ============================================================================ *
+ * SA-MP SDK - A Modern C++ SDK for San Andreas Multiplayer Plugin Development  *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * This SDK provides a modern, high-level C++ abstraction layer over the native *
+ * SA-MP Plugin SDK. It is designed to simplify plugin development by offering  *
+ * type-safe, object-oriented, and robust interfaces for interacting with the   *
+ * SA-MP server and the Pawn scripting environment.                             *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/samp-sdk                         *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the MIT License (the "License"); you may not use this file    *
+ * except in compliance with the License. You may obtain a copy of the License  *
+ * at:                                                                          *
+ *                                                                              *
+ *     https://opensource.org/licenses/MIT                                      *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+//
+#include "../sdk/samp_sdk.hpp"
+#include "../sdk/testing/mock_host.hpp"
+#include "test_check.hpp"
+
+namespace {
+    bool Wait_For_Report(const char* text) {
+        for (int attempt = 0; attempt < 200; ++attempt) {
+            for (const std::string& line : Samp_SDK::Testing::Mock_Host::Instance().Get_Log()) {
+                if (line.find("Watchdog") != std::string::npos && line.find(text) != std::string::npos)
+                    return true;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        return false;
+    }
+
+    bool Log_Contains(const char* first, const char* second) {
+        for (const std::string& line : Samp_SDK::Testing::Mock_Host::Instance().Get_Log()) {
+            if (line.find(first) != std::string::npos && line.find(second) != std::string::npos)
+                return true;
+        }
+
+        return false;
+    }
+}
+
+int main() {
+    using namespace Samp_SDK::Testing;
+    using Samp_SDK::Detail::Call_Scope;
+    using Samp_SDK::Trace_Category;
+
+    Mock_Host& host = Mock_Host::Instance();
+    host.Set_Log_Echo(false);
+    Samp_SDK::Core::Instance().Load(host.Get_Plugin_Data());
+
+    Mock_Script script;
+    AMX* amx = host.Create_Amx(script);
+    SAMP_SDK_CHECK(amx != nullptr);
+
+    if (!amx)
+        return Test_Result("watchdog_test");
+
+    Samp_SDK::Watchdog::Is_Server_Thread() = true;
+    Samp_SDK::Watchdog::Instance().Start(std::chrono::milliseconds(20));
+
+    {
+        Call_Scope public_scope(Trace_Category::Public, "OnSlowPublic", amx);
+
+        SAMP_SDK_CHECK(Wait_For_Report("OnSlowPublic"));
+        SAMP_SDK_CHECK(!Log_Contains("OnSlowPublic", "cip"));
+
+        amx->cip = 0x1234;
+
+        {
+            Call_Scope native_scope(Trace_Category::Native, "SlowNative", amx);
+            amx->cip = 0x5678;
+
+            SAMP_SDK_CHECK(Wait_For_Report("SlowNative"));
+        }
+
+        SAMP_SDK_CHECK(Log_Contains("SlowNative", "cip 0x00001234"));
+    }
+
+    Samp_SDK::Watchdog::Instance().Stop();
+    host.Shutdown();
+
+    return Test_Result("watchdog_test");
+}
\ No newline at end of file